@@ -36,7 +36,23 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define TIMER_8_BIT_ASYNC_COUNT 1
 #define TIMER_16_BIT_COUNT      1
 
+/* Binds timers registers at compile time (direct I/O accesses), runtime handles are then ignored by the drivers.
+   Configuring the firmware with -DTIMERS_STATIC_BINDING=ON enables all three */
+//#define TIMER_8_BIT_STATIC_BINDING
+//#define TIMER_8_BIT_ASYNC_STATIC_BINDING
+//#define TIMER_16_BIT_STATIC_BINDING
+
+/* Timer interrupt vectors routing (see timer_isr.h) : timebase is the only user of timer 2 compare match A,
+   it is called directly from the vector */
+#define TIMER_ISR_TIMER2_COMPA_HANDLER  timebase_interrupt_callback
+#define TIMER_ISR_TIMER2_COMPA_ARG      0U
+
 #define TIMEBASE_MAX_MODULES 3U
+#define INPUT_CAPTURE_MAX_MODULES 1U
+#define SOFT_PWM_MAX_MODULES 1U
+#define PULSE_COUNTER_MAX_MODULES 1U
+#define PWM_ADC_SYNC_MAX_MODULES 1U
+#define ADC_SAMPLER_MAX_MODULES 1U
 #define I2C_DEVICES_COUNT 1U
 
 // Only implement master tx driver
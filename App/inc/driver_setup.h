@@ -41,6 +41,7 @@ driver_setup_error_t driver_init_adc(void);
 driver_setup_error_t driver_init_timer_0(void);
 driver_setup_error_t driver_init_timer_1(void);
 driver_setup_error_t driver_init_timer_2(void);
+driver_setup_error_t driver_init_timer_sync(void);
 driver_setup_error_t driver_init_i2c(void);
 driver_setup_error_t driver_init_lcd(void);
 
@@ -35,6 +35,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "timer_8_bit.h"
 #include "timer_8_bit_async.h"
 #include "timer_16_bit.h"
+#include "timer_sync.h"
 #include "i2c.h"
 #include "HD44780_lcd.h"
 
@@ -225,6 +226,19 @@ driver_setup_error_t driver_init_timer_2(void)
     return DRIVER_SETUP_ERROR_OK;
 }
 
+driver_setup_error_t driver_init_timer_sync(void)
+{
+    timer_sync_handle_t handle = {0};
+    handle.GTCCR_REG = &GTCCR;
+
+    timer_error_t local_error = timer_sync_set_handle(&handle);
+    if (TIMER_ERROR_OK != local_error)
+    {
+        return DRIVER_SETUP_ERROR_INIT_FAILED;
+    }
+    return DRIVER_SETUP_ERROR_OK;
+}
+
 driver_setup_error_t driver_init_i2c(void)
 {
     i2c_config_t config = {0};
@@ -32,6 +32,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "timer_8_bit.h"
 #include "timer_8_bit_async.h"
 #include "timer_16_bit.h"
+#include "timer_sync.h"
+#include "timer_isr.h"
 #include "HD44780_lcd.h"
 #include "timebase.h"
 #include "i2c.h"
@@ -66,11 +68,6 @@ ISR(ADC_vect)
     adc_isr_handler();
 }
 
-ISR(TIMER2_COMPA_vect)
-{
-    timebase_interrupt_callback(0U);
-}
-
 int main(void)
 {
     bootup_sequence();
@@ -128,6 +125,9 @@ static void bootup_sequence(void)
     driver_setup_error_t driver_init_error = DRIVER_SETUP_ERROR_OK;
     module_setup_error_t module_init_error = MODULE_SETUP_ERROR_OK;
 
+    /* Timer interrupt vectors are implemented by the timer_isr driver, as routed in config.h */
+    timer_isr_init();
+
     /* Set up 8 bit timer 0 as 8 bit FAST PWM generator */
     driver_init_error = driver_init_timer_0();
     if (DRIVER_SETUP_ERROR_OK != driver_init_error)
@@ -149,6 +149,12 @@ static void bootup_sequence(void)
         error_handler();
     }
 
+    driver_init_error = driver_init_timer_sync();
+    if (DRIVER_SETUP_ERROR_OK != driver_init_error)
+    {
+        error_handler();
+    }
+
     module_init_error = module_init_timebase();
     if (MODULE_SETUP_ERROR_OK != module_init_error)
     {
@@ -182,18 +188,14 @@ static void bootup_sequence(void)
     adc_start();
     sei();
 
-    /* Start both timers */
-    timer_error_t timer_error = timer_8_bit_start(0);
-    if (TIMER_ERROR_OK != timer_error)
-    {
-        error_handler();
-    }
-    timer_error = timer_16_bit_start(0);
-    if (TIMER_ERROR_OK != timer_error)
+    /* Start all PWM carriers at once, phase aligned, so that they do not drift apart between boots */
+    const timer_sync_member_t pwm_carriers[3] =
     {
-        error_handler();
-    }
-    timer_error = timer_8_bit_async_start(0);
+        {.type = TIMER_SYNC_TIMER_8_BIT,       .id = 0U, .phase_offset = 0U},
+        {.type = TIMER_SYNC_TIMER_16_BIT,      .id = 0U, .phase_offset = 0U},
+        {.type = TIMER_SYNC_TIMER_8_BIT_ASYNC, .id = 0U, .phase_offset = 0U},
+    };
+    timer_error_t timer_error = timer_sync_start_group(pwm_carriers, 3U);
     if (TIMER_ERROR_OK != timer_error)
     {
         error_handler();
@@ -0,0 +1,88 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/* Host benchmark of the millivolts conversion : former 32 bits division against the precomputed fixed point scale.
+   Not part of the unit tests suite, run it by hand : only relative timings are meaningful, AVR gains are much larger
+   as it has no hardware divider */
+
+#include <chrono>
+#include <cstdio>
+#include "adc.h"
+#include "adc_reg.h"
+#include "adc_register_stub.h"
+
+/* Former millivolts conversion, with a 32 bits division per call */
+static adc_millivolts_t divide_to_millivolt(const adc_result_t result, const uint16_t supply_voltage_mv)
+{
+    const uint32_t max_value = 1024UL;
+    return (adc_millivolts_t)(((uint32_t)result * supply_voltage_mv) / max_value);
+}
+
+int main(void)
+{
+    const uint32_t iterations = 1000000UL;
+    volatile uint32_t sink = 0;
+    adc_millivolts_t millivolts = 0;
+    adc_result_t result = 0;
+    adc_config_hal_t config;
+
+    adc_register_stub_erase(&adc_register_stub);
+    adc_config_hal_get_default(&config);
+    config.ref = ADC_VOLTAGE_REF_AVCC;
+    config.supply_voltage_mv = 5000U;
+    config.using_interrupt = true;
+    adc_register_stub_init_adc_handle(&config.handle, &adc_register_stub);
+    if ((ADC_ERROR_OK != adc_base_init(&config)) || (ADC_ERROR_OK != adc_register_channel(ADC_MUX_ADC0)))
+    {
+        return 1;
+    }
+
+    /* Both loops pay for the channel lookup, only the conversion itself differs */
+    const auto start_division = std::chrono::steady_clock::now();
+    for (uint32_t i = 0 ; i < iterations ; i++)
+    {
+        (void) adc_read_raw(ADC_MUX_ADC0, &result);
+        sink = sink + divide_to_millivolt((adc_result_t)(result + (i & 0x3FFU)), config.supply_voltage_mv);
+    }
+    const auto start_scale = std::chrono::steady_clock::now();
+    for (uint32_t i = 0 ; i < iterations ; i++)
+    {
+        (void) adc_read_millivolt(ADC_MUX_ADC0, &millivolts);
+        sink = sink + millivolts;
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const auto division_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(start_scale - start_division).count();
+    const auto scale_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start_scale).count();
+    printf("division : %.2f ns/call, precomputed scale : %.2f ns/call\n",
+           (double) division_ns / iterations, (double) scale_ns / iterations);
+    adc_base_deinit();
+    return 0;
+}
@@ -49,6 +49,23 @@ static adc_mux_t mux_lookup_table[ADC_MUX_COUNT] =
     ADC_MUX_1v1_REF
 };
 
+/* Former millivolts conversion, with a 32 bits division per call */
+static adc_millivolts_t divide_to_millivolt(const adc_result_t result, const uint8_t oversampling, const adc_voltage_ref_t ref,
+                                            const uint16_t supply_voltage_mv)
+{
+    const uint32_t max_value = 1024UL << oversampling;
+    switch (ref)
+    {
+        case ADC_VOLTAGE_REF_INTERNAL_1V1:
+            return (adc_millivolts_t)(((uint32_t)result * 1100UL) / max_value);
+        case ADC_VOLTAGE_REF_AREF_PIN:
+        case ADC_VOLTAGE_REF_AVCC:
+            return (adc_millivolts_t)(((uint32_t)result * supply_voltage_mv) / max_value);
+        default:
+            return 0;
+    }
+}
+
 class AdcTestFixture : public ::testing::Test
 {
 public:
@@ -64,6 +81,7 @@ protected:
         config.supply_voltage_mv = 5000;
         config.trigger_sources = ADC_TRIGGER_EXT_INT_REQUEST_0;
         config.using_interrupt = true;
+        config.track_supply = false;
         adc_register_stub_init_adc_handle(&config.handle, &adc_register_stub);
     }
     void TearDown() override
@@ -159,6 +177,8 @@ TEST_F(AdcTestFixture, adc_process_test)
                                          547, 985, 11,
                                          25 , 14 , 54,
                                          412, 23 , 18};
+    /* adc_process() only fetches results in polling mode, the ISR does it otherwise */
+    config.using_interrupt = false;
     /* test initialisation of registers */
     const auto& init_result = adc_base_init(&config);
     ASSERT_EQ(init_result, ADC_ERROR_OK);
@@ -256,6 +276,457 @@ TEST_F(AdcTestFixture, adc_isr_test)
     }
 }
 
+TEST_F(AdcTestFixture, adc_timer_triggered_conversions)
+{
+    config.running_mode = ADC_RUNNING_MODE_AUTOTRIGGERED;
+    config.trigger_sources = ADC_TRIGGER_TIMER1_COMP_B_INT;
+    adc_register_stub.adcsrb_reg = ADTS_MSK;
+    const auto& init_result = adc_base_init(&config);
+    ASSERT_EQ(init_result, ADC_ERROR_OK);
+    ASSERT_EQ(ADC_TRIGGER_TIMER1_COMP_B_INT, (adc_register_stub.adcsrb_reg & ADTS_MSK) >> ADTS0);
+    ASSERT_EQ(ADATE_MSK, adc_register_stub.adcsra_reg & ADATE_MSK);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_ADC0), ADC_ERROR_OK);
+
+    /* Conversions are only started by the timer, never by software. First trigger already samples the current channel */
+    adc_register_stub.mux_reg |= ADC_MUX_ADC5;
+    ASSERT_EQ(ADC_STATE_READY, adc_start());
+    ASSERT_EQ(ADEN_MSK, adc_register_stub.adcsra_reg & (ADEN_MSK | ADSC_MSK));
+    ASSERT_EQ(ADC_MUX_ADC0, adc_register_stub.mux_reg & MUX_MSK);
+
+    adc_register_stub.readings.adclow_reg = 0x34;
+    adc_register_stub.readings.adchigh_reg = 0x02;
+    adc_register_stub.adcsra_reg |= ADIF_MSK;
+    adc_isr_handler();
+    ASSERT_EQ(0, adc_register_stub.adcsra_reg & ADSC_MSK);
+
+    adc_result_t result = 0;
+    ASSERT_EQ(adc_read_raw(ADC_MUX_ADC0, &result), ADC_ERROR_OK);
+    ASSERT_EQ(0x234, result);
+}
+
+TEST_F(AdcTestFixture, adc_process_leaves_results_to_isr)
+{
+    config.alignment = ADC_RIGT_ALIGNED_RESULT;
+    config.ref = ADC_VOLTAGE_REF_AVCC;
+    config.running_mode = ADC_RUNNING_MODE_AUTOTRIGGERED;
+    config.trigger_sources = ADC_TRIGGER_TIMER1_COMP_B_INT;
+    config.track_supply = true;
+    ASSERT_EQ(adc_base_init(&config), ADC_ERROR_OK);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_ADC0), ADC_ERROR_OK);
+    ASSERT_EQ(ADC_STATE_READY, adc_start());
+
+    /* Bandgap is converted on the first trigger, ADC0 is selected for the next one */
+    adc_register_stub.readings.adclow_reg = 240U;
+    adc_register_stub.readings.adchigh_reg = 0U;
+    adc_register_stub.adcsra_reg |= ADIF_MSK;
+    adc_isr_handler();
+    ASSERT_EQ(ADC_MUX_ADC0, adc_register_stub.mux_reg & MUX_MSK);
+
+    /* No conversion is running between triggers : adc_process() shall not fetch the last result again */
+    for (uint8_t i = 0 ; i < 5U ; i++)
+    {
+        ASSERT_EQ(ADC_STATE_READY, adc_process());
+    }
+    adc_result_t result = 0xFFFFU;
+    ASSERT_EQ(adc_read_raw(ADC_MUX_ADC0, &result), ADC_ERROR_OK);
+    ASSERT_EQ(0U, result);
+    ASSERT_EQ(ADC_MUX_ADC0, adc_register_stub.mux_reg & MUX_MSK);
+
+    /* Deferred supply tracking still ran */
+    uint16_t supply_mv = 0;
+    ASSERT_EQ(adc_get_supply_voltage(&supply_mv), ADC_ERROR_OK);
+    ASSERT_EQ(4693U, supply_mv);
+}
+
+static void simulate_conversion(const uint16_t value)
+{
+    adc_register_stub.readings.adclow_reg = (uint8_t) (value & 0xFF);
+    adc_register_stub.readings.adchigh_reg = (uint8_t) ((value & 0x0300) >> 8U);
+    adc_register_stub.adcsra_reg &= ~(ADSC_MSK);
+    adc_register_stub.adcsra_reg |= (ADIF_MSK);
+    adc_isr_handler();
+}
+
+TEST_F(AdcTestFixture, adc_oversampling_and_ring_buffer)
+{
+    adc_result_t buffer[4] = {0};
+    adc_channel_config_t channel_config = {.oversampling = 2U, .buffer = buffer, .buffer_size = 4U, .quiet = false,
+                                           .filter_shift = 0U, .weight = 1U};
+
+    /* Oversampling is not compatible with left aligned results */
+    ASSERT_EQ(adc_base_init(&config), ADC_ERROR_OK);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_ADC0), ADC_ERROR_OK);
+    ASSERT_EQ(adc_configure_channel(ADC_MUX_ADC0, &channel_config), ADC_ERROR_CONFIG);
+    adc_base_deinit();
+
+    config.alignment = ADC_RIGT_ALIGNED_RESULT;
+    ASSERT_EQ(adc_base_init(&config), ADC_ERROR_OK);
+    ASSERT_EQ(adc_configure_channel(ADC_MUX_ADC0, &channel_config), ADC_ERROR_CHANNEL_NOT_FOUND);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_ADC0), ADC_ERROR_OK);
+    ASSERT_EQ(adc_configure_channel(ADC_MUX_ADC0, nullptr), ADC_ERROR_NULL_POINTER);
+    channel_config.oversampling = ADC_OVERSAMPLING_MAX + 1U;
+    ASSERT_EQ(adc_configure_channel(ADC_MUX_ADC0, &channel_config), ADC_ERROR_CONFIG);
+    channel_config.oversampling = 2U;
+    ASSERT_EQ(adc_configure_channel(ADC_MUX_ADC0, &channel_config), ADC_ERROR_OK);
+
+    /* 16 conversions per 12 bits result : 512 and 513 averages to 512.5, which is exactly 2050 / 4 */
+    adc_result_t result = 0;
+    for (uint8_t i = 0 ; i < 15U ; i++)
+    {
+        simulate_conversion(512U + (i % 2U));
+    }
+    ASSERT_EQ(adc_read_raw(ADC_MUX_ADC0, &result), ADC_ERROR_OK);
+    ASSERT_EQ(result, 0U);
+    simulate_conversion(513U);
+    ASSERT_EQ(adc_read_raw(ADC_MUX_ADC0, &result), ADC_ERROR_OK);
+    ASSERT_EQ(result, 2050U);
+
+    adc_millivolts_t millivolts = 0;
+    ASSERT_EQ(adc_read_millivolt(ADC_MUX_ADC0, &millivolts), ADC_ERROR_OK);
+    ASSERT_EQ(millivolts, 2502U);
+
+    adc_result_t samples[8] = {0};
+    uint8_t count = 0;
+    ASSERT_EQ(adc_read_samples(ADC_MUX_ADC0, samples, 8U, &count), ADC_ERROR_OK);
+    ASSERT_EQ(count, 1U);
+    ASSERT_EQ(samples[0], 2050U);
+    ASSERT_EQ(adc_read_samples(ADC_MUX_ADC0, samples, 8U, &count), ADC_ERROR_OK);
+    ASSERT_EQ(count, 0U);
+
+    /* 6 more results overflow the ring buffer, only the 4 latest ones are kept */
+    for (uint16_t result_index = 0 ; result_index < 6U ; result_index++)
+    {
+        for (uint8_t i = 0 ; i < 16U ; i++)
+        {
+            simulate_conversion(100U + result_index);
+        }
+    }
+    ASSERT_EQ(adc_read_samples(ADC_MUX_ADC0, samples, 3U, &count), ADC_ERROR_OK);
+    ASSERT_EQ(count, 3U);
+    ASSERT_EQ(samples[0], 408U);
+    ASSERT_EQ(samples[1], 412U);
+    ASSERT_EQ(samples[2], 416U);
+    ASSERT_EQ(adc_read_samples(ADC_MUX_ADC0, samples, 3U, &count), ADC_ERROR_OK);
+    ASSERT_EQ(count, 1U);
+    ASSERT_EQ(samples[0], 420U);
+
+    /* Channels without ring buffer only keep their last result */
+    ASSERT_EQ(adc_register_channel(ADC_MUX_ADC1), ADC_ERROR_OK);
+    ASSERT_EQ(adc_read_samples(ADC_MUX_ADC1, samples, 8U, &count), ADC_ERROR_CONFIG);
+    ASSERT_EQ(adc_read_samples(ADC_MUX_ADC1, nullptr, 8U, &count), ADC_ERROR_NULL_POINTER);
+}
+
+TEST_F(AdcTestFixture, adc_quiet_conversions)
+{
+    adc_channel_config_t channel_config = {.oversampling = 0U, .buffer = nullptr, .buffer_size = 0U, .quiet = true,
+                                           .filter_shift = 0U, .weight = 1U};
+
+    /* CPU can only be woken up by the ADC interrupt */
+    config.using_interrupt = false;
+    ASSERT_EQ(adc_base_init(&config), ADC_ERROR_OK);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_ADC1), ADC_ERROR_OK);
+    ASSERT_EQ(adc_configure_channel(ADC_MUX_ADC1, &channel_config), ADC_ERROR_CONFIG);
+    adc_base_deinit();
+
+    config.using_interrupt = true;
+    ASSERT_EQ(adc_base_init(&config), ADC_ERROR_OK);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_ADC0), ADC_ERROR_OK);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_ADC1), ADC_ERROR_OK);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_ADC2), ADC_ERROR_OK);
+    ASSERT_EQ(adc_configure_channel(ADC_MUX_ADC1, &channel_config), ADC_ERROR_OK);
+
+    /* Normal channel is started by software */
+    ASSERT_EQ(ADC_STATE_READY, adc_start());
+    ASSERT_EQ(ADSC_MSK, adc_register_stub.adcsra_reg & ADSC_MSK);
+
+    /* Quiet channel is selected by the ISR but not started */
+    simulate_conversion(100U);
+    ASSERT_EQ(ADC_MUX_ADC1, adc_register_stub.mux_reg & MUX_MSK);
+    ASSERT_EQ(0, adc_register_stub.adcsra_reg & ADSC_MSK);
+
+    /* Entering ADC noise reduction sleep mode starts the conversion */
+    ASSERT_EQ(ADC_STATE_READY, adc_process());
+    ASSERT_EQ(ADSC_MSK, adc_register_stub.adcsra_reg & ADSC_MSK);
+
+    /* ADC interrupt wakes the CPU up, next channel goes on in normal mode */
+    simulate_conversion(200U);
+    ASSERT_EQ(ADC_MUX_ADC2, adc_register_stub.mux_reg & MUX_MSK);
+    ASSERT_EQ(ADSC_MSK, adc_register_stub.adcsra_reg & ADSC_MSK);
+
+    adc_result_t result = 0;
+    ASSERT_EQ(adc_read_raw(ADC_MUX_ADC0, &result), ADC_ERROR_OK);
+    ASSERT_EQ(100U, result);
+    ASSERT_EQ(adc_read_raw(ADC_MUX_ADC1, &result), ADC_ERROR_OK);
+    ASSERT_EQ(200U, result);
+}
+
+TEST_F(AdcTestFixture, adc_exponential_moving_average)
+{
+    adc_channel_config_t channel_config = {.oversampling = 0U, .buffer = nullptr, .buffer_size = 0U, .quiet = false,
+                                           .filter_shift = ADC_FILTER_SHIFT_MAX + 1U, .weight = 1U};
+    adc_result_t result = 0;
+    adc_millivolts_t millivolts = 0;
+
+    config.alignment = ADC_RIGT_ALIGNED_RESULT;
+    ASSERT_EQ(adc_base_init(&config), ADC_ERROR_OK);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_ADC0), ADC_ERROR_OK);
+    ASSERT_EQ(adc_configure_channel(ADC_MUX_ADC0, &channel_config), ADC_ERROR_CONFIG);
+    ASSERT_EQ(adc_read_filtered(ADC_MUX_ADC0, &result), ADC_ERROR_CONFIG);
+    ASSERT_EQ(adc_read_filtered(ADC_MUX_ADC0, nullptr), ADC_ERROR_NULL_POINTER);
+    ASSERT_EQ(adc_read_filtered(ADC_MUX_ADC1, &result), ADC_ERROR_CHANNEL_NOT_FOUND);
+
+    /* Coefficient is 1/4 */
+    channel_config.filter_shift = 2U;
+    ASSERT_EQ(adc_configure_channel(ADC_MUX_ADC0, &channel_config), ADC_ERROR_OK);
+
+    /* First result seeds the filter */
+    simulate_conversion(400U);
+    ASSERT_EQ(adc_read_filtered(ADC_MUX_ADC0, &result), ADC_ERROR_OK);
+    ASSERT_EQ(400U, result);
+
+    /* Step response : each result closes a quarter of the remaining gap, raw value follows the input right away */
+    const adc_result_t expected[4] = {500U, 575U, 631U, 673U};
+    for (uint8_t i = 0 ; i < 4U ; i++)
+    {
+        simulate_conversion(800U);
+        ASSERT_EQ(adc_read_filtered(ADC_MUX_ADC0, &result), ADC_ERROR_OK);
+        ASSERT_EQ(expected[i], result);
+    }
+    ASSERT_EQ(adc_read_raw(ADC_MUX_ADC0, &result), ADC_ERROR_OK);
+    ASSERT_EQ(800U, result);
+
+    /* Fractional part is kept in the filter state : filter converges to the exact input value */
+    for (uint8_t i = 0 ; i < 40U ; i++)
+    {
+        simulate_conversion(800U);
+    }
+    ASSERT_EQ(adc_read_filtered(ADC_MUX_ADC0, &result), ADC_ERROR_OK);
+    ASSERT_EQ(800U, result);
+    ASSERT_EQ(adc_read_filtered_millivolt(ADC_MUX_ADC0, &millivolts), ADC_ERROR_OK);
+    ASSERT_EQ(3906U, millivolts);
+}
+
+TEST_F(AdcTestFixture, adc_offset_and_gain_calibration)
+{
+    adc_millivolts_t millivolts = 0;
+
+    ASSERT_EQ(adc_calibrate(), ADC_ERROR_NOT_INITIALISED);
+    config.alignment = ADC_RIGT_ALIGNED_RESULT;
+    ASSERT_EQ(adc_base_init(&config), ADC_ERROR_OK);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_ADC0), ADC_ERROR_OK);
+    ASSERT_EQ(adc_calibrate(), ADC_ERROR_CHANNEL_NOT_FOUND);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_GND), ADC_ERROR_OK);
+    ASSERT_EQ(adc_calibrate(), ADC_ERROR_CHANNEL_NOT_FOUND);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_1v1_REF), ADC_ERROR_OK);
+
+    /* No measurement yet */
+    ASSERT_EQ(adc_calibrate(), ADC_ERROR_CONFIG);
+
+    /* Ideal readings are 0 for GND and 225.28 for 1V1 against 5V : ADC reads 4 LSB too high and its gain is 4.5% too high */
+    ASSERT_EQ(ADC_STATE_READY, adc_start());
+    simulate_conversion(512U);
+    simulate_conversion(4U);
+    simulate_conversion(240U);
+    ASSERT_EQ(adc_read_millivolt(ADC_MUX_ADC0, &millivolts), ADC_ERROR_OK);
+    ASSERT_EQ(2500U, millivolts);
+
+    /* (512 - 4) * 1100 / (240 - 4) = 2367.8 mV */
+    ASSERT_EQ(adc_calibrate(), ADC_ERROR_OK);
+    ASSERT_EQ(adc_read_millivolt(ADC_MUX_ADC0, &millivolts), ADC_ERROR_OK);
+    ASSERT_EQ(2367U, millivolts);
+
+    /* Readings below the GND offset are clamped to 0 */
+    simulate_conversion(2U);
+    ASSERT_EQ(adc_read_millivolt(ADC_MUX_ADC0, &millivolts), ADC_ERROR_OK);
+    ASSERT_EQ(0U, millivolts);
+
+    /* Faulty bandgap measurement is rejected, previous corrections are kept */
+    simulate_conversion(4U);
+    simulate_conversion(3U);
+    simulate_conversion(512U);
+    ASSERT_EQ(adc_calibrate(), ADC_ERROR_CONFIG);
+    ASSERT_EQ(adc_read_millivolt(ADC_MUX_ADC0, &millivolts), ADC_ERROR_OK);
+    ASSERT_EQ(2367U, millivolts);
+
+    adc_reset_calibration();
+    ASSERT_EQ(adc_read_millivolt(ADC_MUX_ADC0, &millivolts), ADC_ERROR_OK);
+    ASSERT_EQ(2500U, millivolts);
+}
+TEST_F(AdcTestFixture, adc_millivolt_scale_matches_division)
+{
+    adc_millivolts_t millivolts = 0;
+    adc_channel_config_t channel_config = {.oversampling = 1U, .buffer = nullptr, .buffer_size = 0U, .quiet = false,
+                                           .filter_shift = 0U, .weight = 1U};
+
+    config.supply_voltage_mv = ADC_SUPPLY_VOLTAGE_MAX_MV + 1U;
+    ASSERT_EQ(adc_base_init(&config), ADC_ERROR_CONFIG);
+    ASSERT_EQ(adc_set_supply_voltage(5000U), ADC_ERROR_NOT_INITIALISED);
+
+    /* Every 10 and 11 bits result gives the exact same reading as the division, whatever the reference */
+    const adc_voltage_ref_t refs[3] = {ADC_VOLTAGE_REF_INTERNAL_1V1, ADC_VOLTAGE_REF_AVCC, ADC_VOLTAGE_REF_AREF_PIN};
+    const uint16_t supplies[3] = {1100U, 4890U, ADC_SUPPLY_VOLTAGE_MAX_MV};
+    config.alignment = ADC_RIGT_ALIGNED_RESULT;
+    for (uint8_t i = 0 ; i < 3U ; i++)
+    {
+        config.ref = refs[i];
+        config.supply_voltage_mv = supplies[i];
+        ASSERT_EQ(adc_base_init(&config), ADC_ERROR_OK);
+        ASSERT_EQ(adc_register_channel(ADC_MUX_ADC0), ADC_ERROR_OK);
+        ASSERT_EQ(adc_register_channel(ADC_MUX_ADC1), ADC_ERROR_OK);
+        ASSERT_EQ(adc_configure_channel(ADC_MUX_ADC1, &channel_config), ADC_ERROR_OK);
+        ASSERT_EQ(ADC_STATE_READY, adc_start());
+        for (uint16_t conversion = 0 ; conversion < 1024U ; conversion++)
+        {
+            /* ADC0 and ADC1 are scanned alternately : ADC1 accumulates 4 conversions into an odd 11 bits result */
+            const uint16_t next = (uint16_t)((conversion + 1U) % 1024U);
+            const uint16_t adc1_conversions[4] = {conversion, conversion, next, next};
+            for (uint8_t j = 0 ; j < 4U ; j++)
+            {
+                simulate_conversion(conversion);
+                simulate_conversion(adc1_conversions[j]);
+            }
+            adc_result_t result = 0;
+            ASSERT_EQ(adc_read_raw(ADC_MUX_ADC0, &result), ADC_ERROR_OK);
+            ASSERT_EQ(adc_read_millivolt(ADC_MUX_ADC0, &millivolts), ADC_ERROR_OK);
+            ASSERT_EQ(divide_to_millivolt(result, 0U, config.ref, config.supply_voltage_mv), millivolts);
+            ASSERT_EQ(adc_read_raw(ADC_MUX_ADC1, &result), ADC_ERROR_OK);
+            ASSERT_EQ(adc_read_millivolt(ADC_MUX_ADC1, &millivolts), ADC_ERROR_OK);
+            ASSERT_EQ(divide_to_millivolt(result, 1U, config.ref, config.supply_voltage_mv), millivolts);
+        }
+        adc_base_deinit();
+    }
+
+    /* Supply voltage updates are taken into account by the precomputed scale */
+    config.ref = ADC_VOLTAGE_REF_AVCC;
+    config.supply_voltage_mv = 5000U;
+    ASSERT_EQ(adc_base_init(&config), ADC_ERROR_OK);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_ADC0), ADC_ERROR_OK);
+    ASSERT_EQ(ADC_STATE_READY, adc_start());
+    simulate_conversion(1000U);
+    ASSERT_EQ(adc_read_millivolt(ADC_MUX_ADC0, &millivolts), ADC_ERROR_OK);
+    ASSERT_EQ(4882U, millivolts);
+    ASSERT_EQ(adc_set_supply_voltage(ADC_SUPPLY_VOLTAGE_MAX_MV + 1U), ADC_ERROR_CONFIG);
+    ASSERT_EQ(adc_set_supply_voltage(4500U), ADC_ERROR_OK);
+    ASSERT_EQ(adc_read_millivolt(ADC_MUX_ADC0, &millivolts), ADC_ERROR_OK);
+    ASSERT_EQ(4394U, millivolts);
+}
+
+TEST_F(AdcTestFixture, adc_supply_voltage_tracking)
+{
+    adc_millivolts_t millivolts = 0;
+    uint16_t supply_mv = 0;
+
+    ASSERT_EQ(adc_get_supply_voltage(&supply_mv), ADC_ERROR_NOT_INITIALISED);
+
+    /* Bandgap cannot measure itself */
+    config.alignment = ADC_RIGT_ALIGNED_RESULT;
+    config.ref = ADC_VOLTAGE_REF_INTERNAL_1V1;
+    config.track_supply = true;
+    ASSERT_EQ(adc_base_init(&config), ADC_ERROR_CONFIG);
+
+    /* 1V1 channel is registered first */
+    config.ref = ADC_VOLTAGE_REF_AVCC;
+    ASSERT_EQ(adc_base_init(&config), ADC_ERROR_OK);
+    ASSERT_EQ(adc_get_supply_voltage(nullptr), ADC_ERROR_NULL_POINTER);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_ADC0), ADC_ERROR_OK);
+    ASSERT_EQ(ADC_STATE_READY, adc_start());
+    ASSERT_EQ(ADC_MUX_1v1_REF, adc_register_stub.mux_reg & MUX_MSK);
+
+    /* Configured supply voltage is used until adc_process() handles the bandgap result */
+    simulate_conversion(240U);
+    simulate_conversion(512U);
+    ASSERT_EQ(adc_read_millivolt(ADC_MUX_ADC0, &millivolts), ADC_ERROR_OK);
+    ASSERT_EQ(2500U, millivolts);
+    ASSERT_EQ(adc_get_supply_voltage(&supply_mv), ADC_ERROR_OK);
+    ASSERT_EQ(5000U, supply_mv);
+
+    /* Rail drooped : 1100 * 1024 / 240 = 4693 mV */
+    ASSERT_EQ(ADC_STATE_READY, adc_process());
+    ASSERT_EQ(adc_get_supply_voltage(&supply_mv), ADC_ERROR_OK);
+    ASSERT_EQ(4693U, supply_mv);
+    ASSERT_EQ(adc_read_millivolt(ADC_MUX_ADC0, &millivolts), ADC_ERROR_OK);
+    ASSERT_EQ(2346U, millivolts);
+
+    /* Implausible bandgap results (11264 mV supply) are dropped */
+    simulate_conversion(100U);
+    ASSERT_EQ(ADC_STATE_READY, adc_process());
+    ASSERT_EQ(adc_get_supply_voltage(&supply_mv), ADC_ERROR_OK);
+    ASSERT_EQ(4693U, supply_mv);
+
+    /* Measured GND offset is removed from bandgap results : 1100 * 1024 / (229 - 4) = 5006 mV */
+    simulate_conversion(512U);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_GND), ADC_ERROR_OK);
+    simulate_conversion(229U);
+    simulate_conversion(512U);
+    simulate_conversion(4U);
+    ASSERT_EQ(adc_calibrate(), ADC_ERROR_OK);
+    simulate_conversion(229U);
+    ASSERT_EQ(ADC_STATE_READY, adc_process());
+    ASSERT_EQ(adc_get_supply_voltage(&supply_mv), ADC_ERROR_OK);
+    ASSERT_EQ(5006U, supply_mv);
+}
+TEST_F(AdcTestFixture, adc_round_snapshot)
+{
+    const adc_mux_t channels[2] = {ADC_MUX_ADC2, ADC_MUX_ADC0};
+    const adc_mux_t unknown_channels[2] = {ADC_MUX_ADC0, ADC_MUX_ADC3};
+    adc_result_t results[2] = {0};
+    adc_result_t result = 0;
+    uint8_t round = 0xFFU;
+
+    config.alignment = ADC_RIGT_ALIGNED_RESULT;
+    ASSERT_EQ(adc_base_init(&config), ADC_ERROR_OK);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_ADC0), ADC_ERROR_OK);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_ADC1), ADC_ERROR_OK);
+    ASSERT_EQ(adc_register_channel(ADC_MUX_ADC2), ADC_ERROR_OK);
+    ASSERT_EQ(adc_read_snapshot(nullptr, results, 2U, &round), ADC_ERROR_NULL_POINTER);
+    ASSERT_EQ(adc_read_snapshot(channels, nullptr, 2U, &round), ADC_ERROR_NULL_POINTER);
+    ASSERT_EQ(adc_read_snapshot(unknown_channels, results, 2U, &round), ADC_ERROR_CHANNEL_NOT_FOUND);
+
+    /* Nothing published before the first complete round */
+    ASSERT_EQ(adc_read_snapshot(channels, results, 2U, &round), ADC_ERROR_OK);
+    ASSERT_EQ(0U, round);
+    ASSERT_EQ(0U, results[0]);
+
+    ASSERT_EQ(ADC_STATE_READY, adc_start());
+    simulate_conversion(100U);
+    simulate_conversion(200U);
+    simulate_conversion(300U);
+    ASSERT_EQ(adc_read_snapshot(channels, results, 2U, &round), ADC_ERROR_OK);
+    ASSERT_EQ(1U, round);
+    ASSERT_EQ(300U, results[0]);
+    ASSERT_EQ(100U, results[1]);
+
+    /* Half converted round : raw results move on, snapshot sticks to the last complete round */
+    simulate_conversion(110U);
+    simulate_conversion(210U);
+    ASSERT_EQ(adc_read_raw(ADC_MUX_ADC0, &result), ADC_ERROR_OK);
+    ASSERT_EQ(110U, result);
+    ASSERT_EQ(adc_read_snapshot(channels, results, 2U, nullptr), ADC_ERROR_OK);
+    ASSERT_EQ(300U, results[0]);
+    ASSERT_EQ(100U, results[1]);
+
+    simulate_conversion(310U);
+    ASSERT_EQ(adc_read_snapshot(channels, results, 2U, &round), ADC_ERROR_OK);
+    ASSERT_EQ(2U, round);
+    ASSERT_EQ(310U, results[0]);
+    ASSERT_EQ(110U, results[1]);
+
+    /* With weights, a round spans the whole schedule : ADC0 is converted twice per round */
+    adc_channel_config_t channel_config = {.oversampling = 0U, .buffer = nullptr, .buffer_size = 0U, .quiet = false,
+                                           .filter_shift = 0U, .weight = 2U};
+    ASSERT_EQ(adc_configure_channel(ADC_MUX_ADC0, &channel_config), ADC_ERROR_OK);
+    for (uint16_t i = 0 ; i < 3U ; i++)
+    {
+        simulate_conversion(400U + i);
+    }
+    ASSERT_EQ(adc_read_snapshot(channels, results, 2U, &round), ADC_ERROR_OK);
+    ASSERT_EQ(2U, round);
+    simulate_conversion(403U);
+    ASSERT_EQ(adc_read_snapshot(channels, results, 2U, &round), ADC_ERROR_OK);
+    ASSERT_EQ(3U, round);
+    ASSERT_EQ(402U, results[0]);
+    ASSERT_EQ(403U, results[1]);
+}
 
 int main(int argc, char **argv)
 {
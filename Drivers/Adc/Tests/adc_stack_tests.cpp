@@ -103,6 +103,39 @@ TEST(adc_stack_tests, remove_channels_in_the_middle)
     ASSERT_EQ(registered_channels.channels_pair[ADC_MUX_COUNT - 1].channel, ADC_MUX_GND);
 }
 
+TEST(adc_stack_tests, find_channels_after_removal)
+{
+    volatile adc_stack_t registered_channels;
+    ASSERT_EQ(adc_stack_reset(&registered_channels), ADC_STACK_ERROR_OK);
+    const adc_mux_t scan[5] = {ADC_MUX_ADC3, ADC_MUX_ADC1, ADC_MUX_ADC3, ADC_MUX_GND, ADC_MUX_ADC7};
+    for (uint8_t i = 0 ; i < 5U ; i++)
+    {
+        ASSERT_EQ(adc_stack_register_channel(&registered_channels, scan[i]), ADC_STACK_ERROR_OK);
+    }
+
+    /* First instance of a duplicated channel is found */
+    volatile adc_channel_pair_t * pair = NULL;
+    ASSERT_EQ(adc_stack_find_channel(&registered_channels, ADC_MUX_ADC3, &pair), ADC_STACK_ERROR_OK);
+    ASSERT_EQ(pair, &registered_channels.channels_pair[0]);
+    ASSERT_EQ(adc_stack_find_channel(&registered_channels, ADC_MUX_ADC5, &pair), ADC_STACK_ERROR_ELEMENT_NOT_FOUND);
+    ASSERT_TRUE(NULL == pair);
+
+    /* Removing it promotes the second instance, other channels are still found where they moved */
+    ASSERT_EQ(adc_stack_unregister_channel(&registered_channels, ADC_MUX_ADC3), ADC_STACK_ERROR_OK);
+    ASSERT_EQ(adc_stack_find_channel(&registered_channels, ADC_MUX_ADC3, &pair), ADC_STACK_ERROR_OK);
+    ASSERT_EQ(pair, &registered_channels.channels_pair[1]);
+    ASSERT_EQ(adc_stack_find_channel(&registered_channels, ADC_MUX_ADC1, &pair), ADC_STACK_ERROR_OK);
+    ASSERT_EQ(pair, &registered_channels.channels_pair[0]);
+    ASSERT_EQ(adc_stack_find_channel(&registered_channels, ADC_MUX_ADC7, &pair), ADC_STACK_ERROR_OK);
+    ASSERT_EQ(pair, &registered_channels.channels_pair[3]);
+
+    ASSERT_EQ(adc_stack_unregister_channel(&registered_channels, ADC_MUX_ADC3), ADC_STACK_ERROR_OK);
+    ASSERT_EQ(adc_stack_find_channel(&registered_channels, ADC_MUX_ADC3, &pair), ADC_STACK_ERROR_ELEMENT_NOT_FOUND);
+    ASSERT_EQ(adc_stack_unregister_channel(&registered_channels, ADC_MUX_ADC3), ADC_STACK_ERROR_ELEMENT_NOT_FOUND);
+    ASSERT_EQ(adc_stack_find_channel(&registered_channels, ADC_MUX_GND, &pair), ADC_STACK_ERROR_OK);
+    ASSERT_EQ(pair, &registered_channels.channels_pair[1]);
+}
+
 TEST(adc_stack_tests, adc_stack_guard_null)
 {
     volatile adc_stack_t * registered_channels = NULL;
@@ -191,6 +224,53 @@ TEST(adc_stack_tests, get_current)
     }
 }
 
+TEST(adc_stack_tests, weighted_schedule)
+{
+    volatile adc_stack_t registered_channels;
+    ASSERT_EQ(adc_stack_reset(&registered_channels), ADC_STACK_ERROR_OK);
+    ASSERT_EQ(adc_stack_set_weight(NULL, ADC_MUX_ADC0, 1U), ADC_STACK_ERROR_NULL_POINTER);
+    ASSERT_EQ(adc_stack_set_weight(&registered_channels, ADC_MUX_ADC0, 1U), ADC_STACK_ERROR_ELEMENT_NOT_FOUND);
+
+    // Output current, output voltage, then heatsink temperature
+    ASSERT_EQ(adc_stack_register_channel(&registered_channels, ADC_MUX_ADC0), ADC_STACK_ERROR_OK);
+    ASSERT_EQ(adc_stack_register_channel(&registered_channels, ADC_MUX_ADC1), ADC_STACK_ERROR_OK);
+    ASSERT_EQ(adc_stack_register_channel(&registered_channels, ADC_MUX_ADC2), ADC_STACK_ERROR_OK);
+    ASSERT_EQ(adc_stack_set_weight(&registered_channels, ADC_MUX_ADC0, 0U), ADC_STACK_ERROR_INVALID_VALUE);
+    ASSERT_EQ(adc_stack_set_weight(&registered_channels, ADC_MUX_ADC0, 3U), ADC_STACK_ERROR_OK);
+    ASSERT_EQ(adc_stack_set_weight(&registered_channels, ADC_MUX_ADC1, 2U), ADC_STACK_ERROR_OK);
+    ASSERT_EQ(registered_channels.schedule_length, 6U);
+
+    // Heavier channels are spread over the round instead of being scanned in bursts
+    const adc_mux_t expected[6U] = {ADC_MUX_ADC1, ADC_MUX_ADC0, ADC_MUX_ADC2, ADC_MUX_ADC1, ADC_MUX_ADC0, ADC_MUX_ADC0};
+    volatile adc_channel_pair_t * pair = NULL;
+    for (uint8_t round = 0 ; round < 3U ; round++)
+    {
+        for (uint8_t i = 0 ; i < 6U ; i++)
+        {
+            ASSERT_EQ(adc_stack_get_next(&registered_channels, &pair), ADC_STACK_ERROR_OK);
+            EXPECT_EQ(pair->channel, expected[i]);
+        }
+    }
+
+    // Schedule cannot hold more than ADC_STACK_SCHEDULE_SIZE steps, previous weight is kept
+    ASSERT_EQ(adc_stack_set_weight(&registered_channels, ADC_MUX_ADC2, ADC_STACK_SCHEDULE_SIZE), ADC_STACK_ERROR_FULL);
+    ASSERT_EQ(registered_channels.channels_pair[2].weight, 1U);
+
+    // Weights follow their pair when slots move down, current pair is kept
+    ASSERT_EQ(adc_stack_get_next(&registered_channels, &pair), ADC_STACK_ERROR_OK);
+    ASSERT_EQ(pair->channel, ADC_MUX_ADC1);
+    ASSERT_EQ(adc_stack_unregister_channel(&registered_channels, ADC_MUX_ADC0), ADC_STACK_ERROR_OK);
+    ASSERT_EQ(adc_stack_get_current(&registered_channels, &pair), ADC_STACK_ERROR_OK);
+    ASSERT_EQ(pair->channel, ADC_MUX_ADC1);
+    ASSERT_EQ(registered_channels.schedule_length, 3U);
+    ASSERT_EQ(adc_stack_get_next(&registered_channels, &pair), ADC_STACK_ERROR_OK);
+    EXPECT_EQ(pair->channel, ADC_MUX_ADC2);
+    ASSERT_EQ(adc_stack_get_next(&registered_channels, &pair), ADC_STACK_ERROR_OK);
+    EXPECT_EQ(pair->channel, ADC_MUX_ADC1);
+    ASSERT_EQ(adc_stack_get_next(&registered_channels, &pair), ADC_STACK_ERROR_OK);
+    EXPECT_EQ(pair->channel, ADC_MUX_ADC1);
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
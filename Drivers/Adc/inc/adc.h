@@ -105,6 +105,39 @@ typedef struct {
     } readings;
 } adc_handle_t;
 
+/* Oversampling order limit : 4^4 = 256 conversions per result, giving 14 bits results */
+#define ADC_OVERSAMPLING_MAX    4U
+
+/* Supply voltage limit, keeps the precomputed millivolts conversion scale within 16 bits */
+#define ADC_SUPPLY_VOLTAGE_MAX_MV   8000U
+
+/* Filter coefficient limit : 1/256, filter state of a 14 bits result then fits in 22 bits */
+#define ADC_FILTER_SHIFT_MAX    8U
+
+/**
+ * @brief optional per channel processing, applied to conversions as they are fetched (ISR or adc_process())
+*/
+typedef struct
+{
+    uint8_t         oversampling;   /**< Oversampling order n (0 to ADC_OVERSAMPLING_MAX) : 4^n conversions are accumulated
+                                         then decimated into one (10 + n) bits result. 0 disables oversampling        */
+    adc_result_t *  buffer;         /**< Optional ring buffer receiving each published result, oldest ones are
+                                         overwritten when it is full. NULL to only keep the last result               */
+    uint8_t         buffer_size;    /**< Ring buffer capacity, in results                                             */
+    bool            quiet;          /**< Conversions of this channel are performed in ADC noise reduction sleep mode :
+                                         they are started by adc_process(), which puts the CPU to sleep until the ADC
+                                         interrupt wakes it up. Requires interrupt mode and single shot conversions.
+                                         Sleeping halts clkI/O : Timer 0, Timer 1 and a synchronously clocked Timer 2
+                                         stop counting during each quiet conversion, so timebases, software PWM edges
+                                         and synchronised timers drift or freeze meanwhile                            */
+    uint8_t         filter_shift;   /**< Optional first order low pass filter (exponential moving average) applied to
+                                         each published result : filtered += (result - filtered) / 2^filter_shift.
+                                         Time constant is about 2^filter_shift results. 0 disables the filter         */
+    uint8_t         weight;         /**< Conversions of this channel per scan schedule round, spread evenly among the
+                                         other channels ones (fast channels get most of the ADC bandwidth). 0 is
+                                         handled as 1, the default round robin weight                                  */
+} adc_channel_config_t;
+
 /* Configuration structure of ADC module */
 typedef struct {
     uint16_t                    supply_voltage_mv;  /**< MCU supply voltage in millivolts                       */
@@ -116,6 +149,9 @@ typedef struct {
     adc_handle_t                handle;             /**< Packs pointers to base ADC registers. Particularly
                                                          useful when performing Dependency Injection & testing  */
     bool using_interrupt;                           /**< uses interrupts for data fetch process or not          */
+    bool track_supply;                              /**< AVCC or AREF reference only : measures the 1V1 bandgap
+                                                         against it to keep supply_voltage_mv up to date. 1V1
+                                                         channel is registered by adc_base_init()               */
 } adc_config_hal_t;
 
 
@@ -175,10 +211,39 @@ adc_error_t adc_handle_reset(adc_handle_t * const handle);
    ############################################################################################ */
 
 /**
- * @brief adc module initialisation function
+ * @brief adc module initialisation function. Millivolts conversion scale is precomputed here from the voltage reference
+ * and the supply voltage. When supply tracking is enabled, the 1V1 bandgap channel is registered first and scanned like
+ * any other channel (its scan weight sets the tracking rate) : each of its results updates the supply voltage and the
+ * conversion scale from adc_process(), which shall then be called periodically even in interrupt mode.
+ * Configured supply voltage is used until the first bandgap result.
+ * @return
+ *      ADC_ERROR_OK                : operation succeeded
+ *      ADC_ERROR_NULL_POINTER      : config points to NULL
+ *      ADC_ERROR_CONFIG            : supply voltage exceeds ADC_SUPPLY_VOLTAGE_MAX_MV, or supply tracking is requested
+ *                                    with the internal 1V1 reference
 */
 adc_error_t adc_base_init(adc_config_hal_t * const config);
 
+/**
+ * @brief updates the supply voltage used as AVCC or AREF reference, and the precomputed millivolts conversion scale
+ * @param[in]   supply_voltage_mv : new supply voltage, in millivolts
+ * @return
+ *      ADC_ERROR_OK                : operation succeeded
+ *      ADC_ERROR_NOT_INITIALISED   : adc_base_init() was not called
+ *      ADC_ERROR_CONFIG            : supply voltage exceeds ADC_SUPPLY_VOLTAGE_MAX_MV
+*/
+adc_error_t adc_set_supply_voltage(const uint16_t supply_voltage_mv);
+
+/**
+ * @brief supply voltage getter, either the configured one or the last one measured by supply tracking
+ * @param[out]  supply_voltage_mv : supply voltage, in millivolts
+ * @return
+ *      ADC_ERROR_OK                : operation succeeded
+ *      ADC_ERROR_NULL_POINTER      : supply_voltage_mv points to NULL
+ *      ADC_ERROR_NOT_INITIALISED   : adc_base_init() was not called
+*/
+adc_error_t adc_get_supply_voltage(uint16_t * const supply_voltage_mv);
+
 /**
  * @brief module deinitialisation
 */
@@ -210,7 +275,15 @@ adc_state_t adc_start(void);
 adc_state_t adc_stop(void);
 
 /**
- * @brief starts conversions and retrieves results (using asynchronous, non interrupting mode)
+ * @brief starts conversions and retrieves results (using asynchronous, non interrupting mode).
+ * In interrupt mode, results are only fetched by the ISR and this function only handles deferred work (quiet
+ * conversions and supply tracking).
+ * When the next channel to be converted is a quiet one, its conversion is not started by the ISR but by this function :
+ * CPU enters ADC noise reduction sleep mode, which starts the conversion without digital noise, and is woken up by the
+ * ADC interrupt. Application shall then call it from its main loop with global interrupts enabled, at a moment where
+ * sleeping for a conversion time is acceptable, keeping in mind that synchronously clocked timers (Timer 0, Timer 1
+ * and Timer 2 unless clocked asynchronously) are stopped meanwhile. Caller's global interrupt state is restored.
+ * Supply voltage tracking also derives the supply voltage from new bandgap results here, out of the ISR.
  * @return
  *      PERIPHERAL_ERROR_OK      : operation was successful
  *      ADC_ERROR_CONFIG  : adc peripheral is not enabled (not initialised ?)
@@ -232,10 +305,40 @@ adc_error_t adc_register_channel(const adc_mux_t channel);
  * @param[in]   channel : channel to be removed */
 adc_error_t adc_unregister_channel(const adc_mux_t channel);
 
+/**
+ * @brief configures oversampling, result buffering and scan weight of a registered channel. Pending accumulation and
+ * buffered results of this channel are discarded.
+ * Oversampling requires right aligned results (ADC_RIGT_ALIGNED_RESULT).
+ * @param[in]   channel : targeted channel, shall be registered first
+ * @param[in]   config  : channel configuration. Ring buffer memory is provided by the caller and shall outlive the channel
+ * @return
+ *      ADC_ERROR_OK                : operation succeeded
+ *      ADC_ERROR_NULL_POINTER      : config points to NULL
+ *      ADC_ERROR_CHANNEL_NOT_FOUND : channel is not registered
+ *      ADC_ERROR_CONFIG            : oversampling order or filter shift is too high, oversampling is used with left aligned
+ *                                    results, buffer has no capacity, quiet conversions are requested without interrupt
+ *                                    mode or with auto triggering, or the scan schedule cannot hold the requested weight
+*/
+adc_error_t adc_configure_channel(const adc_mux_t channel, adc_channel_config_t const * const config);
+
+/**
+ * @brief pops results from a channel's ring buffer, oldest first
+ * @param[in]   channel     : targeted channel
+ * @param[out]  samples     : array receiving the results
+ * @param[in]   max_count   : capacity of samples array
+ * @param[out]  count       : number of results written to samples array
+ * @return
+ *      ADC_ERROR_OK                : operation succeeded (count might be 0 if no new result was published)
+ *      ADC_ERROR_NULL_POINTER      : samples or count points to NULL
+ *      ADC_ERROR_CHANNEL_NOT_FOUND : channel is not registered
+ *      ADC_ERROR_CONFIG            : this channel does not use a ring buffer
+*/
+adc_error_t adc_read_samples(const adc_mux_t channel, adc_result_t * const samples, const uint8_t max_count, uint8_t * const count);
+
 /**
  * @brief adc result getter function
  * @param[in]   channel  : targeted device index
- * @param[out]  result   : last fetched result from this device
+ * @param[out]  result   : last fetched result from this device, (10 + n) bits wide when oversampling order n is used
  * @return
  *      PERIPHERAL_ERROR_OK             : everything's fine
  *      PERIPHERAL_ERROR_NULL_POINTER   : wrong pointer or out of bounds index
@@ -252,6 +355,72 @@ adc_error_t adc_read_raw(const adc_mux_t channel, adc_result_t * const result);
 */
 adc_error_t adc_read_millivolt(const adc_mux_t channel, adc_millivolts_t * const reading);
 
+/**
+ * @brief copies results of several channels, all coming from the same complete scan round (for instance voltage and
+ * current to compute a power). Results are published by the ISR under a sequence lock : interrupts are never disabled,
+ * the copy is retried when a round completes meanwhile.
+ * A channel using oversampling order n only produces a new result every 4^n conversions : within a snapshot, its
+ * result is the last decimated one and may span up to 4^n rounds (fewer when its scan weight is above 1), while
+ * channels without oversampling hold the conversion of the last round. Use the same oversampling order and weight for
+ * channels whose results shall be combined.
+ * @param[in]   channels : channels to be read, shall be registered
+ * @param[out]  results  : array receiving one result per channel, in the same order. Results are 0 until the first
+ *                         complete scan round
+ * @param[in]   count    : number of channels to be read
+ * @param[out]  round    : optional (may be NULL), counter of complete scan rounds, modulo 128. Two snapshots with the
+ *                         same round value hold the same results
+ * @return
+ *      ADC_ERROR_OK                : operation succeeded
+ *      ADC_ERROR_NULL_POINTER      : channels or results points to NULL
+ *      ADC_ERROR_CHANNEL_NOT_FOUND : one of the channels is not registered, results are left untouched
+*/
+adc_error_t adc_read_snapshot(const adc_mux_t * const channels, adc_result_t * const results, const uint8_t count, uint8_t * const round);
+
+/**
+ * @brief filtered result getter, only available for channels configured with a filter
+ * @param[in]   channel  : targeted channel
+ * @param[out]  result   : output of the channel filter, same width as raw results
+ * @return
+ *      ADC_ERROR_OK                : operation succeeded
+ *      ADC_ERROR_NULL_POINTER      : result points to NULL
+ *      ADC_ERROR_CHANNEL_NOT_FOUND : channel is not registered
+ *      ADC_ERROR_CONFIG            : this channel does not use a filter
+*/
+adc_error_t adc_read_filtered(const adc_mux_t channel, adc_result_t * const result);
+
+/**
+ * @brief filtered reading getter, converted to millivolts
+ * @param[in]   channel  : targeted channel
+ * @param[out]  reading  : output of the channel filter, in millivolts
+ * @return
+ *      ADC_ERROR_OK                : operation succeeded
+ *      ADC_ERROR_NULL_POINTER      : reading points to NULL
+ *      ADC_ERROR_CHANNEL_NOT_FOUND : channel is not registered
+ *      ADC_ERROR_CONFIG            : this channel does not use a filter or voltage reference is unknown
+*/
+adc_error_t adc_read_filtered_millivolt(const adc_mux_t channel, adc_millivolts_t * const reading);
+
+/**
+ * @brief derives offset and gain corrections from the last results of the internal GND and 1V1 bandgap channels, which
+ * shall be registered (a low scan weight is enough). Call it periodically to follow temperature and supply drifts.
+ * Offset maps GND to 0, gain maps the GND to 1V1 span onto its ideal value for the configured reference. Corrections
+ * are folded into the precomputed millivolts conversion scale, raw results are untouched.
+ * Gain is left to unity with the internal 1V1 reference, which cannot measure itself, and with supply tracking, which
+ * already scales readings on the bandgap : only the offset is corrected then.
+ * @return
+ *      ADC_ERROR_OK                : operation succeeded
+ *      ADC_ERROR_NOT_INITIALISED   : adc_base_init() was not called
+ *      ADC_ERROR_CHANNEL_NOT_FOUND : GND or 1V1 channel is not registered
+ *      ADC_ERROR_CONFIG            : supply voltage is below 1V1, or measurements give a gain correction beyond a
+ *                                    factor of 2 (no result yet, wrong supply voltage...). Previous corrections are kept
+*/
+adc_error_t adc_calibrate(void);
+
+/**
+ * @brief drops corrections computed by adc_calibrate(), millivolts readings use the ideal conversion again
+*/
+void adc_reset_calibration(void);
+
 
 #ifdef __cplusplus
 }
@@ -76,7 +76,7 @@ extern "C"
 #define ADEN_MSK    (1 << ADEN)
 
 /* ADCSRB register masks */
-#define ADTS_MSK 0x03
+#define ADTS_MSK 0x07
 #define ACME_MSK (1 << ACME)
 
 /* ADMUX regsister masks */
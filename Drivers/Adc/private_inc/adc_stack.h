@@ -55,6 +55,7 @@ typedef enum
     ADC_STACK_ERROR_EMPTY,              /**< Given stack is empty                   */
     ADC_STACK_ERROR_NULL_POINTER,       /**< Given pointer not initialised          */
     ADC_STACK_ERROR_ELEMENT_NOT_FOUND,  /**< Targeted element not found in stack    */
+    ADC_STACK_ERROR_INVALID_VALUE,      /**< Given value is out of its allowed range */
 } adc_stack_error_t;
 
 /**
@@ -62,10 +63,29 @@ typedef enum
 */
 typedef struct
 {
-    adc_mux_t    channel;   /**< Adc configured channel (uses a ADC_MUX type)                     */
-    adc_result_t result;    /**< Adc result type, last value read by ADC                          */
+    adc_mux_t    channel;       /**< Adc configured channel (uses a ADC_MUX type)                         */
+    adc_result_t result;        /**< Adc result type, last value read by ADC (decimated when oversampled) */
+    uint8_t      oversampling;  /**< Oversampling order n : 4^n conversions are needed per result         */
+    uint16_t     samples;       /**< Conversions accumulated so far for the next result                   */
+    uint32_t     accumulator;   /**< Sum of the accumulated conversions                                   */
+    adc_result_t * buffer;      /**< Optional ring buffer of published results (NULL when unused)         */
+    uint8_t      buffer_size;   /**< Ring buffer capacity                                                 */
+    uint8_t      head;          /**< Next write position in the ring buffer                               */
+    uint8_t      count;         /**< Results available in the ring buffer                                 */
+    bool         quiet;         /**< Conversions are performed in ADC noise reduction sleep mode          */
+    uint8_t      filter_shift;  /**< Exponential moving average coefficient is 1 / 2^filter_shift         */
+    uint32_t     filter_state;  /**< Filtered result, scaled up by 2^filter_shift to keep fractional bits */
+    bool         filter_seeded; /**< Filter state was initialised with a first result                     */
+    uint8_t      weight;        /**< Number of times this pair is converted per scan schedule round        */
 } adc_channel_pair_t;
 
+/* Mux values span from 0 to ADC_MUX_GND, some of them being reserved */
+#define ADC_STACK_LOOKUP_SIZE   (ADC_MUX_GND + 1U)
+#define ADC_STACK_NO_SLOT       (0xFFU)
+
+/* Scan schedule capacity : sum of all registered pairs weights cannot exceed it */
+#define ADC_STACK_SCHEDULE_SIZE (32U)
+
 /**
  * @brief Packs all registered channels alongside their values in one place
  * This structure helps manipulate adc results and provide a standardised access
@@ -74,8 +94,14 @@ typedef struct
 typedef struct
 {
     uint8_t   count;
-    uint8_t   index;
-    adc_channel_pair_t channels_pair[ADC_MUX_COUNT];
+    uint8_t   index;                                    /**< Slot of the pair currently scanned                             */
+    adc_channel_pair_t channels_pair[ADC_MUX_COUNT];    /**< Registered channels, in registration order                     */
+    uint8_t   lookup[ADC_STACK_LOOKUP_SIZE];            /**< Gives the slot of the first instance of each mux value
+                                                             in channels_pair, or ADC_STACK_NO_SLOT if not registered   */
+    uint8_t   schedule[ADC_STACK_SCHEDULE_SIZE];        /**< Precomputed scan sequence : slots of channels_pair, each one
+                                                             appearing as many times as its weight                      */
+    uint8_t   schedule_length;                          /**< Steps in one schedule round (sum of all weights)               */
+    uint8_t   schedule_step;                            /**< Position of the currently scanned pair in the schedule         */
 } adc_stack_t;
 
 
@@ -115,6 +141,8 @@ adc_stack_error_t adc_stack_reset(volatile adc_stack_t * const stack);
  *      ADC_STACK_ERROR_OK      :   action performed ok
  *      ADC_STACK_ERROR_FULL    :   stack is full, could not add one more channel pair
  *                                  (there might be several instances of the same channel inside)
+ *                                  or scan schedule has no room left for it
+ *      ADC_STACK_ERROR_ELEMENT_NOT_FOUND : mux value is out of the multiplexer range
 */
 adc_stack_error_t adc_stack_register_channel(volatile adc_stack_t * const stack, volatile const adc_mux_t mux);
 
@@ -140,6 +168,23 @@ adc_stack_error_t adc_stack_unregister_channel(volatile adc_stack_t * const stac
 */
 adc_stack_error_t adc_stack_find_channel(volatile adc_stack_t * const stack, volatile const adc_mux_t channel, volatile adc_channel_pair_t ** pair);
 
+/**
+ * @brief sets how many times the first instance of a channel is converted per scan schedule round, then rebuilds the schedule.
+ * Occurrences of heavier channels are spread evenly over the round (smooth weighted round robin) : weights 3, 2 and 1 give
+ * the c0 c1 c0 c2 c1 c0 sequence. All weights default to 1, which gives a plain round robin in registration order.
+ * Schedule is computed here so that adc_stack_get_next() remains a constant time lookup.
+ * @param[in] stack  :   adc stack object
+ * @param[in] mux    :   adc multiplexing value
+ * @param[in] weight :   conversions per schedule round, at least 1
+ * @return
+ *      ADC_STACK_ERROR_OK              :   action performed ok
+ *      ADC_STACK_ERROR_NULL_POINTER    :   given stack is NULL
+ *      ADC_STACK_ERROR_INVALID_VALUE   :   weight is 0
+ *      ADC_STACK_ERROR_FULL            :   sum of weights would exceed ADC_STACK_SCHEDULE_SIZE, weight is unchanged
+ *      ADC_STACK_ERROR_ELEMENT_NOT_FOUND : channel is not registered
+*/
+adc_stack_error_t adc_stack_set_weight(volatile adc_stack_t * const stack, volatile const adc_mux_t mux, const uint8_t weight);
+
 /**
  * @brief returns next channel to be scanned (mainly called either by ISR or asynchronous code)
  * @param[in] stack :   adc stack object
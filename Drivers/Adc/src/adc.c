@@ -31,27 +31,103 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "adc.h"
 #include "adc_reg.h"
 #include "adc_stack.h"
+#include "critical_section.h"
 
 #include <string.h>
 #include <stdbool.h>
 
-/* 10 bits adc, full range */
-#define ADC_MAX_VALUE       1024U
+#ifndef UNIT_TESTING
+    #include <avr/io.h>
+    #include <avr/interrupt.h>
+    #include <avr/sleep.h>
+#endif
+
 #define ADC_1V1_MILLIVOLT   1100U
 
+/* Calibration gain is a Q14 fixed point factor, folded into the millivolts scale */
+#define ADC_CALIBRATION_SHIFT   14U
+#define ADC_CALIBRATION_UNITY   (1UL << ADC_CALIBRATION_SHIFT)
+
+/* Millivolts scale is a Q12 fixed point factor : a reference of ADC_SUPPLY_VOLTAGE_MAX_MV with a gain correction up
+   to 2 still fits in 16 bits, and unity gain gives an exact 4 * reference_mv scale */
+#define ADC_SCALE_SHIFT         12U
 
 /* Holds the current configuration of the ADC module */
 static struct
 {
     adc_config_hal_t base_config;
     bool is_initialised;
+    volatile bool quiet_pending;    /**< Current channel is a quiet one and waits for adc_process() to be converted */
+    volatile bool supply_pending;   /**< A new bandgap result waits for adc_process() to update the supply voltage  */
+    struct
+    {
+        uint16_t gain;              /**< Q14 gain correction factor                                                 */
+        uint16_t offset;            /**< Measured GND result, (10 + ADC_OVERSAMPLING_MAX) bits wide                 */
+    } calibration;                  /**< Corrections computed by adc_calibrate()                                    */
+    struct
+    {
+        uint16_t scale;             /**< Millivolts per LSB of a 10 bits result, gain correction included, in
+                                         Q(ADC_SCALE_SHIFT) fixed point                                             */
+        uint32_t offset;            /**< Offset correction, already multiplied by scale, for (10 + ADC_OVERSAMPLING_MAX)
+                                         bits wide results                                                          */
+        bool valid;                 /**< Voltage reference is known, scale can be used                              */
+    } conversion;                   /**< Cached whenever reference, supply voltage or calibration change so that
+                                         millivolts conversions need no division                                    */
 } internal_configuration = {.base_config = {0},
-                            .is_initialised = false};
+                            .is_initialised = false,
+                            .quiet_pending = false,
+                            .supply_pending = false,
+                            .calibration = {.gain = ADC_CALIBRATION_UNITY, .offset = 0},
+                            .conversion = {.scale = 0, .offset = 0, .valid = false}};
 
 static volatile adc_stack_t registered_channels;
 
+/* Results of the last complete scan round, published by the ISR under a sequence lock : sequence is odd while results
+   are written, and a reader retries whenever it changed during its copy. It is 8 bits wide so that reading it is atomic */
+static volatile struct
+{
+    uint8_t sequence;
+    adc_result_t results[ADC_STACK_LOOKUP_SIZE];    /**< Indexed by mux value */
+} round_snapshot;
+
+static inline void reset_round_snapshot(void)
+{
+    round_snapshot.sequence = 0;
+    for (uint8_t i = 0 ; i < ADC_STACK_LOOKUP_SIZE ; i++)
+    {
+        round_snapshot.results[i] = 0;
+    }
+}
+
+/**
+ * @brief folds voltage reference and calibration gain into a single fixed point scale, so that millivolts conversions
+ * become one 16 x 16 -> 32 bits multiplication and a shift. Shall be called whenever one of them changes
+*/
+static void update_conversion_scale(void)
+{
+    uint16_t reference_mv = 0;
+    switch (internal_configuration.base_config.ref)
+    {
+        case ADC_VOLTAGE_REF_INTERNAL_1V1:
+            reference_mv = ADC_1V1_MILLIVOLT;
+            break;
+        case ADC_VOLTAGE_REF_AREF_PIN:
+        case ADC_VOLTAGE_REF_AVCC:
+            reference_mv = internal_configuration.base_config.supply_voltage_mv;
+            break;
+        default:
+            break;
+    }
+
+    const uint32_t scale = ((uint32_t) internal_configuration.calibration.gain * reference_mv)
+                         >> (ADC_CALIBRATION_SHIFT + 10U - ADC_SCALE_SHIFT);
+    internal_configuration.conversion.scale = (uint16_t) scale;
+    internal_configuration.conversion.offset = (uint32_t) internal_configuration.calibration.offset * (uint16_t) scale;
+    internal_configuration.conversion.valid = (0U != reference_mv);
+}
+
 static inline uint16_t retrieve_result_from_registers(void);
-static inline void isr_helper_extract_data_from_adc_regs(void);
+static inline bool isr_helper_extract_data_from_adc_regs(void);
 
 static inline uint16_t retrieve_result_from_registers(void)
 {
@@ -119,6 +195,7 @@ adc_error_t adc_config_hal_get_default(adc_config_hal_t * config)
         config->trigger_sources = ADC_TRIGGER_FREE_RUNNING;
         config->running_mode = ADC_RUNNING_MODE_SINGLE_SHOT;
         config->using_interrupt = false;
+        config->track_supply = false;
     }
     return ret;
 }
@@ -163,16 +240,26 @@ adc_error_t adc_base_init(adc_config_hal_t * const config)
     {
         ret = ADC_ERROR_NULL_POINTER;
     }
+    else if ((config->supply_voltage_mv > ADC_SUPPLY_VOLTAGE_MAX_MV)
+         || (config->track_supply && (ADC_VOLTAGE_REF_INTERNAL_1V1 == config->ref)))
+    {
+        ret = ADC_ERROR_CONFIG;
+    }
     else
     {
         adc_stack_reset(&registered_channels);
+        reset_round_snapshot();
+        if (config->track_supply)
+        {
+            adc_stack_register_channel(&registered_channels, ADC_MUX_1v1_REF);
+        }
         /* First, copy configuration data to the internal cache */
         adc_config_hal_copy(&(internal_configuration.base_config), config);
         adc_handle_t * handle = &internal_configuration.base_config.handle;
         *handle->mux_reg = (*handle->mux_reg & ~REF_MSK) | (config->ref << REFS0);            /* set reference voltage */
         *handle->mux_reg = (*handle->mux_reg & ~ADLAR_MSK) | (config->alignment << ADLAR);    /* set result adjustment */
         *handle->adcsra_reg = (*handle->adcsra_reg & ~ADPS_MSK) | (config->prescaler);        /* set precaler */
-        *handle->adcsrb_reg |= config->trigger_sources;
+        *handle->adcsrb_reg = (*handle->adcsrb_reg & ~ADTS_MSK) | (config->trigger_sources << ADTS0);    /* set trigger source */
         if (internal_configuration.base_config.using_interrupt)
         {
             *handle->adcsra_reg |= (1 << ADIE);
@@ -186,6 +273,11 @@ adc_error_t adc_base_init(adc_config_hal_t * const config)
             *handle->adcsra_reg |= 1 << ADATE;
         }
 
+        internal_configuration.quiet_pending = false;
+        internal_configuration.supply_pending = false;
+        internal_configuration.calibration.gain = ADC_CALIBRATION_UNITY;
+        internal_configuration.calibration.offset = 0;
+        update_conversion_scale();
         internal_configuration.is_initialised = true;
     }
     return ret;
@@ -195,6 +287,7 @@ void adc_base_deinit(void)
 {
     internal_configuration.is_initialised = false;
     adc_stack_reset(&registered_channels);
+    reset_round_snapshot();
     {
         adc_handle_t * handle = &internal_configuration.base_config.handle;
         if (handle->mux_reg != NULL)
@@ -208,6 +301,38 @@ void adc_base_deinit(void)
         }
     }
     adc_config_hal_reset(&internal_configuration.base_config);
+    internal_configuration.calibration.gain = ADC_CALIBRATION_UNITY;
+    internal_configuration.calibration.offset = 0;
+    internal_configuration.conversion.valid = false;
+}
+
+adc_error_t adc_set_supply_voltage(const uint16_t supply_voltage_mv)
+{
+    if (false == internal_configuration.is_initialised)
+    {
+        return ADC_ERROR_NOT_INITIALISED;
+    }
+    if (supply_voltage_mv > ADC_SUPPLY_VOLTAGE_MAX_MV)
+    {
+        return ADC_ERROR_CONFIG;
+    }
+    internal_configuration.base_config.supply_voltage_mv = supply_voltage_mv;
+    update_conversion_scale();
+    return ADC_ERROR_OK;
+}
+
+adc_error_t adc_get_supply_voltage(uint16_t * const supply_voltage_mv)
+{
+    if (NULL == supply_voltage_mv)
+    {
+        return ADC_ERROR_NULL_POINTER;
+    }
+    if (false == internal_configuration.is_initialised)
+    {
+        return ADC_ERROR_NOT_INITIALISED;
+    }
+    *supply_voltage_mv = internal_configuration.base_config.supply_voltage_mv;
+    return ADC_ERROR_OK;
 }
 
 
@@ -216,14 +341,83 @@ static inline adc_state_t check_initialisation(void)
     return (internal_configuration.is_initialised) ? ADC_STATE_READY : ADC_STATE_NOT_INITIALISED;
 }
 
+/* Conversions are started by hardware when auto triggering is used, except for the first one in free running mode */
+static inline bool is_hardware_triggered(void)
+{
+    return (ADC_RUNNING_MODE_AUTOTRIGGERED == internal_configuration.base_config.running_mode);
+}
+
+static inline bool needs_first_software_start(void)
+{
+    return (false == is_hardware_triggered())
+        || (ADC_TRIGGER_FREE_RUNNING == internal_configuration.base_config.trigger_sources);
+}
+
+/**
+ * @brief starts the conversion of the current channel by software.
+ * Quiet channels are not started right away : they are left to adc_process(), which starts them by entering the
+ * ADC noise reduction sleep mode.
+*/
+static inline void start_conversion(void)
+{
+    volatile adc_channel_pair_t * pair = NULL;
+    if ((ADC_STACK_ERROR_OK == adc_stack_get_current(&registered_channels, &pair)) && pair->quiet)
+    {
+        internal_configuration.quiet_pending = true;
+    }
+    else
+    {
+        *internal_configuration.base_config.handle.adcsra_reg |= (1 << ADSC);
+    }
+}
+
+/**
+ * @brief converts the pending quiet channel with the CPU sleeping in ADC noise reduction mode.
+ * Entering this sleep mode starts the conversion, ADC interrupt wakes the CPU up once it completes. Any other
+ * interrupt wakes the CPU up earlier, the conversion then completes in normal mode.
+ * clkI/O is halted while sleeping : Timer 0, Timer 1 and a synchronously clocked Timer 2 stop counting.
+ * Caller's global interrupt state is restored afterwards.
+*/
+static inline void run_quiet_conversion(void)
+{
+#ifdef UNIT_TESTING
+    internal_configuration.quiet_pending = false;
+    *internal_configuration.base_config.handle.adcsra_reg |= (1 << ADSC);
+#else
+    const uint8_t sreg = SREG;
+    cli();
+    internal_configuration.quiet_pending = false;
+    set_sleep_mode(SLEEP_MODE_ADC);
+    sleep_enable();
+    /* Instruction following sei is always executed before pending interrupts : no wake up event can be missed */
+    sei();
+    sleep_cpu();
+    sleep_disable();
+    SREG = sreg;
+#endif
+}
+
 adc_state_t adc_start(void)
 {
     adc_state_t init_state = check_initialisation();
     if (ADC_STATE_READY == init_state)
     {
         volatile uint8_t * reg = internal_configuration.base_config.handle.adcsra_reg;
-        /* Enable and start the ADC peripheral */
-        *reg |= (1 << ADEN) | (1 << ADSC);
+        /* First conversion samples the current channel, next ones are selected by the ISR as soon as the previous
+           conversion completes, so that they are ready before the next trigger event */
+        volatile adc_channel_pair_t * pair = NULL;
+        if (ADC_STACK_ERROR_OK == adc_stack_get_current(&registered_channels, &pair))
+        {
+            (void) set_mux_register(pair);
+        }
+
+        /* Enable and start the ADC peripheral, triggered conversions will wait for their trigger event */
+        internal_configuration.quiet_pending = false;
+        *reg |= (1 << ADEN);
+        if (needs_first_software_start())
+        {
+            start_conversion();
+        }
     }
 
     return init_state;
@@ -239,6 +433,7 @@ adc_state_t adc_stop(void)
         *reg &= ~((1 << ADEN) | (1 << ADSC));
         /* Disable ADC interrupt mode */
         *reg &= ~(1 << ADIE);
+        internal_configuration.quiet_pending = false;
     }
 
     return init_state;
@@ -247,7 +442,11 @@ adc_state_t adc_stop(void)
 adc_error_t adc_register_channel(const adc_mux_t channel)
 {
     adc_error_t ret = ADC_ERROR_OK;
+    /* Scan schedule is rebuilt while the ISR walks it */
+    uint8_t sreg = 0;
+    CRITICAL_SECTION_ENTER(sreg);
     adc_stack_error_t err = adc_stack_register_channel(&registered_channels, channel);
+    CRITICAL_SECTION_EXIT(sreg);
     if (ADC_STACK_ERROR_OK != err)
     {
         ret = ADC_ERROR_CONFIG;
@@ -258,7 +457,11 @@ adc_error_t adc_register_channel(const adc_mux_t channel)
 adc_error_t adc_unregister_channel(const adc_mux_t channel)
 {
     adc_error_t ret = ADC_ERROR_OK;
+    /* Scan schedule is rebuilt while the ISR walks it */
+    uint8_t sreg = 0;
+    CRITICAL_SECTION_ENTER(sreg);
     adc_stack_error_t err = adc_stack_unregister_channel(&registered_channels, channel);
+    CRITICAL_SECTION_EXIT(sreg);
     if (ADC_STACK_ERROR_OK != err)
     {
         ret = ADC_ERROR_CONFIG;
@@ -266,6 +469,90 @@ adc_error_t adc_unregister_channel(const adc_mux_t channel)
     return ret;
 }
 
+static inline adc_error_t find_channel(const adc_mux_t channel, volatile adc_channel_pair_t ** pair)
+{
+    adc_stack_error_t find_error = adc_stack_find_channel(&registered_channels, channel, pair);
+    return (ADC_STACK_ERROR_OK == find_error) ? ADC_ERROR_OK : ADC_ERROR_CHANNEL_NOT_FOUND;
+}
+
+adc_error_t adc_configure_channel(const adc_mux_t channel, adc_channel_config_t const * const config)
+{
+    if (NULL == config)
+    {
+        return ADC_ERROR_NULL_POINTER;
+    }
+
+    if ((config->oversampling > ADC_OVERSAMPLING_MAX)
+    || (config->filter_shift > ADC_FILTER_SHIFT_MAX)
+    || ((0U != config->oversampling) && (ADC_LEFT_ALIGNED_RESULT == internal_configuration.base_config.alignment))
+    || ((NULL != config->buffer) && (0U == config->buffer_size))
+    || (config->quiet && ((false == internal_configuration.base_config.using_interrupt) || is_hardware_triggered())))
+    {
+        return ADC_ERROR_CONFIG;
+    }
+
+    volatile adc_channel_pair_t * pair = NULL;
+    adc_error_t ret = find_channel(channel, &pair);
+    if (ADC_ERROR_OK == ret)
+    {
+        const uint8_t weight = (0U == config->weight) ? 1U : config->weight;
+        uint8_t sreg = 0;
+        CRITICAL_SECTION_ENTER(sreg);
+        if (ADC_STACK_ERROR_OK != adc_stack_set_weight(&registered_channels, channel, weight))
+        {
+            CRITICAL_SECTION_EXIT(sreg);
+            return ADC_ERROR_CONFIG;
+        }
+        pair->oversampling = config->oversampling;
+        pair->samples = 0;
+        pair->accumulator = 0;
+        pair->buffer = config->buffer;
+        pair->buffer_size = config->buffer_size;
+        pair->head = 0;
+        pair->count = 0;
+        pair->quiet = config->quiet;
+        pair->filter_shift = config->filter_shift;
+        pair->filter_state = 0;
+        pair->filter_seeded = false;
+        CRITICAL_SECTION_EXIT(sreg);
+    }
+    return ret;
+}
+
+adc_error_t adc_read_samples(const adc_mux_t channel, adc_result_t * const samples, const uint8_t max_count, uint8_t * const count)
+{
+    if ((NULL == samples) || (NULL == count))
+    {
+        return ADC_ERROR_NULL_POINTER;
+    }
+
+    volatile adc_channel_pair_t * pair = NULL;
+    adc_error_t ret = find_channel(channel, &pair);
+    if (ADC_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == pair->buffer)
+    {
+        return ADC_ERROR_CONFIG;
+    }
+
+    uint8_t sreg = 0;
+    CRITICAL_SECTION_ENTER(sreg);
+    uint8_t read = (uint8_t)((pair->head + pair->buffer_size - pair->count) % pair->buffer_size);
+    *count = (pair->count < max_count) ? pair->count : max_count;
+    for (uint8_t i = 0 ; i < *count ; i++)
+    {
+        samples[i] = pair->buffer[read];
+        read = (uint8_t)((read + 1U) % pair->buffer_size);
+    }
+    pair->count -= *count;
+    CRITICAL_SECTION_EXIT(sreg);
+
+    return ret;
+}
+
 adc_error_t adc_read_raw(const adc_mux_t channel, adc_result_t * const result)
 {
     adc_error_t ret = ADC_ERROR_OK;
@@ -276,15 +563,11 @@ adc_error_t adc_read_raw(const adc_mux_t channel, adc_result_t * const result)
     else
     {
         volatile adc_channel_pair_t * pair = NULL;
-        adc_stack_error_t find_error = adc_stack_find_channel(&registered_channels, channel, &pair);
-        if (ADC_STACK_ERROR_OK == find_error)
+        ret = find_channel(channel, &pair);
+        if (ADC_ERROR_OK == ret)
         {
             *result = pair->result;
         }
-        else
-        {
-            ret = ADC_ERROR_CHANNEL_NOT_FOUND;
-        }
     }
     return ret;
 }
@@ -294,18 +577,93 @@ static inline bool conversion_is_finished(void)
     return ((*internal_configuration.base_config.handle.adcsra_reg) & 1 << ADSC) == 0;
 }
 
-static inline void isr_helper_extract_data_from_adc_regs(void)
+/**
+ * @brief accumulates a new conversion of a channel and publishes a result once enough conversions were accumulated
+*/
+static inline bool publish_conversion(volatile adc_channel_pair_t * const pair, const uint16_t conversion)
 {
-    static volatile adc_channel_pair_t * pair = NULL;
-    adc_stack_error_t stack_error = ADC_STACK_ERROR_OK;
-    if (NULL == pair)
+    adc_result_t result = conversion;
+    if (0U != pair->oversampling)
+    {
+        pair->accumulator += conversion;
+        pair->samples++;
+        if (pair->samples < (1U << (2U * pair->oversampling)))
+        {
+            return false;
+        }
+        /* Sum of 4^n conversions carries 2n more bits, only half of them are meaningful (decimation) */
+        result = (adc_result_t)(pair->accumulator >> pair->oversampling);
+        pair->accumulator = 0;
+        pair->samples = 0;
+    }
+
+    pair->result = result;
+    if (0U != pair->filter_shift)
     {
-        stack_error = adc_stack_get_current(&registered_channels, &pair);
+        /* State is kept scaled up by 2^k : state += result - state / 2^k, filtered value is state / 2^k.
+           First result seeds the filter so that it does not ramp up from 0 */
+        if (pair->filter_seeded)
+        {
+            pair->filter_state += (uint32_t) result - (pair->filter_state >> pair->filter_shift);
+        }
+        else
+        {
+            pair->filter_state = (uint32_t) result << pair->filter_shift;
+            pair->filter_seeded = true;
+        }
     }
+
+    if (NULL != pair->buffer)
+    {
+        pair->buffer[pair->head] = result;
+        pair->head++;
+        if (pair->head >= pair->buffer_size)
+        {
+            pair->head = 0;
+        }
+        if (pair->count < pair->buffer_size)
+        {
+            pair->count++;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief copies the results of all registered channels once the last step of the scan schedule was converted.
+ * Oversampled channels are copied as well even though they only refresh every 4^n conversions.
+ * Sequence lock writer side : as it runs from the ISR, readers never observe an odd sequence on a single core MCU
+*/
+static inline void publish_round(void)
+{
+    round_snapshot.sequence++;
+    for (uint8_t i = 0 ; i < registered_channels.count ; i++)
+    {
+        round_snapshot.results[registered_channels.channels_pair[i].channel] = registered_channels.channels_pair[i].result;
+    }
+    round_snapshot.sequence++;
+}
+
+/**
+ * @brief publishes the conversion result of the current channel and selects the next one
+ * @return true when a conversion result was published
+*/
+static inline bool isr_helper_extract_data_from_adc_regs(void)
+{
+    /* Always fetched from the stack : a cached pointer would go stale once the scan order is reset or changed */
+    volatile adc_channel_pair_t * pair = NULL;
+    bool published = false;
+    adc_stack_error_t stack_error = adc_stack_get_current(&registered_channels, &pair);
     if (ADC_STACK_ERROR_OK == stack_error && conversion_is_finished())
     {
         uint16_t result = retrieve_result_from_registers();
-        pair->result = result;
+        if (publish_conversion(pair, result)
+        && internal_configuration.base_config.track_supply
+        && (ADC_MUX_1v1_REF == pair->channel))
+        {
+            internal_configuration.supply_pending = true;
+        }
+        published = true;
 
         #ifdef UNIT_TESTING
             /* Reset interrupt flag manually */
@@ -318,6 +676,51 @@ static inline void isr_helper_extract_data_from_adc_regs(void)
         if (ADC_STACK_ERROR_OK == stack_error)
         {
             set_mux_register(pair);
+            /* Schedule wrapped around : every channel of the round has been converted */
+            if (0U == registered_channels.schedule_step)
+            {
+                publish_round();
+            }
+        }
+    }
+    return published;
+}
+
+/**
+ * @brief reads the last result of a channel, normalised to (10 + ADC_OVERSAMPLING_MAX) bits whatever its oversampling order
+*/
+static inline adc_error_t read_normalised_result(const adc_mux_t channel, uint16_t * const result)
+{
+    volatile adc_channel_pair_t * pair = NULL;
+    adc_error_t ret = find_channel(channel, &pair);
+    if (ADC_ERROR_OK == ret)
+    {
+        uint8_t sreg = 0;
+        CRITICAL_SECTION_ENTER(sreg);
+        *result = (uint16_t)(pair->result << (ADC_OVERSAMPLING_MAX - pair->oversampling));
+        CRITICAL_SECTION_EXIT(sreg);
+    }
+    return ret;
+}
+
+/**
+ * @brief derives the supply voltage from the last bandgap result : 1V1 reads 1100 * 1024 / supply_mv against AVCC.
+ * Measured GND offset is removed first when calibrated. Implausible results (supply below 1V1 or above
+ * ADC_SUPPLY_VOLTAGE_MAX_MV) are dropped
+*/
+static void update_supply_voltage(void)
+{
+    internal_configuration.supply_pending = false;
+    uint16_t bandgap = 0;
+    if ((ADC_ERROR_OK == read_normalised_result(ADC_MUX_1v1_REF, &bandgap))
+    && (bandgap > internal_configuration.calibration.offset))
+    {
+        const uint32_t span = (uint32_t)(bandgap - internal_configuration.calibration.offset);
+        const uint32_t supply_mv = ((uint32_t) ADC_1V1_MILLIVOLT << (10U + ADC_OVERSAMPLING_MAX)) / span;
+        if ((supply_mv >= ADC_1V1_MILLIVOLT) && (supply_mv <= ADC_SUPPLY_VOLTAGE_MAX_MV))
+        {
+            internal_configuration.base_config.supply_voltage_mv = (uint16_t) supply_mv;
+            update_conversion_scale();
         }
     }
 }
@@ -327,13 +730,103 @@ adc_state_t adc_process(void)
     adc_state_t ret = check_initialisation();
     if (ADC_STATE_READY == ret)
     {
-       isr_helper_extract_data_from_adc_regs();
+        if (internal_configuration.supply_pending)
+        {
+            update_supply_voltage();
+        }
+
+        /* In interrupt mode, results are only fetched by the ISR : fetching them here as well would publish the last
+           result again whenever no conversion is running (ADSC reads 0 between triggers) or race with the ISR */
+        if (internal_configuration.base_config.using_interrupt)
+        {
+            if (internal_configuration.quiet_pending)
+            {
+                run_quiet_conversion();
+            }
+        }
         /* Start next conversion */
-        *internal_configuration.base_config.handle.adcsra_reg |= 1U << ADSC ;
+        else if (isr_helper_extract_data_from_adc_regs() && (false == is_hardware_triggered()))
+        {
+            start_conversion();
+        }
+    }
+    return ret;
+}
+
+adc_error_t adc_calibrate(void)
+{
+    if (false == internal_configuration.is_initialised)
+    {
+        return ADC_ERROR_NOT_INITIALISED;
     }
+
+    uint16_t gnd = 0;
+    adc_error_t ret = read_normalised_result(ADC_MUX_GND, &gnd);
+    if (ADC_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    /* Bandgap cannot be measured against itself : only offset is corrected when it is the reference.
+       Supply tracking already scales readings on the bandgap, a gain correction would be applied twice */
+    uint32_t gain = ADC_CALIBRATION_UNITY;
+    if ((ADC_VOLTAGE_REF_INTERNAL_1V1 != internal_configuration.base_config.ref)
+    && (false == internal_configuration.base_config.track_supply))
+    {
+        uint16_t bandgap = 0;
+        ret = read_normalised_result(ADC_MUX_1v1_REF, &bandgap);
+        if (ADC_ERROR_OK != ret)
+        {
+            return ret;
+        }
+        if ((internal_configuration.base_config.supply_voltage_mv < ADC_1V1_MILLIVOLT) || (bandgap <= gnd))
+        {
+            return ADC_ERROR_CONFIG;
+        }
+
+        /* Gain maps the measured GND to 1V1 span onto the ideal one */
+        const uint32_t ideal = ((uint32_t) ADC_1V1_MILLIVOLT << (10U + ADC_OVERSAMPLING_MAX)) / internal_configuration.base_config.supply_voltage_mv;
+        gain = (ideal << ADC_CALIBRATION_SHIFT) / (uint32_t)(bandgap - gnd);
+
+        /* Such a correction comes from a faulty measurement rather than from the ADC itself */
+        if ((gain <= (ADC_CALIBRATION_UNITY / 2U)) || (gain >= (ADC_CALIBRATION_UNITY * 2U)))
+        {
+            return ADC_ERROR_CONFIG;
+        }
+    }
+
+    internal_configuration.calibration.gain = (uint16_t) gain;
+    internal_configuration.calibration.offset = gnd;
+    update_conversion_scale();
     return ret;
 }
 
+void adc_reset_calibration(void)
+{
+    internal_configuration.calibration.gain = ADC_CALIBRATION_UNITY;
+    internal_configuration.calibration.offset = 0;
+    update_conversion_scale();
+}
+
+/**
+ * @brief converts a result of a channel to millivolts with the cached scale : one 16 x 16 -> 32 bits multiplication,
+ * one subtraction for the offset correction and a shift
+*/
+static inline adc_error_t convert_to_millivolt(const adc_result_t result, const uint8_t oversampling, adc_millivolts_t * const reading)
+{
+    if (false == internal_configuration.conversion.valid)
+    {
+        *reading = 0;
+        return ADC_ERROR_CONFIG;
+    }
+
+    const uint32_t scaled = (uint32_t) result * internal_configuration.conversion.scale;
+    const uint32_t offset = internal_configuration.conversion.offset >> (ADC_OVERSAMPLING_MAX - oversampling);
+    /* Oversampled results are (10 + n) bits wide */
+    *reading = (scaled > offset) ? (adc_millivolts_t)((scaled - offset) >> (ADC_SCALE_SHIFT + oversampling)) : 0U;
+    return ADC_ERROR_OK;
+}
+
 adc_error_t adc_read_millivolt(const adc_mux_t channel, adc_millivolts_t * const reading)
 {
     adc_error_t ret = ADC_ERROR_OK;
@@ -343,28 +836,94 @@ adc_error_t adc_read_millivolt(const adc_mux_t channel, adc_millivolts_t * const
     }
     else
     {
-        adc_result_t result = 0;
-        ret = adc_read_raw(channel, &result);
+        volatile adc_channel_pair_t * pair = NULL;
+        ret = find_channel(channel, &pair);
         if (ADC_ERROR_OK == ret)
         {
-            switch (internal_configuration.base_config.ref)
-            {
-                case ADC_VOLTAGE_REF_INTERNAL_1V1:
-                    *reading =  (uint16_t)(((uint32_t)result * (uint32_t)ADC_1V1_MILLIVOLT) / ADC_MAX_VALUE);
-                    break;
-                case ADC_VOLTAGE_REF_AREF_PIN:
-                case ADC_VOLTAGE_REF_AVCC:
-                    *reading = (uint16_t)(((uint32_t)result * (uint32_t)internal_configuration.base_config.supply_voltage_mv) / ADC_MAX_VALUE);
-                    break;
-                default:
-                    *reading = 0;
-                    ret = ADC_ERROR_CONFIG;
-                    break;
-            }
+            ret = convert_to_millivolt(pair->result, pair->oversampling, reading);
+        }
+
+    }
+
+    return ret;
+}
+
+adc_error_t adc_read_snapshot(const adc_mux_t * const channels, adc_result_t * const results, const uint8_t count, uint8_t * const round)
+{
+    if ((NULL == channels) || (NULL == results))
+    {
+        return ADC_ERROR_NULL_POINTER;
+    }
+
+    for (uint8_t i = 0 ; i < count ; i++)
+    {
+        volatile adc_channel_pair_t * pair = NULL;
+        adc_error_t ret = find_channel(channels[i], &pair);
+        if (ADC_ERROR_OK != ret)
+        {
+            return ret;
+        }
+    }
+
+    /* Sequence lock reader side : interrupts stay enabled, copy is retried if a round was published meanwhile */
+    uint8_t sequence = 0;
+    do
+    {
+        sequence = round_snapshot.sequence;
+        for (uint8_t i = 0 ; i < count ; i++)
+        {
+            results[i] = round_snapshot.results[channels[i]];
         }
+    } while ((0U != (sequence & 1U)) || (sequence != round_snapshot.sequence));
+
+    if (NULL != round)
+    {
+        *round = (uint8_t)(sequence >> 1U);
+    }
+    return ADC_ERROR_OK;
+}
+
+adc_error_t adc_read_filtered(const adc_mux_t channel, adc_result_t * const result)
+{
+    if (NULL == result)
+    {
+        return ADC_ERROR_NULL_POINTER;
+    }
+
+    volatile adc_channel_pair_t * pair = NULL;
+    adc_error_t ret = find_channel(channel, &pair);
+    if (ADC_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (0U == pair->filter_shift)
+    {
+        return ADC_ERROR_CONFIG;
+    }
+
+    uint8_t sreg = 0;
+    CRITICAL_SECTION_ENTER(sreg);
+    *result = (adc_result_t)(pair->filter_state >> pair->filter_shift);
+    CRITICAL_SECTION_EXIT(sreg);
+    return ret;
+}
 
+adc_error_t adc_read_filtered_millivolt(const adc_mux_t channel, adc_millivolts_t * const reading)
+{
+    if (NULL == reading)
+    {
+        return ADC_ERROR_NULL_POINTER;
     }
 
+    adc_result_t result = 0;
+    adc_error_t ret = adc_read_filtered(channel, &result);
+    if (ADC_ERROR_OK == ret)
+    {
+        volatile adc_channel_pair_t * pair = NULL;
+        (void) find_channel(channel, &pair);
+        ret = convert_to_millivolt(result, pair->oversampling, reading);
+    }
     return ret;
 }
 
@@ -385,18 +944,21 @@ void adc_isr_handler(void)
         && (0 != (*internal_configuration.base_config.handle.adcsra_reg & ADIF_MSK))
         )
         {
-            isr_helper_extract_data_from_adc_regs();
-
             /* Start next conversion */
-            (*internal_configuration.base_config.handle.adcsra_reg) |= 1U << ADSC ;
+            if (isr_helper_extract_data_from_adc_regs() && (false == is_hardware_triggered()))
+            {
+                start_conversion();
+            }
         }
     }
 }
 #else
 void adc_isr_handler(void)
 {
-    isr_helper_extract_data_from_adc_regs();
-    /* Start next conversion */
-    *(internal_configuration.base_config.handle.adcsra_reg) |= (1 << ADSC) ;
+    /* Start next conversion, unless hardware does it on next trigger event */
+    if (isr_helper_extract_data_from_adc_regs() && (false == is_hardware_triggered()))
+    {
+        start_conversion();
+    }
 }
 #endif
@@ -32,6 +32,49 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include <stdbool.h>
 #include "adc_stack.h"
 
+/**
+ * @brief rebuilds the scan schedule out of registered pairs weights (smooth weighted round robin) :
+ * at each step, every pair earns its weight and the richest one is scheduled and pays the sum of all weights.
+ * Occurrences of heavy pairs end up evenly spread over the round and ties go to the lowest slot, hence equal weights
+ * give a plain round robin. Scan resumes from the first occurrence of the pair currently scanned.
+ * @param[in] stack : adc stack object
+*/
+static void rebuild_schedule(volatile adc_stack_t * const stack)
+{
+    int16_t credit[ADC_MUX_COUNT] = {0};
+    uint8_t total = 0;
+    for (uint8_t i = 0 ; i < stack->count ; i++)
+    {
+        total += stack->channels_pair[i].weight;
+    }
+
+    for (uint8_t step = 0 ; step < total ; step++)
+    {
+        uint8_t richest = 0;
+        for (uint8_t i = 0 ; i < stack->count ; i++)
+        {
+            credit[i] += stack->channels_pair[i].weight;
+            if (credit[i] > credit[richest])
+            {
+                richest = i;
+            }
+        }
+        credit[richest] -= total;
+        stack->schedule[step] = richest;
+    }
+    stack->schedule_length = total;
+
+    stack->schedule_step = 0;
+    for (uint8_t step = 0 ; step < total ; step++)
+    {
+        if (stack->schedule[step] == stack->index)
+        {
+            stack->schedule_step = step;
+            break;
+        }
+    }
+}
+
 adc_stack_error_t adc_stack_reset(volatile adc_stack_t * const stack)
 {
     adc_stack_error_t ret = ADC_STACK_ERROR_OK;
@@ -43,11 +86,21 @@ adc_stack_error_t adc_stack_reset(volatile adc_stack_t * const stack)
     {
         stack->count = 0;
         stack->index = 0;
+        stack->schedule_length = 0;
+        stack->schedule_step = 0;
         for (uint8_t i = 0 ; i < ADC_MUX_COUNT ; i++)
         {
             /* resets targeted pair to defaults */
             adc_channel_pair_reset(&stack->channels_pair[i]);
         }
+        for (uint8_t i = 0 ; i < ADC_STACK_LOOKUP_SIZE ; i++)
+        {
+            stack->lookup[i] = ADC_STACK_NO_SLOT;
+        }
+        for (uint8_t i = 0 ; i < ADC_STACK_SCHEDULE_SIZE ; i++)
+        {
+            stack->schedule[i] = 0;
+        }
     }
 
     return ret;
@@ -64,6 +117,18 @@ adc_stack_error_t adc_channel_pair_copy(volatile adc_channel_pair_t * dest, vola
     {
         dest->channel = src->channel;
         dest->result = src->result;
+        dest->oversampling = src->oversampling;
+        dest->samples = src->samples;
+        dest->accumulator = src->accumulator;
+        dest->buffer = src->buffer;
+        dest->buffer_size = src->buffer_size;
+        dest->head = src->head;
+        dest->count = src->count;
+        dest->quiet = src->quiet;
+        dest->filter_shift = src->filter_shift;
+        dest->filter_state = src->filter_state;
+        dest->filter_seeded = src->filter_seeded;
+        dest->weight = src->weight;
     }
     return ret;
 }
@@ -79,6 +144,18 @@ adc_stack_error_t adc_channel_pair_reset(volatile adc_channel_pair_t * const pai
     {
         pair->channel = ADC_MUX_GND;
         pair->result = 0;
+        pair->oversampling = 0;
+        pair->samples = 0;
+        pair->accumulator = 0;
+        pair->buffer = NULL;
+        pair->buffer_size = 0;
+        pair->head = 0;
+        pair->count = 0;
+        pair->quiet = false;
+        pair->filter_shift = 0;
+        pair->filter_state = 0;
+        pair->filter_seeded = false;
+        pair->weight = 1U;
     }
     return ret;
 }
@@ -94,10 +171,14 @@ adc_stack_error_t adc_stack_register_channel(volatile adc_stack_t * const stack,
     else
     {
         /* Check if we can add one more element */
-        if( ADC_MUX_COUNT < stack->count + 1)
+        if( (ADC_MUX_COUNT < stack->count + 1) || (ADC_STACK_SCHEDULE_SIZE < stack->schedule_length + 1U))
         {
             ret = ADC_STACK_ERROR_FULL;
         }
+        else if (mux >= ADC_STACK_LOOKUP_SIZE)
+        {
+            ret = ADC_STACK_ERROR_ELEMENT_NOT_FOUND;
+        }
     }
 
     /* Add new element in the stack */
@@ -105,6 +186,13 @@ adc_stack_error_t adc_stack_register_channel(volatile adc_stack_t * const stack,
     {
         stack->count++;
         stack->channels_pair[stack->count - 1].channel = mux;
+        stack->channels_pair[stack->count - 1].weight = 1U;
+        /* Lookup always targets the first instance of a channel */
+        if (ADC_STACK_NO_SLOT == stack->lookup[mux])
+        {
+            stack->lookup[mux] = stack->count - 1;
+        }
+        rebuild_schedule(stack);
     }
 
     return ret;
@@ -129,27 +217,26 @@ adc_stack_error_t adc_stack_unregister_channel(volatile adc_stack_t * const stac
     /* Remove one element from the stack and clean previous entry */
     if (ADC_STACK_ERROR_OK == ret)
     {
-        uint8_t index = ADC_MUX_COUNT;
-        for (uint8_t i = 0 ; i < stack->count ; i++ )
-        {
-            if (stack->channels_pair[i].channel == mux)
-            {
-                // Found first matching channel
-                index = i;
-                break;
-            }
-        }
+        const uint8_t index = (mux < ADC_STACK_LOOKUP_SIZE) ? stack->lookup[mux] : ADC_STACK_NO_SLOT;
 
         /* If we haven't found any match */
-        if (ADC_MUX_COUNT == index)
+        if (ADC_STACK_NO_SLOT == index)
         {
             ret = ADC_STACK_ERROR_ELEMENT_NOT_FOUND;
         }
         else
         {
+            /* Scan order is kept : following channels move one slot down, and so do their lookup entries.
+               Next instance of the removed channel (if any) becomes its first one */
+            stack->lookup[mux] = ADC_STACK_NO_SLOT;
             for (uint8_t i = index ; i < stack->count - 1 ; i++)
             {
                 adc_channel_pair_copy(&stack->channels_pair[i], &stack->channels_pair[i+1]);
+                const adc_mux_t moved = stack->channels_pair[i].channel;
+                if ((ADC_STACK_NO_SLOT == stack->lookup[moved]) || (stack->lookup[moved] > i))
+                {
+                    stack->lookup[moved] = i;
+                }
             }
             stack->count--;
 
@@ -159,6 +246,12 @@ adc_stack_error_t adc_stack_unregister_channel(volatile adc_stack_t * const stac
             {
                 stack->index = (stack->count + stack->index - 1) % stack->count;
             }
+            else if (stack->index > index)
+            {
+                /* Keeps pointing to the same pair, which moved one slot down */
+                stack->index--;
+            }
+            rebuild_schedule(stack);
 
         }
     }
@@ -184,26 +277,50 @@ adc_stack_error_t adc_stack_find_channel(volatile adc_stack_t * const stack, vol
     /* Get element address */
     if (ADC_STACK_ERROR_OK == ret)
     {
-        bool found_item = false;
-        for (uint8_t i = 0 ; i < stack->count ; i++ )
-        {
-            if (stack->channels_pair[i].channel == channel)
-            {
-                // Found first matching channel
-                *pair = &stack->channels_pair[i];
-                found_item = true;
-                break;
-            }
-        }
-        if (!found_item)
+        const uint8_t slot = (channel < ADC_STACK_LOOKUP_SIZE) ? stack->lookup[channel] : ADC_STACK_NO_SLOT;
+        if (ADC_STACK_NO_SLOT == slot)
         {
             *pair = NULL;
             ret = ADC_STACK_ERROR_ELEMENT_NOT_FOUND;
         }
+        else
+        {
+            *pair = &stack->channels_pair[slot];
+        }
     }
     return ret;
 }
 
+adc_stack_error_t adc_stack_set_weight(volatile adc_stack_t * const stack, volatile const adc_mux_t mux, const uint8_t weight)
+{
+    adc_stack_error_t ret = ADC_STACK_ERROR_OK;
+    if (NULL == stack)
+    {
+        ret = ADC_STACK_ERROR_NULL_POINTER;
+    }
+    else if (0U == weight)
+    {
+        ret = ADC_STACK_ERROR_INVALID_VALUE;
+    }
+    else
+    {
+        const uint8_t slot = (mux < ADC_STACK_LOOKUP_SIZE) ? stack->lookup[mux] : ADC_STACK_NO_SLOT;
+        if (ADC_STACK_NO_SLOT == slot)
+        {
+            ret = ADC_STACK_ERROR_ELEMENT_NOT_FOUND;
+        }
+        else if (ADC_STACK_SCHEDULE_SIZE < (uint16_t)(stack->schedule_length - stack->channels_pair[slot].weight + weight))
+        {
+            ret = ADC_STACK_ERROR_FULL;
+        }
+        else
+        {
+            stack->channels_pair[slot].weight = weight;
+            rebuild_schedule(stack);
+        }
+    }
+    return ret;
+}
 
 adc_stack_error_t adc_stack_get_next(volatile adc_stack_t * const stack, volatile adc_channel_pair_t ** pair)
 {
@@ -221,11 +338,15 @@ adc_stack_error_t adc_stack_get_next(volatile adc_stack_t * const stack, volatil
         }
     }
 
-    /* Move to next element and return its address */
+    /* Move to next step of the precomputed schedule and return its pair address */
     if (ADC_STACK_ERROR_OK == ret)
     {
-        stack->index++;
-        stack->index %= stack->count;
+        stack->schedule_step++;
+        if (stack->schedule_step >= stack->schedule_length)
+        {
+            stack->schedule_step = 0;
+        }
+        stack->index = stack->schedule[stack->schedule_step];
         *pair = &(stack->channels_pair[stack->index]);
     }
 
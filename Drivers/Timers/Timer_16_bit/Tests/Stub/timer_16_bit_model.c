@@ -0,0 +1,333 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "timer_16_bit_model.h"
+#include <string.h>
+
+#define TIMER_16_BIT_MODEL_MAX   (0xFFFFU)
+
+static const uint16_t prescaler_values[8] = {0U, 1U, 8U, 64U, 256U, 1024U, 0U, 0U};
+
+static const uint8_t flag_masks[TIMER_16_BIT_MODEL_VECTOR_COUNT] = {ICF_MSK, OCFA_MSK, OCFB_MSK, TOV_MSK};
+static const uint8_t enable_masks[TIMER_16_BIT_MODEL_VECTOR_COUNT] = {ICIE_MSK, OCIEA_MSK, OCIEB_MSK, TOIE_MSK};
+
+static inline uint16_t read_16(volatile uint8_t const * const high, volatile uint8_t const * const low)
+{
+    return (uint16_t)(((uint16_t) *high << 8U) | *low);
+}
+
+static inline void write_counter(timer_16_bit_model_t * const model, const uint16_t value)
+{
+    model->regs->TCNT_H = (uint8_t)(value >> 8U);
+    model->regs->TCNT_L = (uint8_t)(value & 0xFF);
+}
+
+static inline timer_16_bit_waveform_generation_t get_waveform(timer_16_bit_model_t const * const model)
+{
+    uint8_t wgm = model->regs->TCCRA & (WGM0_MSK | WGM1_MSK);
+    if (0U != (model->regs->TCCRB & WGM2_MSK))
+    {
+        wgm |= 0x04U;
+    }
+    if (0U != (model->regs->TCCRB & WGM3_MSK))
+    {
+        wgm |= 0x08U;
+    }
+    return (timer_16_bit_waveform_generation_t) wgm;
+}
+
+/**
+ * @brief phase and frequency correct modes update their compare buffers at BOTTOM, other dual slope modes at TOP
+*/
+static inline bool is_phase_freq_correct(const timer_16_bit_waveform_generation_t waveform)
+{
+    return (TIMER16BIT_WG_PWM_PHASE_AND_FREQ_CORRECT_ICR_MAX == waveform) || (TIMER16BIT_WG_PWM_PHASE_AND_FREQ_CORRECT_OCRA_MAX == waveform);
+}
+
+static inline bool is_dual_slope(const timer_16_bit_waveform_generation_t waveform)
+{
+    switch (waveform)
+    {
+        case TIMER16BIT_WG_PWM_PHASE_CORRECT_8_bit_FULL_RANGE:
+        case TIMER16BIT_WG_PWM_PHASE_CORRECT_9_bit_FULL_RANGE:
+        case TIMER16BIT_WG_PWM_PHASE_CORRECT_10_bit_FULL_RANGE:
+        case TIMER16BIT_WG_PWM_PHASE_AND_FREQ_CORRECT_ICR_MAX:
+        case TIMER16BIT_WG_PWM_PHASE_AND_FREQ_CORRECT_OCRA_MAX:
+        case TIMER16BIT_WG_PWM_PHASE_CORRECT_ICR_MAX:
+        case TIMER16BIT_WG_PWM_PHASE_CORRECT_OCRA_MAX:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static inline bool is_fast_pwm(const timer_16_bit_waveform_generation_t waveform)
+{
+    switch (waveform)
+    {
+        case TIMER16BIT_WG_PWM_FAST_8_bit_FULL_RANGE:
+        case TIMER16BIT_WG_PWM_FAST_9_bit_FULL_RANGE:
+        case TIMER16BIT_WG_PWM_FAST_10_bit_FULL_RANGE:
+        case TIMER16BIT_WG_PWM_FAST_ICR_MAX:
+        case TIMER16BIT_WG_PWM_FAST_OCRA_MAX:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static inline bool is_icr_top(const timer_16_bit_waveform_generation_t waveform)
+{
+    return (TIMER16BIT_WG_PWM_PHASE_AND_FREQ_CORRECT_ICR_MAX == waveform) || (TIMER16BIT_WG_PWM_PHASE_CORRECT_ICR_MAX == waveform)
+        || (TIMER16BIT_WG_CTC_ICR_MAX == waveform) || (TIMER16BIT_WG_PWM_FAST_ICR_MAX == waveform);
+}
+
+static inline uint16_t get_top(timer_16_bit_model_t const * const model, const timer_16_bit_waveform_generation_t waveform)
+{
+    switch (waveform)
+    {
+        case TIMER16BIT_WG_PWM_PHASE_CORRECT_8_bit_FULL_RANGE:
+        case TIMER16BIT_WG_PWM_FAST_8_bit_FULL_RANGE:
+            return 0x00FFU;
+        case TIMER16BIT_WG_PWM_PHASE_CORRECT_9_bit_FULL_RANGE:
+        case TIMER16BIT_WG_PWM_FAST_9_bit_FULL_RANGE:
+            return 0x01FFU;
+        case TIMER16BIT_WG_PWM_PHASE_CORRECT_10_bit_FULL_RANGE:
+        case TIMER16BIT_WG_PWM_FAST_10_bit_FULL_RANGE:
+            return 0x03FFU;
+        case TIMER16BIT_WG_CTC_OCRA_MAX:
+            /* Compare registers are not buffered in CTC mode */
+            return read_16(&model->regs->OCRA_H, &model->regs->OCRA_L);
+        case TIMER16BIT_WG_PWM_PHASE_AND_FREQ_CORRECT_OCRA_MAX:
+        case TIMER16BIT_WG_PWM_PHASE_CORRECT_OCRA_MAX:
+        case TIMER16BIT_WG_PWM_FAST_OCRA_MAX:
+            return model->ocra;
+        case TIMER16BIT_WG_PWM_PHASE_AND_FREQ_CORRECT_ICR_MAX:
+        case TIMER16BIT_WG_PWM_PHASE_CORRECT_ICR_MAX:
+        case TIMER16BIT_WG_CTC_ICR_MAX:
+        case TIMER16BIT_WG_PWM_FAST_ICR_MAX:
+            return read_16(&model->regs->ICR_H, &model->regs->ICR_L);
+        default:
+            return TIMER_16_BIT_MODEL_MAX;
+    }
+}
+
+static inline void update_compare_buffers(timer_16_bit_model_t * const model)
+{
+    model->ocra = read_16(&model->regs->OCRA_H, &model->regs->OCRA_L);
+    model->ocrb = read_16(&model->regs->OCRB_H, &model->regs->OCRB_L);
+}
+
+/**
+ * @brief computes the output level after a compare match, using the COMnx bits of the channel
+*/
+static bool output_on_match(const uint8_t com, const bool level, const timer_16_bit_waveform_generation_t waveform, const bool counting_down)
+{
+    switch (com)
+    {
+        case TIMER16BIT_CMOD_TOGGLE_OCnX:
+            return !level;
+        case TIMER16BIT_CMOD_CLEAR_OCnX:
+            return (is_dual_slope(waveform) && counting_down);
+        case TIMER16BIT_CMOD_SET_OCnX:
+            return !(is_dual_slope(waveform) && counting_down);
+        default:
+            return level;
+    }
+}
+
+/**
+ * @brief compare units match while the counter holds the compare value, flags are raised and outputs change on the
+ * following timer clock (e.g. in CTC mode, OCFnA is raised when the counter is cleared)
+*/
+static void compare_match(timer_16_bit_model_t * const model, const timer_16_bit_waveform_generation_t waveform,
+                          const uint16_t counter, const bool counting_down)
+{
+    const bool buffered = is_fast_pwm(waveform) || is_dual_slope(waveform);
+    const uint8_t com_a = (model->regs->TCCRA & COMA_MSK) >> COMA0_BIT;
+    const uint8_t com_b = (model->regs->TCCRA & COMB_MSK) >> COMB0_BIT;
+    const uint16_t ocra = buffered ? model->ocra : read_16(&model->regs->OCRA_H, &model->regs->OCRA_L);
+    const uint16_t ocrb = buffered ? model->ocrb : read_16(&model->regs->OCRB_H, &model->regs->OCRB_L);
+
+    if (counter == ocra)
+    {
+        model->regs->TIFR |= OCFA_MSK;
+        model->output_a = output_on_match(com_a, model->output_a, waveform, counting_down);
+    }
+    if (counter == ocrb)
+    {
+        model->regs->TIFR |= OCFB_MSK;
+        model->output_b = output_on_match(com_b, model->output_b, waveform, counting_down);
+    }
+}
+
+/**
+ * @brief fast PWM outputs are set (non inverting) or cleared (inverting) when the counter restarts from BOTTOM
+*/
+static void restart_fast_pwm_outputs(timer_16_bit_model_t * const model)
+{
+    const uint8_t com_a = (model->regs->TCCRA & COMA_MSK) >> COMA0_BIT;
+    const uint8_t com_b = (model->regs->TCCRA & COMB_MSK) >> COMB0_BIT;
+    if (com_a >= TIMER16BIT_CMOD_CLEAR_OCnX)
+    {
+        model->output_a = (TIMER16BIT_CMOD_CLEAR_OCnX == com_a);
+    }
+    if (com_b >= TIMER16BIT_CMOD_CLEAR_OCnX)
+    {
+        model->output_b = (TIMER16BIT_CMOD_CLEAR_OCnX == com_b);
+    }
+}
+
+static void timer_clock(timer_16_bit_model_t * const model)
+{
+    const timer_16_bit_waveform_generation_t waveform = get_waveform(model);
+    const uint16_t top = get_top(model, waveform);
+    const uint16_t counter = read_16(&model->regs->TCNT_H, &model->regs->TCNT_L);
+    const bool counting_down = model->counting_down;
+    bool restarted = false;
+
+    if (is_dual_slope(waveform))
+    {
+        if (false == model->counting_down)
+        {
+            write_counter(model, counter + 1U);
+            if ((uint16_t)(counter + 1U) >= top)
+            {
+                model->counting_down = true;
+                if (false == is_phase_freq_correct(waveform))
+                {
+                    update_compare_buffers(model);
+                }
+            }
+        }
+        else
+        {
+            write_counter(model, counter - 1U);
+            if (1U == counter)
+            {
+                model->counting_down = false;
+                model->regs->TIFR |= TOV_MSK;
+                if (is_phase_freq_correct(waveform))
+                {
+                    update_compare_buffers(model);
+                }
+            }
+        }
+    }
+    else if (counter == top)
+    {
+        write_counter(model, 0U);
+        restarted = true;
+        /* TOV is raised at MAX, which is also TOP in normal mode, and at TOP in fast PWM modes */
+        if ((TIMER_16_BIT_MODEL_MAX == top) || is_fast_pwm(waveform))
+        {
+            model->regs->TIFR |= TOV_MSK;
+        }
+    }
+    else
+    {
+        write_counter(model, counter + 1U);
+    }
+
+    if ((counter == top) && is_icr_top(waveform))
+    {
+        model->regs->TIFR |= ICF_MSK;
+    }
+    compare_match(model, waveform, counter, counting_down);
+    if (restarted && is_fast_pwm(waveform))
+    {
+        update_compare_buffers(model);
+        restart_fast_pwm_outputs(model);
+    }
+
+    model->ticks++;
+    model->output_high_ticks[0] += model->output_a ? 1U : 0U;
+    model->output_high_ticks[1] += model->output_b ? 1U : 0U;
+}
+
+static void service_interrupts(timer_16_bit_model_t * const model)
+{
+    for (uint8_t i = 0 ; i < (uint8_t) TIMER_16_BIT_MODEL_VECTOR_COUNT ; i++)
+    {
+        if ((0U != (model->regs->TIFR & flag_masks[i]))
+        &&  (0U != (model->regs->TIMSK & enable_masks[i]))
+        &&  (NULL != model->isr[i]))
+        {
+            model->regs->TIFR &= (uint8_t) ~flag_masks[i];
+            model->isr_calls[i]++;
+            model->isr[i]();
+        }
+    }
+}
+
+void timer_16_bit_model_init(timer_16_bit_model_t * const model, timer_16_bit_registers_stub_t * const regs)
+{
+    memset(model, 0, sizeof(timer_16_bit_model_t));
+    model->regs = regs;
+    /* Flags cleared by the drivers (write one to clear) read back as set in the registers stub */
+    model->regs->TIFR = 0U;
+    update_compare_buffers(model);
+}
+
+void timer_16_bit_model_attach_isr(timer_16_bit_model_t * const model, const timer_16_bit_model_vector_t vector, timer_16_bit_model_isr_t isr)
+{
+    if (vector < TIMER_16_BIT_MODEL_VECTOR_COUNT)
+    {
+        model->isr[vector] = isr;
+    }
+}
+
+void timer_16_bit_model_run(timer_16_bit_model_t * const model, const uint32_t cpu_cycles)
+{
+    uint32_t remaining = cpu_cycles;
+    while (0U != remaining)
+    {
+        const uint16_t prescaler = prescaler_values[model->regs->TCCRB & CS_MSK];
+        if (0U == prescaler)
+        {
+            /* Stopped or externally clocked, nothing happens until the clock selection changes */
+            model->prescaler_count = 0U;
+            return;
+        }
+
+        /* Skips the cycles in between two timer clocks, the prescaler may have been lowered by an ISR */
+        const uint32_t to_clock = (model->prescaler_count < prescaler) ? (uint32_t)(prescaler - model->prescaler_count) : 1U;
+        if (remaining < to_clock)
+        {
+            model->prescaler_count += (uint16_t) remaining;
+            return;
+        }
+
+        remaining -= to_clock;
+        model->prescaler_count = 0U;
+        timer_clock(model);
+        service_interrupts(model);
+    }
+}
@@ -33,6 +33,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "timer_16_bit.h"
 #include "timer_generic.h"
 #include "timer_16_bit_registers_stub.h"
+#include "timer_16_bit_model.h"
 
 /* Default timer id */
 #define DT_ID 0
@@ -577,6 +578,118 @@ TEST_F(Timer16BitFixture, test_input_capture_peripheral)
     ASSERT_EQ(config.input_capture.use_noise_canceler, use_noise_canceler);
 }
 
+TEST_F(Timer16BitFixture, test_input_capture_value_and_flags)
+{
+    timer_error_t ret = TIMER_ERROR_OK;
+
+    /* Input capture value is read from ICR, not from the main counter */
+    timer_16_bit_registers_stub.TCNT_H = 0x12;
+    timer_16_bit_registers_stub.TCNT_L = 0x34;
+    timer_16_bit_registers_stub.ICR_H = 0xAB;
+    timer_16_bit_registers_stub.ICR_L = 0xCD;
+    uint16_t captured = 0;
+    ret = timer_16_bit_get_input_capture_value(DT_ID, &captured);
+    ASSERT_EQ(TIMER_ERROR_OK, ret);
+    ASSERT_EQ(0xABCD, captured);
+
+    /* ICR is also written when used as TOP value */
+    const uint16_t top = 0x0320;
+    ret = timer_16_bit_set_input_capture_value(DT_ID, &top);
+    ASSERT_EQ(TIMER_ERROR_OK, ret);
+    ASSERT_EQ(0x03, timer_16_bit_registers_stub.ICR_H);
+    ASSERT_EQ(0x20, timer_16_bit_registers_stub.ICR_L);
+
+    /* Only selected flags are written (flags are cleared by writing a logical one to them) */
+    timer_16_bit_interrupt_config_t flags = {};
+    flags.it_input_capture = true;
+    flags.it_timer_overflow = true;
+    timer_16_bit_registers_stub.TIFR = TOV_MSK | ICF_MSK | OCFA_MSK | OCFB_MSK;
+    ret = timer_16_bit_clear_interrupt_flags(DT_ID, &flags);
+    ASSERT_EQ(TIMER_ERROR_OK, ret);
+    ASSERT_EQ(ICF_MSK | TOV_MSK, timer_16_bit_registers_stub.TIFR);
+
+    ret = timer_16_bit_clear_interrupt_flags(DT_ID, NULL);
+    ASSERT_EQ(TIMER_ERROR_NULL_POINTER, ret);
+}
+
+TEST_F(Timer16BitFixture, test_16_bit_registers_access)
+{
+    timer_error_t ret = TIMER_ERROR_OK;
+    const uint16_t written = 0xA55A;
+    uint16_t read = 0;
+
+    /* Both bytes of each 16 bits register are transferred, whatever the access order */
+    ret = timer_16_bit_set_counter_value(DT_ID, &written);
+    ASSERT_EQ(TIMER_ERROR_OK, ret);
+    ASSERT_EQ(0xA5, timer_16_bit_registers_stub.TCNT_H);
+    ASSERT_EQ(0x5A, timer_16_bit_registers_stub.TCNT_L);
+    ret = timer_16_bit_get_counter_value(DT_ID, &read);
+    ASSERT_EQ(TIMER_ERROR_OK, ret);
+    ASSERT_EQ(written, read);
+
+    ret = timer_16_bit_set_ocrb_register_value(DT_ID, &written);
+    ASSERT_EQ(TIMER_ERROR_OK, ret);
+    ASSERT_EQ(0xA5, timer_16_bit_registers_stub.OCRB_H);
+    ASSERT_EQ(0x5A, timer_16_bit_registers_stub.OCRB_L);
+    ret = timer_16_bit_get_ocrb_register_value(DT_ID, &read);
+    ASSERT_EQ(TIMER_ERROR_OK, ret);
+    ASSERT_EQ(written, read);
+}
+
+TEST_F(Timer16BitFixture, test_dithered_duty_cycle)
+{
+    timer_16_bit_dither_config_t dither_config = {0x3FF, TIMER16BIT_DITHER_FIRST_ORDER, TIMER16BIT_DITHER_OUTPUT_A | TIMER16BIT_DITHER_OUTPUT_B};
+    timer_error_t ret = timer_16_bit_set_duty_hires(DT_ID, 0x1234);
+    ASSERT_EQ(TIMER_ERROR_NOT_INITIALISED, ret);
+
+    for (const timer_16_bit_dither_order_t order : {TIMER16BIT_DITHER_FIRST_ORDER, TIMER16BIT_DITHER_SECOND_ORDER})
+    {
+        dither_config.order = order;
+        ret = timer_16_bit_dither_enable(DT_ID, &dither_config);
+        ASSERT_EQ(TIMER_ERROR_OK, ret);
+
+        /* 0x1234 / 65536 * 1024 = 72.8125 counts : averaged compare value keeps the 16 bits resolution */
+        ret = timer_16_bit_set_duty_hires(DT_ID, 0x1234);
+        ASSERT_EQ(TIMER_ERROR_OK, ret);
+
+        int32_t sum = 0;
+        for (uint16_t period = 0 ; period < 1024U ; period++)
+        {
+            timer_16_bit_dither_callback(DT_ID);
+            const uint16_t ocra = (uint16_t)((timer_16_bit_registers_stub.OCRA_H << 8U) | timer_16_bit_registers_stub.OCRA_L);
+            const uint16_t ocrb = (uint16_t)((timer_16_bit_registers_stub.OCRB_H << 8U) | timer_16_bit_registers_stub.OCRB_L);
+            ASSERT_EQ(ocra, ocrb);
+            if (TIMER16BIT_DITHER_FIRST_ORDER == order)
+            {
+                ASSERT_TRUE((72U == ocra) || (73U == ocra));
+            }
+            else
+            {
+                ASSERT_TRUE((71U <= ocra) && (ocra <= 74U));
+            }
+            sum += ocra;
+        }
+        ASSERT_LE(abs(sum - (int32_t)(72.8125 * 1024)), 2);
+    }
+
+    /* Output is kept in the valid compare range */
+    ret = timer_16_bit_set_duty_hires(DT_ID, 0xFFFF);
+    ASSERT_EQ(TIMER_ERROR_OK, ret);
+    for (uint8_t period = 0 ; period < 16U ; period++)
+    {
+        timer_16_bit_dither_callback(DT_ID);
+        ASSERT_LE((uint16_t)((timer_16_bit_registers_stub.OCRA_H << 8U) | timer_16_bit_registers_stub.OCRA_L), 0x3FF);
+    }
+
+    dither_config.outputs = 0U;
+    ret = timer_16_bit_dither_enable(DT_ID, &dither_config);
+    ASSERT_EQ(TIMER_ERROR_CONFIG, ret);
+    ret = timer_16_bit_dither_enable(DT_ID, NULL);
+    ASSERT_EQ(TIMER_ERROR_NULL_POINTER, ret);
+    ret = timer_16_bit_dither_disable(DT_ID);
+    ASSERT_EQ(TIMER_ERROR_OK, ret);
+}
+
 TEST_F(Timer16BitFixture, test_initialisation_deinitialisation)
 {
     timer_error_t ret = TIMER_ERROR_OK;
@@ -654,6 +767,174 @@ TEST(timer_16_bit_driver_tests, test_parameters_computation_prescaler)
     ASSERT_EQ(accumulator, 0U);
 }
 
+TEST_F(Timer16BitFixture, test_generate_frequency)
+{
+    uint32_t achieved = 0;
+    ASSERT_EQ(timer_16_bit_generate_frequency(DT_ID, 16'000'000U, 10U, nullptr), TIMER_ERROR_NULL_POINTER);
+
+    /* Timer shall be initialised first, as this call starts it */
+    (void) timer_16_bit_deinit(DT_ID);
+    ASSERT_EQ(timer_16_bit_generate_frequency(DT_ID, 16'000'000U, 10U, &achieved), TIMER_ERROR_NOT_INITIALISED);
+    ASSERT_EQ(timer_16_bit_registers_stub.TCCRB, 0U);
+    ASSERT_EQ(timer_16_bit_init(DT_ID, &config), TIMER_ERROR_OK);
+
+    ASSERT_EQ(timer_16_bit_generate_frequency(DT_ID, 16'000'000U, 0U, &achieved), TIMER_ERROR_CONFIG);
+
+    ASSERT_EQ(timer_16_bit_generate_frequency(DT_ID, 16'000'000U, 10U, &achieved), TIMER_ERROR_OK);
+    ASSERT_EQ(achieved, 10U);
+
+    uint16_t ocra = 0;
+    ASSERT_EQ(timer_16_bit_get_ocra_register_value(DT_ID, &ocra), TIMER_ERROR_OK);
+    ASSERT_EQ(ocra, 12'499U);
+
+    timer_16_bit_waveform_generation_t waveform;
+    ASSERT_EQ(timer_16_bit_get_waveform_generation(DT_ID, &waveform), TIMER_ERROR_OK);
+    ASSERT_EQ(waveform, TIMER16BIT_WG_CTC_OCRA_MAX);
+
+    timer_16_bit_compare_output_mode_t comp_a;
+    ASSERT_EQ(timer_16_bit_get_compare_match_A(DT_ID, &comp_a), TIMER_ERROR_OK);
+    ASSERT_EQ(comp_a, TIMER16BIT_CMOD_TOGGLE_OCnX);
+
+    timer_16_bit_prescaler_selection_t prescaler;
+    ASSERT_EQ(timer_16_bit_get_prescaler(DT_ID, &prescaler), TIMER_ERROR_OK);
+    ASSERT_EQ(prescaler, TIMER16BIT_CLK_PRESCALER_64);
+
+    /* 1 s : 10 periods, output pin toggles on each compare match and is high half of the time */
+    timer_16_bit_model_t model;
+    timer_16_bit_model_init(&model, &timer_16_bit_registers_stub);
+    timer_16_bit_model_run(&model, 16'000'000U);
+    ASSERT_EQ(model.ticks, 250'000U);
+    ASSERT_EQ(model.output_high_ticks[0], 125'000U);
+}
+
+static void model_compare_match_isr(void)
+{
+}
+
+TEST_F(Timer16BitFixture, test_model_ctc_tick_rate)
+{
+    timer_16_bit_model_t model;
+    timer_16_bit_model_init(&model, &timer_16_bit_registers_stub);
+    timer_16_bit_model_attach_isr(&model, TIMER_16_BIT_MODEL_VECTOR_COMPA, model_compare_match_isr);
+
+    const uint32_t cpu_freq = 16'000'000;
+    const uint32_t target_freqs[3] = {1'000, 440, 1};
+    const uint32_t simulated_seconds[3] = {1U, 1U, 2U};
+    for (uint8_t i = 0 ; i < 3U ; i++)
+    {
+        uint16_t accumulator = 0;
+        timer_16_bit_compute_matching_parameters(&cpu_freq, &target_freqs[i], &config.timing_config.prescaler,
+                                                 &config.timing_config.ocra_val, &accumulator);
+        ASSERT_EQ(accumulator, 0U);
+        config.timing_config.waveform_mode = TIMER16BIT_WG_CTC_OCRA_MAX;
+        config.interrupt_config.it_comp_match_a = true;
+        timer_error_t ret = timer_16_bit_reconfigure(DT_ID, &config);
+        ASSERT_EQ(ret, TIMER_ERROR_OK);
+        ret = timer_16_bit_start(DT_ID);
+        ASSERT_EQ(ret, TIMER_ERROR_OK);
+
+        model.isr_calls[TIMER_16_BIT_MODEL_VECTOR_COMPA] = 0U;
+        for (uint8_t second = 0 ; second < simulated_seconds[i] ; second++)
+        {
+            timer_16_bit_model_run(&model, cpu_freq);
+        }
+        ASSERT_EQ(model.isr_calls[TIMER_16_BIT_MODEL_VECTOR_COMPA], target_freqs[i] * simulated_seconds[i]);
+    }
+    ASSERT_EQ(model.isr_calls[TIMER_16_BIT_MODEL_VECTOR_OVF], 0U);
+}
+
+TEST_F(Timer16BitFixture, test_model_pwm_duty_cycle)
+{
+    /* Phase and frequency correct PWM, ICR is TOP : output is high during 2 x OCR timer clocks out of 2 x ICR */
+    const uint16_t top = 1000U;
+    config.timing_config.waveform_mode = TIMER16BIT_WG_PWM_PHASE_AND_FREQ_CORRECT_ICR_MAX;
+    config.timing_config.comp_match_b = TIMER16BIT_CMOD_CLEAR_OCnX;
+    config.timing_config.ocrb_val = 250U;
+    config.timing_config.prescaler = TIMER16BIT_CLK_PRESCALER_1;
+    config.interrupt_config.it_input_capture = true;
+    timer_error_t ret = timer_16_bit_init(DT_ID, &config);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    ret = timer_16_bit_set_input_capture_value(DT_ID, &top);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    ret = timer_16_bit_start(DT_ID);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+
+    timer_16_bit_model_t model;
+    timer_16_bit_model_init(&model, &timer_16_bit_registers_stub);
+    timer_16_bit_model_attach_isr(&model, TIMER_16_BIT_MODEL_VECTOR_CAPT, model_compare_match_isr);
+
+    /* Output pin only rises on the first down counting match : skip the first period */
+    timer_16_bit_model_run(&model, 2U * top);
+    model.ticks = 0U;
+    model.output_high_ticks[1] = 0U;
+    model.isr_calls[TIMER_16_BIT_MODEL_VECTOR_CAPT] = 0U;
+    timer_16_bit_model_run(&model, 2U * top * 100U);
+    ASSERT_EQ(model.ticks, 200'000U);
+    ASSERT_EQ(model.output_high_ticks[1], 50'000U);
+
+    /* ICF is raised once per period, when the counter reaches TOP */
+    ASSERT_EQ(model.isr_calls[TIMER_16_BIT_MODEL_VECTOR_CAPT], 100U);
+    ASSERT_EQ(model.isr_calls[TIMER_16_BIT_MODEL_VECTOR_OVF], 0U);
+
+    /* New compare value is only taken into account at BOTTOM */
+    const uint16_t ocrb = 500U;
+    ret = timer_16_bit_set_ocrb_register_value(DT_ID, &ocrb);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    timer_16_bit_model_run(&model, top);
+    ASSERT_EQ(model.ocrb, 250U);
+    timer_16_bit_model_run(&model, top);
+    ASSERT_EQ(model.ocrb, 500U);
+}
+
+static void model_dither_isr(void)
+{
+    timer_16_bit_dither_callback(DT_ID);
+}
+
+TEST_F(Timer16BitFixture, test_model_dithered_duty_cycle)
+{
+    /* 10 bits fast PWM, compare value is dithered from the overflow interrupt */
+    config.timing_config.waveform_mode = TIMER16BIT_WG_PWM_FAST_10_bit_FULL_RANGE;
+    config.timing_config.comp_match_a = TIMER16BIT_CMOD_CLEAR_OCnX;
+    config.timing_config.prescaler = TIMER16BIT_CLK_PRESCALER_1;
+    config.interrupt_config.it_timer_overflow = true;
+    timer_error_t ret = timer_16_bit_init(DT_ID, &config);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+
+    for (const timer_16_bit_dither_order_t order : {TIMER16BIT_DITHER_FIRST_ORDER, TIMER16BIT_DITHER_SECOND_ORDER})
+    {
+        const timer_16_bit_dither_config_t dither_config = {0x3FF, order, TIMER16BIT_DITHER_OUTPUT_A};
+        ret = timer_16_bit_dither_enable(DT_ID, &dither_config);
+        ASSERT_EQ(ret, TIMER_ERROR_OK);
+        ret = timer_16_bit_set_duty_hires(DT_ID, 0x1234);
+        ASSERT_EQ(ret, TIMER_ERROR_OK);
+        ret = timer_16_bit_start(DT_ID);
+        ASSERT_EQ(ret, TIMER_ERROR_OK);
+
+        timer_16_bit_model_t model;
+        timer_16_bit_model_init(&model, &timer_16_bit_registers_stub);
+        timer_16_bit_model_attach_isr(&model, TIMER_16_BIT_MODEL_VECTOR_OVF, model_dither_isr);
+
+        /* Compare values written by the ISR are loaded at the next BOTTOM : skip the first periods */
+        timer_16_bit_model_run(&model, 2U * 1024U);
+        model.ticks = 0U;
+        model.output_high_ticks[0] = 0U;
+        timer_16_bit_model_run(&model, 1024U * 1024U);
+        ASSERT_EQ(model.ticks, 1024U * 1024U);
+        ASSERT_EQ(model.isr_calls[TIMER_16_BIT_MODEL_VECTOR_OVF], 1026U);
+
+        /* Output is high during OCR + 1 timer clocks per period : 72.8125 + 1 counts on average */
+        ASSERT_LE(abs((int32_t) model.output_high_ticks[0] - (int32_t)(73.8125 * 1024)), 2);
+
+        ret = timer_16_bit_stop(DT_ID);
+        ASSERT_EQ(ret, TIMER_ERROR_OK);
+        timer_16_bit_registers_stub.TCNT_H = 0U;
+        timer_16_bit_registers_stub.TCNT_L = 0U;
+    }
+    ret = timer_16_bit_dither_disable(DT_ID);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -98,6 +98,8 @@ timer_error_t timer_16_bit_get_default_config(timer_16_bit_config_t * config);
 
 /**
  * @brief sets the handle of timer_16_bit driver
+ * Handle validity is checked once here : other functions return TIMER_ERROR_NULL_HANDLE as long as a complete handle is not set.
+ * When TIMER_16_BIT_STATIC_BINDING is defined, registers addresses are resolved at compile time and given handle is neither checked nor stored.
  * @param[in]   id     : targeted timer id (used to fetch internal configuration based on ids)
  * @param[in]   handle : handle to be copied into internal configuration
  * @return
@@ -170,20 +172,29 @@ timer_error_t timer_16_bit_set_interrupt_config(uint8_t id, timer_16_bit_interru
 */
 timer_error_t timer_16_bit_get_interrupt_config(uint8_t id, timer_16_bit_interrupt_config_t * it_config);
 
-#ifdef UNIT_TESTING
 /**
  * @brief reads the actual interrupt flags from internal memory and returns a copy of it
  * @param[in]   id       : targeted timer id (used to fetch internal configuration based on ids)
  * @param[in]   it_flags : container which holds the interrupt configuration
- * Note : this function reuses the interrupt configuration structure as it is only relevant for debugging
- * purposes and both interrupt enable flags and raised interrupt flags share the same register layout
+ * Note : this function reuses the interrupt configuration structure as both interrupt enable flags and raised interrupt flags
+ * share the same register layout. It is also used by input capture handling to detect a pending overflow.
  * @return
  *      TIMER_ERROR_OK             :   operation succeeded
  *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
  *      TIMER_ERROR_NULL_POINTER   :   given it_config parameter points to NULL
 */
 timer_error_t timer_16_bit_get_interrupt_flags(uint8_t id, timer_16_bit_interrupt_config_t * it_flags);
-#endif
+
+/**
+ * @brief clears the selected interrupt flags (flags set to true are cleared, others are left untouched)
+ * @param[in]   id       : targeted timer id (used to fetch internal configuration based on ids)
+ * @param[in]   it_flags : selects which flags have to be cleared
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
+ *      TIMER_ERROR_NULL_POINTER   :   given it_flags parameter points to NULL
+*/
+timer_error_t timer_16_bit_clear_interrupt_flags(uint8_t id, timer_16_bit_interrupt_config_t const * const it_flags);
 
 /**
  * @brief allows the usage of input capture noise canceler peripheral
@@ -326,7 +337,8 @@ timer_error_t timer_16_bit_set_waveform_generation(uint8_t id, const timer_16_bi
 timer_error_t timer_16_bit_get_waveform_generation(uint8_t id, timer_16_bit_waveform_generation_t * waveform);
 
 /**
- * @brief sets the targeted timer Output Compare A register value
+ * @brief sets the targeted timer Output Compare A register value.
+ * High and low bytes are written with interrupts masked, so this can be called while other timer ISRs are running
  * @param[in]   id    : targeted timer id (used to fetch internal configuration based on ids)
  * @param[in]   ocra  : actual OCRA value to be set
  * @return
@@ -346,7 +358,8 @@ timer_error_t timer_16_bit_set_ocra_register_value(uint8_t id, const uint16_t *
 timer_error_t timer_16_bit_get_ocra_register_value(uint8_t id, uint16_t * const ocra);
 
 /**
- * @brief sets the targeted timer Output Compare B register value
+ * @brief sets the targeted timer Output Compare B register value.
+ * High and low bytes are written with interrupts masked, so this can be called while other timer ISRs are running
  * @param[in]   id    : targeted timer id (used to fetch internal configuration based on ids)
  * @param[in]   ocrb  : actual OCRB value to be set
  * @return
@@ -372,7 +385,8 @@ timer_error_t timer_16_bit_get_ocrb_register_value(uint8_t id, uint16_t * const
 /* ################################ Counter register configuration ############################### */
 
 /**
- * @brief sets the targeted timer internal main counter
+ * @brief sets the targeted timer internal main counter.
+ * High and low bytes are written with interrupts masked, so this can be called while other timer ISRs are running
  * @param[in]   id    : targeted timer id (used to fetch internal configuration based on ids)
  * @param[in]   ticks : actual counter value to be set
  * @return
@@ -403,6 +417,17 @@ timer_error_t timer_16_bit_get_counter_value(uint8_t id, uint16_t * const ticks)
 */
 timer_error_t timer_16_bit_get_input_capture_value(uint8_t id, uint16_t * ticks);
 
+/**
+ * @brief sets the targeted timer internal input capture register value, which is used as TOP value by ICR based waveforms
+ * @param[in]   id    : targeted timer id (used to fetch internal configuration based on ids)
+ * @param[in]   ticks : value to be written into input capture register
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
+ *      TIMER_ERROR_NULL_POINTER   :   given pointer points to null
+*/
+timer_error_t timer_16_bit_set_input_capture_value(uint8_t id, const uint16_t * const ticks);
+
 
 /* ##############################################################################################################
    ################################ Timer API definition - timer manipulators ###################################
@@ -473,6 +498,113 @@ timer_error_t timer_16_bit_start(uint8_t id);
 */
 timer_error_t timer_16_bit_stop(uint8_t id);
 
+/**
+ * @brief starts a batch of configuration changes : control registers (TCCRA, TCCRB, TIMSK) are only updated in the driver's
+ * shadow copies by subsequent setters, until timer_16_bit_commit_update() is called.
+ * @param[in]   id     : targeted timer id (used to fetch internal configuration based on ids)
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
+ *      TIMER_ERROR_NULL_HANDLE    :   driver handle is not set
+*/
+timer_error_t timer_16_bit_begin_update(uint8_t id);
+
+/**
+ * @brief ends a batch of configuration changes : each modified control register is written once, with its final value
+ * @param[in]   id     : targeted timer id (used to fetch internal configuration based on ids)
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
+ *      TIMER_ERROR_NULL_HANDLE    :   driver handle is not set
+*/
+timer_error_t timer_16_bit_commit_update(uint8_t id);
+
+/**
+ * @brief outputs a square wave of the requested frequency on OCnA pin, in one call : CTC mode, OCnA toggle on compare match,
+ * prescaler and OCRA are selected and applied with a single write of the control registers (or batched along with other
+ * changes when called between timer_16_bit_begin_update() and timer_16_bit_commit_update()). Timer starts counting right away, even
+ * if it was stopped : timer_16_bit_init() shall have been called first.
+ * Can be called again at runtime to retune the output frequency.
+ * @param[in]   id                  : targeted timer id (used to fetch internal configuration based on ids)
+ * @param[in]   cpu_freq            : cpu frequency, in Hz
+ * @param[in]   frequency           : requested output frequency, in Hz
+ * @param[out]  achieved_frequency  : closest frequency the timer can generate, in Hz
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
+ *      TIMER_ERROR_NULL_POINTER   :   achieved_frequency parameter points to NULL
+ *      TIMER_ERROR_NULL_HANDLE    :   driver handle is not set
+ *      TIMER_ERROR_NOT_INITIALISED :   timer was not initialised, nothing was written
+ *      TIMER_ERROR_CONFIG         :   requested frequency is out of the timer's range
+*/
+timer_error_t timer_16_bit_generate_frequency(uint8_t id, const uint32_t cpu_freq, const uint32_t frequency, uint32_t * const achieved_frequency);
+
+/* ################################ High resolution duty cycle (dithering) ############################### */
+
+/**
+ * @brief selects the noise shaping order used to spread the setpoint fractional part over consecutive PWM periods
+*/
+typedef enum
+{
+    TIMER16BIT_DITHER_FIRST_ORDER  = 1U,    /**< Plain sigma-delta accumulator, quantization noise rises at 20 dB/decade      */
+    TIMER16BIT_DITHER_SECOND_ORDER = 2U,    /**< Quantization noise rises at 40 dB/decade, less ripple after the output filter */
+} timer_16_bit_dither_order_t;
+
+#define TIMER16BIT_DITHER_OUTPUT_A (0x01)   /**< Dithered duty cycle is written to OCRA */
+#define TIMER16BIT_DITHER_OUTPUT_B (0x02)   /**< Dithered duty cycle is written to OCRB */
+
+/**
+ * @brief dithering engine configuration
+*/
+typedef struct
+{
+    uint16_t top;                       /**< TOP value of the selected PWM mode (e.g. 0x3FF for 10 bits fast PWM)         */
+    timer_16_bit_dither_order_t order;  /**< Noise shaping order                                                          */
+    uint8_t outputs;                    /**< Compare registers driven by the engine (TIMER16BIT_DITHER_OUTPUT_x flags)    */
+} timer_16_bit_dither_config_t;
+
+/**
+ * @brief enables the dithering engine of selected timer : once per PWM period, timer_16_bit_dither_callback() writes
+ * either floor or ceil of the requested duty cycle to the selected compare registers, so that the average duty cycle
+ * reaches the 16 bits resolution of the setpoint. Timer shall already be configured in a PWM mode with double buffered OCRx registers.
+ * @param[in]   id     : targeted timer id (used to fetch internal configuration based on ids)
+ * @param[in]   config : dithering engine configuration
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
+ *      TIMER_ERROR_NULL_POINTER   :   given config parameter points to NULL
+ *      TIMER_ERROR_NULL_HANDLE    :   driver handle is not set
+ *      TIMER_ERROR_CONFIG         :   unknown order, no output selected or TOP is null
+*/
+timer_error_t timer_16_bit_dither_enable(uint8_t id, timer_16_bit_dither_config_t const * const config);
+
+/**
+ * @brief disables the dithering engine, compare registers keep the last written value
+ * @param[in]   id     : targeted timer id (used to fetch internal configuration based on ids)
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
+*/
+timer_error_t timer_16_bit_dither_disable(uint8_t id);
+
+/**
+ * @brief sets the high resolution duty cycle setpoint, used from the next PWM period on
+ * @param[in]   id     : targeted timer id (used to fetch internal configuration based on ids)
+ * @param[in]   duty   : duty cycle setpoint, average compare value is duty / 65536 * (TOP + 1)
+ * @return
+ *      TIMER_ERROR_OK              :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER   :   given id is out of range
+ *      TIMER_ERROR_NOT_INITIALISED :   dithering engine is not enabled
+*/
+timer_error_t timer_16_bit_set_duty_hires(uint8_t id, const uint16_t duty);
+
+/**
+ * @brief A callback to be used within the timer overflow ISR (e.g. TIMER1_OVF_vect) which computes and writes
+ * the compare value of the next PWM period. Does nothing while the dithering engine is disabled.
+ * @param[in]   id     : targeted timer id (used to fetch internal configuration based on ids)
+*/
+void timer_16_bit_dither_callback(uint8_t id);
+
 #define TIMER_16_BIT_MAX_PRESCALER_COUNT (5U)
 
 
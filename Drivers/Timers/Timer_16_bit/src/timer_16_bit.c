@@ -30,23 +30,100 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "config.h"
 #include "timer_16_bit.h"
+#include "critical_section.h"
 
 #include <stddef.h>
 #include <string.h>
 
+#ifndef UNIT_TESTING
+    #include <avr/io.h>
+    #include <avr/interrupt.h>
+#endif
+
 #ifndef TIMER_16_BIT_COUNT
     #error "TIMER_16_BIT_COUNT is not defined. Please add #define TIMER_16_BIT_COUNT n in config.h to use this timer"
 #elif TIMER_16_BIT_COUNT == 0
     #warning "TIMER_16_BIT_COUNT is set to 0. If you don't project to use this timer, refer to not compile this file instead of setting this define to 0"
 #endif
 
+/* When TIMER_16_BIT_STATIC_BINDING is defined in config.h, registers addresses are resolved at compile time instead of being
+   fetched from the handle stored at runtime. The binding is only ever read with constant offsets so every register access
+   folds into a direct I/O instruction and no handle is kept in RAM, which restricts static binding to a single instance.
+   Default binding targets the ATmega328P Timer/Counter 1, another one can be provided through TIMER_16_BIT_STATIC_HANDLE.
+   Unit tests always rely on the runtime handle. */
+#if defined(TIMER_16_BIT_STATIC_BINDING) && !defined(UNIT_TESTING)
+    #include <avr/io.h>
+    #if TIMER_16_BIT_COUNT != 1
+        #error "TIMER_16_BIT_STATIC_BINDING only supports a single timer, please set TIMER_16_BIT_COUNT to 1"
+    #endif
+    #ifndef TIMER_16_BIT_STATIC_HANDLE
+        #define TIMER_16_BIT_STATIC_HANDLE { .TCCRA = &TCCR1A, .TCCRB = &TCCR1B, .TCCRC = &TCCR1C,                     \
+                                             .TCNT_H = &TCNT1H, .TCNT_L = &TCNT1L, .OCRA_H = &OCR1AH, .OCRA_L = &OCR1AL, \
+                                             .OCRB_H = &OCR1BH, .OCRB_L = &OCR1BL, .ICR_H = &ICR1H, .ICR_L = &ICR1L,     \
+                                             .TIMSK = &TIMSK1, .TIFR = &TIFR1 }
+    #endif
+    #define USE_STATIC_BINDING
+    static const timer_16_bit_handle_t static_handle = TIMER_16_BIT_STATIC_HANDLE;
+    #define HANDLE(id) (*((void) (id), &static_handle))
+#else
+    #define HANDLE(id) (internal_config[(id)].handle)
+#endif
+
 static struct
 {
+#ifndef USE_STATIC_BINDING
     timer_16_bit_handle_t handle;
+    bool handle_is_valid;
+#endif
+    timer_generic_shadow_t shadow;
     timer_16_bit_prescaler_selection_t prescaler;
     bool is_initialised;
 } internal_config[TIMER_16_BIT_COUNT] = {0};
 
+/* Dithering engine state : setpoint is split in an integer compare value and a 16 bits fraction when it is set,
+   so that the overflow ISR only performs additions */
+static struct
+{
+    timer_16_bit_dither_config_t config;
+    uint16_t whole;         /**< Integer part of the requested compare value                    */
+    uint16_t fraction;      /**< Fractional part of the requested compare value (1/65536 units) */
+    int32_t error[2];       /**< Second order quantization errors, e[n-1] and e[n-2]            */
+    uint16_t accumulator;   /**< First order phase accumulator                                  */
+    bool enabled;
+} dither[TIMER_16_BIT_COUNT] = {0};
+
+#define SHADOW(id) (internal_config[(id)].shadow)
+
+/* 16 bits registers are accessed through a single TEMP register shared by all 16 bits registers of the timer.
+   An ISR accessing another 16 bits register between the two byte accesses would corrupt the TEMP content,
+   so both bytes are accessed with interrupts disabled, and the previous interrupt state is restored afterwards */
+
+/**
+ * @brief writes a 16 bits register : high byte is written first (latched in TEMP), low byte write triggers the 16 bits transfer
+*/
+static inline void write_16_bit_register(volatile uint8_t * const high, volatile uint8_t * const low, const uint16_t value)
+{
+    uint8_t sreg = 0;
+    CRITICAL_SECTION_ENTER(sreg);
+    *high = (uint8_t)((value & 0xFF00) >> 8U);
+    *low = (uint8_t)(value & 0xFF);
+    CRITICAL_SECTION_EXIT(sreg);
+}
+
+/**
+ * @brief reads a 16 bits register : low byte is read first (which latches high byte in TEMP), then high byte
+*/
+static inline uint16_t read_16_bit_register(volatile uint8_t * const high, volatile uint8_t * const low)
+{
+    uint8_t sreg = 0;
+    uint16_t value = 0;
+    CRITICAL_SECTION_ENTER(sreg);
+    value = *low;
+    value |= (uint16_t)(*high) << 8U;
+    CRITICAL_SECTION_EXIT(sreg);
+    return value;
+}
+
 const timer_generic_prescaler_pair_t timer_16_bit_prescaler_table[TIMER_16_BIT_MAX_PRESCALER_COUNT] =
 {
     {.value = 1,        .type = (uint8_t) TIMER16BIT_CLK_PRESCALER_1    },
@@ -148,6 +225,36 @@ static inline timer_error_t check_id(uint8_t id)
     return TIMER_ERROR_OK;
 }
 
+/**
+ * @brief checks the handle stored for this timer, validity is evaluated once when the handle is set
+*/
+static inline timer_error_t check_stored_handle(const uint8_t id)
+{
+#ifdef USE_STATIC_BINDING
+    (void) id;
+    return TIMER_ERROR_OK;
+#else
+    if (false == internal_config[id].handle_is_valid)
+    {
+        return TIMER_ERROR_NULL_HANDLE;
+    }
+    return TIMER_ERROR_OK;
+#endif
+}
+
+/**
+ * @brief marks shadow registers as modified and writes them to the device, unless changes are batched
+ * using timer_16_bit_begin_update()
+*/
+static inline void update_registers(const uint8_t id, const uint8_t registers)
+{
+    SHADOW(id).dirty |= registers;
+    if (false == SHADOW(id).deferred)
+    {
+        timer_generic_shadow_commit(&SHADOW(id), HANDLE(id).TCCRA, HANDLE(id).TCCRB, HANDLE(id).TIMSK);
+    }
+}
+
 timer_error_t timer_16_bit_set_handle(uint8_t id, timer_16_bit_handle_t * const handle)
 {
     timer_error_t ret = check_id(id);
@@ -161,7 +268,18 @@ timer_error_t timer_16_bit_set_handle(uint8_t id, timer_16_bit_handle_t * const
         return TIMER_ERROR_NULL_POINTER;
     }
 
+#ifdef USE_STATIC_BINDING
+    /* Registers are bound at compile time, given handle is not stored */
+    (void) handle;
+#else
     memcpy(&internal_config[id].handle, handle, sizeof(timer_16_bit_handle_t));
+    internal_config[id].handle_is_valid = (TIMER_ERROR_OK == check_handle(handle));
+    if (false == internal_config[id].handle_is_valid)
+    {
+        return ret;
+    }
+#endif
+    timer_generic_shadow_load(&SHADOW(id), HANDLE(id).TCCRA, HANDLE(id).TCCRB, HANDLE(id).TIMSK, 0U);
     return ret;
 }
 
@@ -178,7 +296,24 @@ timer_error_t timer_16_bit_get_handle(uint8_t id, timer_16_bit_handle_t * const
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    memcpy(handle, &internal_config[id].handle, sizeof(timer_16_bit_handle_t));
+#ifdef USE_STATIC_BINDING
+    /* Field by field copy lets each address fold into an immediate store instead of copying the binding from memory */
+    handle->TCCRA  = HANDLE(id).TCCRA;
+    handle->TCCRB  = HANDLE(id).TCCRB;
+    handle->TCCRC  = HANDLE(id).TCCRC;
+    handle->TCNT_H = HANDLE(id).TCNT_H;
+    handle->TCNT_L = HANDLE(id).TCNT_L;
+    handle->OCRA_H = HANDLE(id).OCRA_H;
+    handle->OCRA_L = HANDLE(id).OCRA_L;
+    handle->OCRB_H = HANDLE(id).OCRB_H;
+    handle->OCRB_L = HANDLE(id).OCRB_L;
+    handle->ICR_H  = HANDLE(id).ICR_H;
+    handle->ICR_L  = HANDLE(id).ICR_L;
+    handle->TIMSK  = HANDLE(id).TIMSK;
+    handle->TIFR   = HANDLE(id).TIFR;
+#else
+    memcpy(handle, &HANDLE(id), sizeof(timer_16_bit_handle_t));
+#endif
     return ret;
 }
 
@@ -245,31 +380,17 @@ timer_error_t timer_16_bit_set_force_compare_config(uint8_t id, timer_16_bit_for
     }
 
     /* Not fully configured handle, do not attempt to write to it until configured !*/
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
     /* Handles force output compare A flags */
-    if (true == force_comp_config->force_comp_match_a)
-    {
-        *(internal_config[id].handle.TCCRC) |= FOCA_MSK ;
-    }
-    else
-    {
-        *(internal_config[id].handle.TCCRC) &=  ~FOCA_MSK ;
-    }
+    timer_generic_reg_write_flag(HANDLE(id).TCCRC, FOCA_MSK, force_comp_config->force_comp_match_a);
 
     /* Handles force output compare A flags */
-    if (true == force_comp_config->force_comp_match_b)
-    {
-        *(internal_config[id].handle.TCCRC) |= FOCB_MSK ;
-    }
-    else
-    {
-        *(internal_config[id].handle.TCCRC) &=  ~FOCB_MSK ;
-    }
+    timer_generic_reg_write_flag(HANDLE(id).TCCRC, FOCB_MSK, force_comp_config->force_comp_match_b);
     return ret;
 }
 
@@ -285,31 +406,17 @@ timer_error_t timer_16_bit_get_force_compare_config(uint8_t id, timer_16_bit_for
         return TIMER_ERROR_NULL_POINTER;
     }
     /* Not fully configured handle, do not attempt to write to it until configured !*/
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
     /* Handles Force Compare Output A flag */
-    if (0U == (*(internal_config[id].handle.TCCRC) & FOCA_MSK))
-    {
-        force_comp_config->force_comp_match_a = false;
-    }
-    else
-    {
-        force_comp_config->force_comp_match_a = true;
-    }
+    force_comp_config->force_comp_match_a = timer_generic_reg_read_flag(HANDLE(id).TCCRC, FOCA_MSK);
 
     /* Handles Force Compare Output B flag */
-    if (0U == (*(internal_config[id].handle.TCCRC) & FOCB_MSK))
-    {
-        force_comp_config->force_comp_match_b = false;
-    }
-    else
-    {
-        force_comp_config->force_comp_match_b = true;
-    }
+    force_comp_config->force_comp_match_b = timer_generic_reg_read_flag(HANDLE(id).TCCRC, FOCB_MSK);
     return ret;
 }
 
@@ -326,51 +433,24 @@ timer_error_t timer_16_bit_set_interrupt_config(uint8_t id, timer_16_bit_interru
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
     /* Input capture interrupt enable bit */
-    if (true == it_config->it_input_capture)
-    {
-        *(internal_config[id].handle.TIMSK) |= ICIE_MSK;
-    }
-    else
-    {
-        *(internal_config[id].handle.TIMSK) &= ~ICIE_MSK;
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, ICIE_MSK, it_config->it_input_capture);
 
     /* TIMSK register */
-    if (true == it_config->it_comp_match_a)
-    {
-        *(internal_config[id].handle.TIMSK) |= OCIEA_MSK;
-    }
-    else
-    {
-        *(internal_config[id].handle.TIMSK) &= ~OCIEA_MSK;
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, OCIEA_MSK, it_config->it_comp_match_a);
 
-    if (true == it_config->it_comp_match_b)
-    {
-        *(internal_config[id].handle.TIMSK) |= OCIEB_MSK;
-    }
-    else
-    {
-        *(internal_config[id].handle.TIMSK) &= ~OCIEB_MSK;
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, OCIEB_MSK, it_config->it_comp_match_b);
 
     /* TOIE interrupt flag is the first bit, no need to bitshift it */
-    if (true == it_config->it_timer_overflow)
-    {
-        *(internal_config[id].handle.TIMSK) |= TOIE_MSK;
-    }
-    else
-    {
-        *(internal_config[id].handle.TIMSK) &= ~TOIE_MSK;
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, TOIE_MSK, it_config->it_timer_overflow);
 
+    update_registers(id, TIMER_GENERIC_SHADOW_TIMSK);
     return ret;
 }
 
@@ -388,55 +468,26 @@ timer_error_t timer_16_bit_get_interrupt_config(uint8_t id, timer_16_bit_interru
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
     /* Input capture interrupt enable flag */
-    if (0U == (*(internal_config[id].handle.TIMSK) & ICIE_MSK))
-    {
-        it_config->it_input_capture = false;
-    }
-    else
-    {
-        it_config->it_input_capture = true;
-    }
+    it_config->it_input_capture = timer_generic_read_flag(&SHADOW(id).TIMSK, ICIE_MSK);
 
     /* Output Compare Match A Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIMSK) & OCIEA_MSK))
-    {
-        it_config->it_comp_match_a = false;
-    }
-    else
-    {
-        it_config->it_comp_match_a = true;
-    }
+    it_config->it_comp_match_a = timer_generic_read_flag(&SHADOW(id).TIMSK, OCIEA_MSK);
 
     /* Output Compare Match B Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIMSK) & OCIEB_MSK))
-    {
-        it_config->it_comp_match_b = false;
-    }
-    else
-    {
-        it_config->it_comp_match_b = true;
-    }
+    it_config->it_comp_match_b = timer_generic_read_flag(&SHADOW(id).TIMSK, OCIEB_MSK);
 
     /* Timer Overflow Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIMSK) & TOV_MSK))
-    {
-        it_config->it_timer_overflow = false;
-    }
-    else
-    {
-        it_config->it_timer_overflow = true;
-    }
+    it_config->it_timer_overflow = timer_generic_read_flag(&SHADOW(id).TIMSK, TOV_MSK);
     return ret;
 }
 
-#ifdef UNIT_TESTING
 timer_error_t timer_16_bit_get_interrupt_flags(uint8_t id, timer_16_bit_interrupt_config_t * it_flags)
 {
     timer_error_t ret = check_id(id);
@@ -450,56 +501,70 @@ timer_error_t timer_16_bit_get_interrupt_flags(uint8_t id, timer_16_bit_interrup
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
     /* Input capture interrupt flag  */
-    if (0U == (*(internal_config[id].handle.TIFR) & ICF_MSK))
-    {
-        it_flags->it_input_capture = false;
-    }
-    else
+    it_flags->it_input_capture = timer_generic_reg_read_flag(HANDLE(id).TIFR, ICF_MSK);
+
+    /* Output Compare Match A Interrupt Flag */
+    it_flags->it_comp_match_a = timer_generic_reg_read_flag(HANDLE(id).TIFR, OCIEA_MSK);
+
+    /* Output Compare Match B Interrupt Flag */
+    it_flags->it_comp_match_b = timer_generic_reg_read_flag(HANDLE(id).TIFR, OCIEB_MSK);
+
+    /* Timer Overflow Interrupt Flag */
+    it_flags->it_timer_overflow = timer_generic_reg_read_flag(HANDLE(id).TIFR, TOV_MSK);
+
+    return ret;
+
+}
+
+timer_error_t timer_16_bit_clear_interrupt_flags(uint8_t id, timer_16_bit_interrupt_config_t const * const it_flags)
+{
+    timer_error_t ret = check_id(id);
+    if (TIMER_ERROR_OK != ret)
     {
-        it_flags->it_input_capture = true;
+        return ret;
     }
 
-    /* Output Compare Match A Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIFR) & OCIEA_MSK))
+    if (NULL == it_flags)
     {
-        it_flags->it_comp_match_a = false;
+        return TIMER_ERROR_NULL_POINTER;
     }
-    else
+
+    ret = check_stored_handle(id);
+    if (TIMER_ERROR_OK != ret)
     {
-        it_flags->it_comp_match_a = true;
+        return ret;
     }
 
-    /* Output Compare Match B Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIFR) & OCIEB_MSK))
+    /* Flags are cleared by writing a logical one to them : only write selected bits, as a read-modify-write
+    operation would clear all pending flags at once */
+    uint8_t mask = 0U;
+    if (true == it_flags->it_input_capture)
     {
-        it_flags->it_comp_match_b = false;
+        mask |= ICF_MSK;
     }
-    else
+    if (true == it_flags->it_comp_match_a)
     {
-        it_flags->it_comp_match_b = true;
+        mask |= OCFA_MSK;
     }
-
-    /* Timer Overflow Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIFR) & TOV_MSK))
+    if (true == it_flags->it_comp_match_b)
     {
-        it_flags->it_timer_overflow = false;
+        mask |= OCFB_MSK;
     }
-    else
+    if (true == it_flags->it_timer_overflow)
     {
-        it_flags->it_timer_overflow = true;
+        mask |= TOV_MSK;
     }
-
+    *(HANDLE(id).TIFR) = mask;
     return ret;
-
 }
-#endif
+
 
 
 
@@ -511,13 +576,14 @@ timer_error_t timer_16_bit_set_prescaler(uint8_t id, const timer_16_bit_prescale
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *(internal_config[id].handle.TCCRB) = (*(internal_config[id].handle.TCCRB) & ~CS_MSK) | prescaler;
+    timer_generic_write_field(&SHADOW(id).TCCRB, CS_MSK, prescaler);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRB);
     return ret;
 }
 
@@ -534,13 +600,13 @@ timer_error_t timer_16_bit_get_prescaler(uint8_t id, timer_16_bit_prescaler_sele
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *prescaler = (*(internal_config[id].handle.TCCRB) & CS_MSK);
+    *prescaler = (SHADOW(id).TCCRB & CS_MSK);
     return ret;
 }
 
@@ -552,13 +618,14 @@ timer_error_t timer_16_bit_set_compare_match_A(uint8_t id, const timer_16_bit_co
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *(internal_config[id].handle.TCCRA) = (*(internal_config[id].handle.TCCRA) & ~COMA_MSK) | (compA << COMA0_BIT);
+    timer_generic_write_field(&SHADOW(id).TCCRA, COMA_MSK, compA << COMA0_BIT);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRA);
     return ret;
 }
 
@@ -575,13 +642,13 @@ timer_error_t timer_16_bit_get_compare_match_A(uint8_t id, timer_16_bit_compare_
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *compA = ((*(internal_config[id].handle.TCCRA) & COMA_MSK) >> COMA0_BIT);
+    *compA = ((SHADOW(id).TCCRA & COMA_MSK) >> COMA0_BIT);
     return ret;
 }
 
@@ -593,13 +660,14 @@ timer_error_t timer_16_bit_set_compare_match_B(uint8_t id, timer_16_bit_compare_
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *(internal_config[id].handle.TCCRA) = (*(internal_config[id].handle.TCCRA) & ~COMB_MSK) | (compB << COMB0_BIT);
+    timer_generic_write_field(&SHADOW(id).TCCRA, COMB_MSK, compB << COMB0_BIT);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRA);
     return ret;
 }
 
@@ -616,13 +684,13 @@ timer_error_t timer_16_bit_get_compare_match_B(uint8_t id, timer_16_bit_compare_
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *compB = ((*(internal_config[id].handle.TCCRA) & COMB_MSK) >> COMB0_BIT);
+    *compB = ((SHADOW(id).TCCRA & COMB_MSK) >> COMB0_BIT);
     return ret;
 }
 
@@ -634,15 +702,14 @@ timer_error_t timer_16_bit_set_waveform_generation(uint8_t id, const timer_16_bi
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *(internal_config[id].handle.TCCRA) = (*(internal_config[id].handle.TCCRA) & ~(WGM0_MSK | WGM1_MSK)) | (waveform & (WGM0_MSK | WGM1_MSK));
-    /* Select bit index 2 and 3 (0x3 -> 0b11) of waveform mode (matches datasheet bit mapping) and store it to bit index 3 of TCCRB with one more bitshift */
-    *(internal_config[id].handle.TCCRB) = (*(internal_config[id].handle.TCCRB) & ~(WGM2_MSK | WGM3_MSK)) | ((waveform & 0x0C) << 1U);
+    timer_generic_set_waveform(&SHADOW(id).TCCRA, &SHADOW(id).TCCRB, waveform, WGM2_MSK | WGM3_MSK);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRA | TIMER_GENERIC_SHADOW_TCCRB);
     return ret;
 }
 
@@ -655,21 +722,15 @@ timer_error_t timer_16_bit_set_input_compare_noise_canceler(uint8_t id, const bo
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    if (enabled)
-    {
-        *(internal_config[id].handle.TCCRB) |= INC_MSK;
-    }
-    else
-    {
-        *(internal_config[id].handle.TCCRB) &= ~INC_MSK;
-    }
+    timer_generic_write_flag(&SHADOW(id).TCCRB, INC_MSK, enabled);
 
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRB);
     return ret;
 }
 
@@ -686,13 +747,13 @@ timer_error_t timer_16_bit_get_input_compare_noise_canceler(uint8_t id, bool * c
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *enabled = ((*(internal_config[id].handle.TCCRB) & INC_MSK) != 0U);
+    *enabled = ((SHADOW(id).TCCRB & INC_MSK) != 0U);
     return ret;
 }
 
@@ -704,13 +765,14 @@ timer_error_t timer_16_bit_set_input_compare_edge_select(uint8_t id, const timer
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *(internal_config[id].handle.TCCRB) =  (*(internal_config[id].handle.TCCRB) & ~ICES_MSK) | (edge << ICES_BIT);
+    timer_generic_write_field(&SHADOW(id).TCCRB, ICES_MSK, edge << ICES_BIT);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRB);
     return ret;
 }
 
@@ -727,13 +789,13 @@ timer_error_t timer_16_bit_get_input_compare_edge_select(uint8_t id, timer_16_bi
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    if (0 !=  (*(internal_config[id].handle.TCCRB) & ICES_MSK))
+    if (0 !=  (SHADOW(id).TCCRB & ICES_MSK))
     {
         *edge = TIMER16BIT_INPUT_CAPTURE_EDGE_RISING_EDGE;
     }
@@ -757,14 +819,36 @@ timer_error_t timer_16_bit_get_input_capture_value(uint8_t id, uint16_t * ticks)
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *ticks  = *(internal_config[id].handle.TCNT_L);
-    *ticks |= *(internal_config[id].handle.TCNT_H) << 8U;
+    *ticks = read_16_bit_register(HANDLE(id).ICR_H, HANDLE(id).ICR_L);
+    return ret;
+}
+
+timer_error_t timer_16_bit_set_input_capture_value(uint8_t id, const uint16_t * const ticks)
+{
+    timer_error_t ret = check_id(id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == ticks)
+    {
+        return TIMER_ERROR_NULL_POINTER;
+    }
+
+    ret = check_stored_handle(id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    write_16_bit_register(HANDLE(id).ICR_H, HANDLE(id).ICR_L, *ticks);
     return ret;
 }
 
@@ -782,15 +866,13 @@ timer_error_t timer_16_bit_get_waveform_generation(uint8_t id, timer_16_bit_wave
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *waveform = (timer_16_bit_waveform_generation_t)(0U);
-    *waveform |= (*(internal_config[id].handle.TCCRA) & (WGM0_MSK | WGM1_MSK));
-    *waveform |= (*(internal_config[id].handle.TCCRB) & (WGM2_MSK | WGM3_MSK)) >> 1U;
+    *waveform = (timer_16_bit_waveform_generation_t) timer_generic_get_waveform(&SHADOW(id).TCCRA, &SHADOW(id).TCCRB, WGM2_MSK | WGM3_MSK);
     return ret;
 }
 
@@ -802,15 +884,14 @@ timer_error_t timer_16_bit_set_counter_value(uint8_t id, const uint16_t * const
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
     /* Write new value to internal timer/counter register */
-    *(internal_config[id].handle.TCNT_L) = *ticks & 0xFF;
-    *(internal_config[id].handle.TCNT_H) = (*ticks & 0xFF00) >> 8U;
+    write_16_bit_register(HANDLE(id).TCNT_H, HANDLE(id).TCNT_L, *ticks);
 
     return ret;
 }
@@ -828,15 +909,14 @@ timer_error_t timer_16_bit_get_counter_value(uint8_t id, uint16_t * const ticks)
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
     /* Transfer data from internal device's timer/count main register */
-    *ticks  = (*internal_config[id].handle.TCNT_L);
-    *ticks |= (*internal_config[id].handle.TCNT_H) << 8U;
+    *ticks = read_16_bit_register(HANDLE(id).TCNT_H, HANDLE(id).TCNT_L);
     return ret;
 }
 
@@ -848,14 +928,13 @@ timer_error_t timer_16_bit_set_ocra_register_value(uint8_t id, const uint16_t *
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *(internal_config[id].handle.OCRA_H) = (*ocra & 0xFF00) >> 8U;
-    *(internal_config[id].handle.OCRA_L) = (*ocra & 0xFF);
+    write_16_bit_register(HANDLE(id).OCRA_H, HANDLE(id).OCRA_L, *ocra);
     return ret;
 }
 
@@ -872,14 +951,13 @@ timer_error_t timer_16_bit_get_ocra_register_value(uint8_t id, uint16_t * const
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *ocra  = (*internal_config[id].handle.OCRA_L);
-    *ocra |= (*internal_config[id].handle.OCRA_H << 8U);
+    *ocra = read_16_bit_register(HANDLE(id).OCRA_H, HANDLE(id).OCRA_L);
     return ret;
 }
 
@@ -891,14 +969,13 @@ timer_error_t timer_16_bit_set_ocrb_register_value(uint8_t id, const uint16_t *
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *internal_config[id].handle.OCRB_H = (*ocrb & 0xFF00) >> 8U;
-    *internal_config[id].handle.OCRB_L = (*ocrb & 0xFF);;
+    write_16_bit_register(HANDLE(id).OCRB_H, HANDLE(id).OCRB_L, *ocrb);
     return ret;
 }
 
@@ -915,21 +992,20 @@ timer_error_t timer_16_bit_get_ocrb_register_value(uint8_t id, uint16_t * const
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *ocrb =  (*internal_config[id].handle.OCRB_L);
-    *ocrb |= (*internal_config[id].handle.OCRB_H << 8U);
+    *ocrb = read_16_bit_register(HANDLE(id).OCRB_H, HANDLE(id).OCRB_L);
     return ret;
 }
 
 static timer_error_t timer_16_bit_write_config(uint8_t id, timer_16_bit_config_t * const config)
 {
     timer_error_t ret = TIMER_ERROR_OK;
-    timer_16_bit_handle_t * handle = &internal_config[id].handle;
+    timer_16_bit_handle_t const * handle = &HANDLE(id);
 
     internal_config[id].prescaler = config->timing_config.prescaler;
 
@@ -937,85 +1013,46 @@ static timer_error_t timer_16_bit_write_config(uint8_t id, timer_16_bit_config_t
     *(handle->TIFR) = 0U;
 
     /* Initialise counter as well */
-    *(handle->TCNT_H) = (config->timing_config.counter & 0xFF00) >> 8U;
-    *(handle->TCNT_L) = (config->timing_config.counter & 0xFF);
+    write_16_bit_register(handle->TCNT_H, handle->TCNT_L, config->timing_config.counter);
 
     /* Clear TCCRA register first, otherwise we can't reconfigure the OCRA/OCRB regs!*/
 	*(handle->TCCRA) = 0;
 
     /* TCCRA register */
-    *(handle->OCRA_H) = (config->timing_config.ocra_val & 0xFF00) >> 8U;
-    *(handle->OCRA_L) = (config->timing_config.ocra_val & 0xFF);
-    *(handle->OCRB_H) = (config->timing_config.ocrb_val & 0xFF00) >> 8U;
-    *(handle->OCRB_L) = (config->timing_config.ocrb_val & 0xFF);
-    *(handle->TCCRA) = (*(handle->TCCRA) & ~COMA_MSK) | (config->timing_config.comp_match_a << COMA0_BIT);
-    *(handle->TCCRA) = (*(handle->TCCRA) & ~COMB_MSK) | (config->timing_config.comp_match_b << COMB0_BIT);
-    *(handle->TCCRA) = (*(handle->TCCRA) & ~(WGM0_MSK | WGM1_MSK)) | (config->timing_config.waveform_mode & (WGM0_MSK | WGM1_MSK));
+    write_16_bit_register(handle->OCRA_H, handle->OCRA_L, config->timing_config.ocra_val);
+    write_16_bit_register(handle->OCRB_H, handle->OCRB_L, config->timing_config.ocrb_val);
+    /* Control registers are composed in the shadow copies, then written once each */
+    SHADOW(id).TCCRA = 0U;
+    SHADOW(id).TCCRB = 0U;
+    SHADOW(id).TIMSK = 0U;
+    timer_generic_write_field(&SHADOW(id).TCCRA, COMA_MSK, config->timing_config.comp_match_a << COMA0_BIT);
+    timer_generic_write_field(&SHADOW(id).TCCRA, COMB_MSK, config->timing_config.comp_match_b << COMB0_BIT);
+    timer_generic_set_waveform(&SHADOW(id).TCCRA, &SHADOW(id).TCCRB, config->timing_config.waveform_mode, WGM2_MSK | WGM3_MSK);
 
     /* TCCRB register */
-    /* Select bit index 2 of waveform mode (matches datasheet bit mapping) and store it to bit index 3 of TCCRB with one more bitshift */
-    *(handle->TCCRB) = (*(handle->TCCRB) & ~(WGM2_MSK | WGM3_MSK)) | ((config->timing_config.waveform_mode & (0x3U << 2U)) << 1U);
-    *(handle->TCCRB) = (*(handle->TCCRB) & ~ICES_MSK) | (config->input_capture.edge_select << ICES_BIT);
-
-    if(true == config->input_capture.use_noise_canceler)
-    {
-        *(handle->TCCRB) |= INC_MSK;
-    }
-    else
-    {
-        *(handle->TCCRB) &= ~INC_MSK;
-    }
-
-    /* Handles force output compare A flags */
-    if (true == config->force_compare.force_comp_match_a)
-    {
-        *(handle->TCCRC) |= FOCA_MSK;
-    }
-    else
-    {
-        *(handle->TCCRC) &=  ~FOCA_MSK;
-    }
+    timer_generic_write_field(&SHADOW(id).TCCRB, ICES_MSK, config->input_capture.edge_select << ICES_BIT);
 
-    /* Handles force output compare A flags */
-    if (true == config->force_compare.force_comp_match_b)
-    {
-        *(handle->TCCRC) |= FOCB_MSK ;
-    }
-    else
-    {
-        *(handle->TCCRC) &=  ~FOCB_MSK ;
-    }
+    timer_generic_write_flag(&SHADOW(id).TCCRB, INC_MSK, config->input_capture.use_noise_canceler);
 
     /* NOTE : Do not handle prescaler until timer is manually started using timer_16_bit_start(id)*/
 
     /* TIMSK register */
-    if (true == config->interrupt_config.it_comp_match_a)
-    {
-        *(handle->TIMSK) |= OCIEA_MSK;
-    }
-    else
-    {
-        *(handle->TIMSK) &= ~OCIEA_MSK;
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, ICIE_MSK, config->interrupt_config.it_input_capture);
 
-    if (true == config->interrupt_config.it_comp_match_b)
-    {
-        *(handle->TIMSK) |= OCIEB_MSK;
-    }
-    else
-    {
-        *(handle->TIMSK) &= ~OCIEB_MSK;
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, OCIEA_MSK, config->interrupt_config.it_comp_match_a);
+
+    timer_generic_write_flag(&SHADOW(id).TIMSK, OCIEB_MSK, config->interrupt_config.it_comp_match_b);
 
     /* TOIE interrupt flag is the first bit, no need to bitshift it */
-    if (true == config->interrupt_config.it_timer_overflow)
-    {
-        *(handle->TIMSK) |= TOV_MSK;
-    }
-    else
-    {
-        *(handle->TIMSK) &= ~TOV_MSK;
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, TOV_MSK, config->interrupt_config.it_timer_overflow);
+
+    SHADOW(id).dirty = TIMER_GENERIC_SHADOW_TCCRA | TIMER_GENERIC_SHADOW_TCCRB | TIMER_GENERIC_SHADOW_TIMSK;
+    SHADOW(id).deferred = false;
+    timer_generic_shadow_commit(&SHADOW(id), handle->TCCRA, handle->TCCRB, handle->TIMSK);
+
+    /* Handles force output compare flags, TCCRC only holds strobes and is not shadowed */
+    timer_generic_reg_write_flag(handle->TCCRC, FOCA_MSK, config->force_compare.force_comp_match_a);
+    timer_generic_reg_write_flag(handle->TCCRC, FOCB_MSK, config->force_compare.force_comp_match_b);
     return ret;
 }
 
@@ -1046,7 +1083,7 @@ timer_error_t timer_16_bit_deinit(uint8_t id)
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -1083,11 +1120,13 @@ timer_error_t timer_16_bit_reconfigure(uint8_t id, timer_16_bit_config_t * const
         return TIMER_ERROR_NULL_POINTER;
     }
 
+#ifndef USE_STATIC_BINDING
     ret = check_handle(&config->handle);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
+#endif
 
     ret = timer_16_bit_set_handle(id, &config->handle);
     if (TIMER_ERROR_OK != ret)
@@ -1123,7 +1162,7 @@ timer_error_t timer_16_bit_start(uint8_t id)
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -1135,7 +1174,8 @@ timer_error_t timer_16_bit_start(uint8_t id)
     }
 
     /* This time, set the prescaler to start the timer, unless prescaler is set to NO_CLOCK source */
-    *(internal_config[id].handle.TCCRB) = (*(internal_config[id].handle.TCCRB) & ~CS_MSK) | internal_config[id].prescaler;
+    timer_generic_write_field(&SHADOW(id).TCCRB, CS_MSK, internal_config[id].prescaler);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRB);
     return ret;
 }
 
@@ -1153,7 +1193,101 @@ timer_error_t timer_16_bit_stop(uint8_t id)
     }
 
     /* Reset prescaler to NO_CLOCK*/
-    *(internal_config[id].handle.TCCRB) = (*(internal_config[id].handle.TCCRB) & ~CS_MSK) | TIMER16BIT_CLK_NO_CLOCK;
+    timer_generic_write_field(&SHADOW(id).TCCRB, CS_MSK, TIMER16BIT_CLK_NO_CLOCK);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRB);
+    return ret;
+}
+
+timer_error_t timer_16_bit_begin_update(uint8_t id)
+{
+    timer_error_t ret = check_id(id);
+    if(TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    ret = check_stored_handle(id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    SHADOW(id).deferred = true;
+    return ret;
+}
+
+timer_error_t timer_16_bit_commit_update(uint8_t id)
+{
+    timer_error_t ret = check_id(id);
+    if(TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    ret = check_stored_handle(id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    SHADOW(id).deferred = false;
+    timer_generic_shadow_commit(&SHADOW(id), HANDLE(id).TCCRA, HANDLE(id).TCCRB, HANDLE(id).TIMSK);
+    return ret;
+}
+
+timer_error_t timer_16_bit_generate_frequency(uint8_t id, const uint32_t cpu_freq, const uint32_t frequency, uint32_t * const achieved_frequency)
+{
+    timer_error_t ret = check_id(id);
+    if(TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == achieved_frequency)
+    {
+        return TIMER_ERROR_NULL_POINTER;
+    }
+
+    ret = check_stored_handle(id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (false == internal_config[id].is_initialised)
+    {
+        return TIMER_ERROR_NOT_INITIALISED;
+    }
+
+    timer_generic_parameters_t parameters =
+    {
+        .input =
+        {
+            .cpu_frequency = cpu_freq,
+            .target_frequency = frequency,
+            .resolution = TIMER_GENERIC_RESOLUTION_16_BIT,
+            .prescaler_lookup_array.array = timer_16_bit_prescaler_table,
+            .prescaler_lookup_array.size = TIMER_16_BIT_MAX_PRESCALER_COUNT,
+        },
+    };
+    if (false == timer_generic_compute_toggle_parameters(&parameters, achieved_frequency))
+    {
+        return TIMER_ERROR_CONFIG;
+    }
+    internal_config[id].prescaler = timer_16_bit_prescaler_from_value(&parameters.output.prescaler);
+
+    /* OCRA is not buffered in CTC mode : when the period shrinks below current counter value, restart it
+       right away instead of letting the counter roll over MAX */
+    write_16_bit_register(HANDLE(id).OCRA_H, HANDLE(id).OCRA_L, parameters.output.ocra);
+    if (read_16_bit_register(HANDLE(id).TCNT_H, HANDLE(id).TCNT_L) > parameters.output.ocra)
+    {
+        write_16_bit_register(HANDLE(id).TCNT_H, HANDLE(id).TCNT_L, 0U);
+    }
+
+    timer_generic_set_waveform(&SHADOW(id).TCCRA, &SHADOW(id).TCCRB, TIMER16BIT_WG_CTC_OCRA_MAX, WGM2_MSK | WGM3_MSK);
+    timer_generic_write_field(&SHADOW(id).TCCRA, COMA_MSK, TIMER16BIT_CMOD_TOGGLE_OCnX << COMA0_BIT);
+    timer_generic_write_field(&SHADOW(id).TCCRB, CS_MSK, internal_config[id].prescaler);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRA | TIMER_GENERIC_SHADOW_TCCRB);
     return ret;
 }
 
@@ -1175,3 +1309,123 @@ timer_error_t timer_16_bit_is_initialised(uint8_t id, bool * const initialised)
     return ret;
 }
 
+
+timer_error_t timer_16_bit_dither_enable(uint8_t id, timer_16_bit_dither_config_t const * const config)
+{
+    timer_error_t ret = check_id(id);
+    if(TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == config)
+    {
+        return TIMER_ERROR_NULL_POINTER;
+    }
+
+    ret = check_stored_handle(id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if ((0U == config->top)
+    ||  (0U == (config->outputs & (TIMER16BIT_DITHER_OUTPUT_A | TIMER16BIT_DITHER_OUTPUT_B)))
+    ||  ((TIMER16BIT_DITHER_FIRST_ORDER != config->order) && (TIMER16BIT_DITHER_SECOND_ORDER != config->order)))
+    {
+        return TIMER_ERROR_CONFIG;
+    }
+
+    dither[id].enabled = false;
+    dither[id].config = *config;
+    dither[id].whole = 0U;
+    dither[id].fraction = 0U;
+    dither[id].error[0] = 0;
+    dither[id].error[1] = 0;
+    dither[id].accumulator = 0U;
+    dither[id].enabled = true;
+    return ret;
+}
+
+timer_error_t timer_16_bit_dither_disable(uint8_t id)
+{
+    timer_error_t ret = check_id(id);
+    if(TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    dither[id].enabled = false;
+    return ret;
+}
+
+timer_error_t timer_16_bit_set_duty_hires(uint8_t id, const uint16_t duty)
+{
+    timer_error_t ret = check_id(id);
+    if(TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (false == dither[id].enabled)
+    {
+        return TIMER_ERROR_NOT_INITIALISED;
+    }
+
+    /* Requested compare value is duty / 65536 of the (TOP + 1) counts period, in 16.16 fixed point */
+    const uint32_t target = (uint32_t) duty * ((uint32_t) dither[id].config.top + 1U);
+    uint8_t sreg = 0;
+    CRITICAL_SECTION_ENTER(sreg);
+    dither[id].whole = (uint16_t)(target >> 16U);
+    dither[id].fraction = (uint16_t)(target & 0xFFFF);
+    CRITICAL_SECTION_EXIT(sreg);
+    return ret;
+}
+
+void timer_16_bit_dither_callback(uint8_t id)
+{
+    if ((TIMER_ERROR_OK != check_id(id)) || (false == dither[id].enabled))
+    {
+        return;
+    }
+
+    int32_t value = (int32_t) dither[id].whole;
+    if (TIMER16BIT_DITHER_FIRST_ORDER == dither[id].config.order)
+    {
+        /* Accumulator carry gives the extra count : fraction / 65536 periods out of 65536 are one count longer */
+        const uint16_t previous = dither[id].accumulator;
+        dither[id].accumulator += dither[id].fraction;
+        if (dither[id].accumulator < previous)
+        {
+            value++;
+        }
+    }
+    else
+    {
+        /* Error feedback modulator : y = x + e[n] - 2.e[n-1] + e[n-2], quantization noise transfer function is (1 - z^-1)^2 */
+        const int32_t shaped = (int32_t) dither[id].fraction - (2 * dither[id].error[0]) + dither[id].error[1];
+        const int32_t quantized = (shaped + 0x8000) & ~((int32_t) 0xFFFF);
+        dither[id].error[1] = dither[id].error[0];
+        dither[id].error[0] = quantized - shaped;
+        value += (quantized / 0x10000);
+    }
+
+    /* Second order shaping may overshoot by a couple of counts around both ends of the range */
+    if (value < 0)
+    {
+        value = 0;
+    }
+    else if (value > (int32_t) dither[id].config.top)
+    {
+        value = (int32_t) dither[id].config.top;
+    }
+
+    if (0U != (dither[id].config.outputs & TIMER16BIT_DITHER_OUTPUT_A))
+    {
+        write_16_bit_register(HANDLE(id).OCRA_H, HANDLE(id).OCRA_L, (uint16_t) value);
+    }
+    if (0U != (dither[id].config.outputs & TIMER16BIT_DITHER_OUTPUT_B))
+    {
+        write_16_bit_register(HANDLE(id).OCRB_H, HANDLE(id).OCRB_L, (uint16_t) value);
+    }
+}
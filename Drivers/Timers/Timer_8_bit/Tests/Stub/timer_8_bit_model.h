@@ -0,0 +1,96 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TIMER_8_BIT_MODEL_HEADER
+#define TIMER_8_BIT_MODEL_HEADER
+
+#include "timer_8_bit_registers_stub.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Interrupt vectors of an 8 bit timer, in hardware priority order
+*/
+typedef enum
+{
+    TIMER_8_BIT_MODEL_VECTOR_COMPA,     /**< Compare match A interrupt (e.g. TIMER0_COMPA_vect) */
+    TIMER_8_BIT_MODEL_VECTOR_COMPB,     /**< Compare match B interrupt (e.g. TIMER0_COMPB_vect) */
+    TIMER_8_BIT_MODEL_VECTOR_OVF,       /**< Overflow interrupt (e.g. TIMER0_OVF_vect)          */
+    TIMER_8_BIT_MODEL_VECTOR_COUNT
+} timer_8_bit_model_vector_t;
+
+typedef void (*timer_8_bit_model_isr_t)(void);
+
+/**
+ * @brief Behavioural model of an 8 bit timer, which makes the registers stub count like the real peripheral.
+ * Counter advances according to the clock selection bits, waveform generation mode and compare registers found in the
+ * registers stub. Flags are raised in TIFR and attached ISRs are called when their interrupt is enabled in TIMSK
+ * (flag is then cleared, as hardware does when vectoring to the ISR).
+ * Compare registers are double buffered in PWM modes, and OCnA/OCnB output levels are tracked to check PWM signals.
+ * External clock sources are not modelled : timer does not count when they are selected.
+*/
+typedef struct
+{
+    timer_8_bit_registers_stub_t * regs;                    /**< Registers driven by the model                              */
+    timer_8_bit_model_isr_t isr[TIMER_8_BIT_MODEL_VECTOR_COUNT]; /**< Attached interrupt service routines                   */
+    uint16_t prescaler_count;                               /**< CPU cycles elapsed since the last timer clock              */
+    bool counting_down;                                     /**< Phase correct modes only : counter is going down           */
+    uint8_t ocra;                                           /**< Compare value A actually used by the compare unit          */
+    uint8_t ocrb;                                           /**< Compare value B actually used by the compare unit          */
+    bool output_a;                                          /**< OCnA pin level (only driven when COMnA bits are set)       */
+    bool output_b;                                          /**< OCnB pin level (only driven when COMnB bits are set)       */
+    uint32_t output_high_ticks[2];                          /**< Timer clocks spent with OCnA (0) and OCnB (1) high         */
+    uint32_t ticks;                                         /**< Timer clocks elapsed since initialisation                  */
+    uint32_t isr_calls[TIMER_8_BIT_MODEL_VECTOR_COUNT];     /**< Number of times each ISR was called                        */
+} timer_8_bit_model_t;
+
+/**
+ * @brief resets the model and binds it to a registers stub, pending interrupt flags are discarded
+*/
+void timer_8_bit_model_init(timer_8_bit_model_t * const model, timer_8_bit_registers_stub_t * const regs);
+
+/**
+ * @brief attaches an ISR to one of the timer interrupt vectors (NULL detaches it)
+*/
+void timer_8_bit_model_attach_isr(timer_8_bit_model_t * const model, const timer_8_bit_model_vector_t vector, timer_8_bit_model_isr_t isr);
+
+/**
+ * @brief runs the model for the given amount of CPU cycles
+*/
+void timer_8_bit_model_run(timer_8_bit_model_t * const model, const uint32_t cpu_cycles);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMER_8_BIT_MODEL_HEADER */
@@ -32,6 +32,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "config.h"
 #include "timer_8_bit.h"
 #include "timer_8_bit_registers_stub.h"
+#include "timer_8_bit_model.h"
 
 /* Default timer id */
 #define DT_ID 0
@@ -504,6 +505,51 @@ TEST_F(Timer8BitFixture, test_initialisation_deinitialisation)
     ASSERT_EQ(ret, TIMER_ERROR_NOT_INITIALISED);
 }
 
+TEST_F(Timer8BitFixture, test_batched_update)
+{
+    timer_error_t ret = timer_8_bit_begin_update(DT_ID);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+
+    ret = timer_8_bit_set_compare_match_A(DT_ID, TIMER8BIT_CMOD_CLEAR_OCnX);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    ret = timer_8_bit_set_waveform_generation(DT_ID, TIMER8BIT_WG_PWM_FAST_OCRA_MAX);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    ret = timer_8_bit_set_prescaler(DT_ID, TIMER8BIT_CLK_PRESCALER_64);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+
+    /* Nothing reaches the registers while the batch is pending, getters already report the new values */
+    ASSERT_EQ(timer_8_bit_registers_stub.TCCRA, 0U);
+    ASSERT_EQ(timer_8_bit_registers_stub.TCCRB, 0U);
+    timer_8_bit_prescaler_selection_t prescaler = TIMER8BIT_CLK_NO_CLOCK;
+    ret = timer_8_bit_get_prescaler(DT_ID, &prescaler);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    ASSERT_EQ(prescaler, TIMER8BIT_CLK_PRESCALER_64);
+
+    ret = timer_8_bit_commit_update(DT_ID);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    ASSERT_EQ(timer_8_bit_registers_stub.TCCRA, (TIMER8BIT_CMOD_CLEAR_OCnX << COMA_BIT) | (TIMER8BIT_WG_PWM_FAST_OCRA_MAX & (WGM0_MSK | WGM1_MSK)));
+    ASSERT_EQ(timer_8_bit_registers_stub.TCCRB, WGM2_MSK | TIMER8BIT_CLK_PRESCALER_64);
+
+    /* Setters write through again once the batch is committed */
+    ret = timer_8_bit_set_prescaler(DT_ID, TIMER8BIT_CLK_NO_CLOCK);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    ASSERT_EQ(timer_8_bit_registers_stub.TCCRB, WGM2_MSK);
+}
+
+TEST_F(Timer8BitFixture, test_clear_interrupt_flags)
+{
+    /* Only selected flags are written (flags are cleared by writing a logical one to them) */
+    timer_8_bit_interrupt_config_t flags = {};
+    flags.it_timer_overflow = true;
+    timer_8_bit_registers_stub.TIFR = TOV_MSK | OCFA_MSK | OCFB_MSK;
+    timer_error_t ret = timer_8_bit_clear_interrupt_flags(DT_ID, &flags);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    ASSERT_EQ(timer_8_bit_registers_stub.TIFR, TOV_MSK);
+
+    ret = timer_8_bit_clear_interrupt_flags(DT_ID, NULL);
+    ASSERT_EQ(ret, TIMER_ERROR_NULL_POINTER);
+}
+
 TEST(timer_8_bit_driver_tests, test_parameters_computation_prescaler)
 {
     uint32_t cpu_freq = 16'000'000;
@@ -551,6 +597,118 @@ TEST(timer_8_bit_driver_tests, test_parameters_computation_prescaler)
     ASSERT_EQ(accumulator, 124U);
 }
 
+static void model_compare_match_isr(void)
+{
+}
+
+TEST_F(Timer8BitFixture, test_model_ctc_tick_rate)
+{
+    timer_8_bit_model_t model;
+    timer_8_bit_model_init(&model, &timer_8_bit_registers_stub);
+    timer_8_bit_model_attach_isr(&model, TIMER_8_BIT_MODEL_VECTOR_COMPA, model_compare_match_isr);
+
+    /* Low frequencies need a software accumulator on top of the compare match : one tick every accumulator + 1 interrupts */
+    const uint32_t cpu_freq = 16'000'000;
+    const uint32_t target_freqs[2] = {1'000, 1};
+    const uint32_t simulated_seconds[2] = {1U, 2U};
+    for (uint8_t i = 0 ; i < 2U ; i++)
+    {
+        uint16_t accumulator = 0;
+        timer_8_bit_compute_matching_parameters(&cpu_freq, &target_freqs[i], &config.timing_config.prescaler,
+                                                &config.timing_config.ocra_val, &accumulator);
+        config.timing_config.waveform_mode = TIMER8BIT_WG_CTC;
+        config.interrupt_config.it_comp_match_a = true;
+        timer_error_t ret = timer_8_bit_reconfigure(DT_ID, &config);
+        ASSERT_EQ(ret, TIMER_ERROR_OK);
+        ret = timer_8_bit_start(DT_ID);
+        ASSERT_EQ(ret, TIMER_ERROR_OK);
+
+        model.isr_calls[TIMER_8_BIT_MODEL_VECTOR_COMPA] = 0U;
+        for (uint8_t second = 0 ; second < simulated_seconds[i] ; second++)
+        {
+            timer_8_bit_model_run(&model, cpu_freq);
+        }
+        ASSERT_EQ(model.isr_calls[TIMER_8_BIT_MODEL_VECTOR_COMPA], target_freqs[i] * simulated_seconds[i] * (accumulator + 1U));
+    }
+    ASSERT_EQ(model.isr_calls[TIMER_8_BIT_MODEL_VECTOR_OVF], 0U);
+}
+
+TEST_F(Timer8BitFixture, test_model_pwm_duty_cycle)
+{
+    timer_8_bit_model_t model;
+    timer_8_bit_model_init(&model, &timer_8_bit_registers_stub);
+
+    /* Fast PWM : output is high during OCR + 1 timer clocks out of 256 */
+    config.timing_config.waveform_mode = TIMER8BIT_WG_PWM_FAST_FULL_RANGE;
+    config.timing_config.comp_match_b = TIMER8BIT_CMOD_CLEAR_OCnX;
+    config.timing_config.ocrb_val = 63U;
+    config.timing_config.prescaler = TIMER8BIT_CLK_PRESCALER_8;
+    timer_error_t ret = timer_8_bit_reconfigure(DT_ID, &config);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    ret = timer_8_bit_start(DT_ID);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+
+    /* Output pin only rises when counter restarts from BOTTOM : skip the first period */
+    timer_8_bit_model_run(&model, 256U * 8U);
+    model.ticks = 0U;
+    model.output_high_ticks[1] = 0U;
+    timer_8_bit_model_run(&model, 256U * 8U * 100U);
+    ASSERT_EQ(model.ticks, 25600U);
+    ASSERT_NEAR(model.output_high_ticks[1], 6400U, 1U);
+
+    /* Phase correct PWM : output is high during 2 x OCR timer clocks out of 510 */
+    config.timing_config.waveform_mode = TIMER8BIT_WG_PWM_PHASE_CORRECT_FULL_RANGE;
+    config.timing_config.ocrb_val = 51U;
+    timer_8_bit_registers_stub.TCNT = 0U;
+    ret = timer_8_bit_reconfigure(DT_ID, &config);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    ret = timer_8_bit_start(DT_ID);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    timer_8_bit_model_init(&model, &timer_8_bit_registers_stub);
+    timer_8_bit_model_run(&model, 510U * 8U * 100U);
+    ASSERT_EQ(model.ticks, 51000U);
+    ASSERT_NEAR(model.output_high_ticks[1], 10200U, 100U);
+}
+
+TEST_F(Timer8BitFixture, test_generate_frequency)
+{
+    uint32_t achieved = 0;
+    ASSERT_EQ(timer_8_bit_generate_frequency(DT_ID, 16'000'000U, 1'000U, nullptr), TIMER_ERROR_NULL_POINTER);
+
+    /* Timer shall be initialised first, as this call starts it */
+    (void) timer_8_bit_deinit(DT_ID);
+    ASSERT_EQ(timer_8_bit_generate_frequency(DT_ID, 16'000'000U, 1'000U, &achieved), TIMER_ERROR_NOT_INITIALISED);
+    ASSERT_EQ(timer_8_bit_registers_stub.TCCRB, 0U);
+    ASSERT_EQ(timer_8_bit_init(DT_ID, &config), TIMER_ERROR_OK);
+
+    ASSERT_EQ(timer_8_bit_generate_frequency(DT_ID + 1, 16'000'000U, 1'000U, &achieved), TIMER_ERROR_UNKNOWN_TIMER);
+    ASSERT_EQ(timer_8_bit_generate_frequency(DT_ID, 16'000'000U, 10U, &achieved), TIMER_ERROR_CONFIG);
+
+    timer_8_bit_model_t model;
+    timer_8_bit_model_init(&model, &timer_8_bit_registers_stub);
+    ASSERT_EQ(timer_8_bit_generate_frequency(DT_ID, 16'000'000U, 1'000U, &achieved), TIMER_ERROR_OK);
+    ASSERT_EQ(achieved, 1'000U);
+    ASSERT_EQ(timer_8_bit_registers_stub.OCRA, 124U);
+    ASSERT_EQ(timer_8_bit_registers_stub.TCCRB & CS_MSK, TIMER8BIT_CLK_PRESCALER_64);
+    ASSERT_EQ((timer_8_bit_registers_stub.TCCRA & COMA_MSK) >> COMA_BIT, TIMER8BIT_CMOD_TOGGLE_OCnX);
+
+    /* 100 ms : 100 periods, output pin is high half of the time */
+    timer_8_bit_model_run(&model, 1'600'000U);
+    ASSERT_EQ(model.ticks, 25'000U);
+    ASSERT_EQ(model.isr_calls[TIMER_8_BIT_MODEL_VECTOR_COMPA], 0U);
+    ASSERT_NEAR(model.output_high_ticks[0], 12'500U, 125U);
+
+    /* Retune while running, counter is past the new TOP and restarts */
+    timer_8_bit_registers_stub.TCNT = 100U;
+    ASSERT_EQ(timer_8_bit_generate_frequency(DT_ID, 16'000'000U, 3'000U, &achieved), TIMER_ERROR_OK);
+    ASSERT_EQ(achieved, 2'976U);
+    ASSERT_EQ(timer_8_bit_registers_stub.OCRA, 41U);
+    ASSERT_EQ(timer_8_bit_registers_stub.TCNT, 0U);
+
+    timer_8_bit_waveform_generation_t waveform;
+    ASSERT_EQ(timer_8_bit_get_waveform_generation(DT_ID, &waveform), TIMER_ERROR_OK);
+    ASSERT_EQ(waveform, TIMER8BIT_WG_CTC);
+}
 
 int main(int argc, char **argv)
 {
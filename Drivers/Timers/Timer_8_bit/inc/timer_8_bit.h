@@ -94,6 +94,8 @@ timer_error_t timer_8_bit_get_default_config(timer_8_bit_config_t * config);
 
 /**
  * @brief sets the handle of timer_8_bit driver
+ * Handle validity is checked once here : other functions return TIMER_ERROR_NULL_HANDLE as long as a complete handle is not set.
+ * When TIMER_8_BIT_STATIC_BINDING is defined, registers addresses are resolved at compile time and given handle is neither checked nor stored.
  * @param[in]   id     : targeted timer id (used to fetch internal configuration based on ids)
  * @param[in]   handle : handle to be copied into internal configuration
  * @return
@@ -166,20 +168,29 @@ timer_error_t timer_8_bit_set_interrupt_config(uint8_t id, timer_8_bit_interrupt
 */
 timer_error_t timer_8_bit_get_interrupt_config(uint8_t id, timer_8_bit_interrupt_config_t * it_config);
 
-#ifdef UNIT_TESTING
 /**
  * @brief reads the actual interrupt flags from internal memory and returns a copy of it
  * @param[in]   id       : targeted timer id (used to fetch internal configuration based on ids)
  * @param[in]   it_flags : container which holds the interrupt configuration
- * Note : this function reuses the interrupt configuration structure as it is only relevant for debugging
- * purposes and both interrupt enable flags and raised interrupt flags share the same register layout
+ * Note : this function reuses the interrupt configuration structure as both interrupt enable flags and raised interrupt flags
+ * share the same register layout. It is also used by pulse counting to detect a pending overflow.
  * @return
  *      TIMER_ERROR_OK             :   operation succeeded
  *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
  *      TIMER_ERROR_NULL_POINTER   :   given it_config parameter points to NULL
 */
 timer_error_t timer_8_bit_get_interrupt_flags(uint8_t id, timer_8_bit_interrupt_config_t * it_flags);
-#endif
+
+/**
+ * @brief clears the selected interrupt flags (flags set to true are cleared, others are left untouched)
+ * @param[in]   id       : targeted timer id (used to fetch internal configuration based on ids)
+ * @param[in]   it_flags : selects which flags have to be cleared
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
+ *      TIMER_ERROR_NULL_POINTER   :   given it_flags parameter points to NULL
+*/
+timer_error_t timer_8_bit_clear_interrupt_flags(uint8_t id, timer_8_bit_interrupt_config_t const * const it_flags);
 
 
 
@@ -412,6 +423,47 @@ timer_error_t timer_8_bit_start(uint8_t id);
 */
 timer_error_t timer_8_bit_stop(uint8_t id);
 
+/**
+ * @brief starts a batch of configuration changes : control registers (TCCRA, TCCRB, TIMSK) are only updated in the driver's
+ * shadow copies by subsequent setters, until timer_8_bit_commit_update() is called.
+ * @param[in]   id     : targeted timer id (used to fetch internal configuration based on ids)
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
+ *      TIMER_ERROR_NULL_HANDLE    :   driver handle is not set
+*/
+timer_error_t timer_8_bit_begin_update(uint8_t id);
+
+/**
+ * @brief ends a batch of configuration changes : each modified control register is written once, with its final value
+ * @param[in]   id     : targeted timer id (used to fetch internal configuration based on ids)
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
+ *      TIMER_ERROR_NULL_HANDLE    :   driver handle is not set
+*/
+timer_error_t timer_8_bit_commit_update(uint8_t id);
+
+/**
+ * @brief outputs a square wave of the requested frequency on OCnA pin, in one call : CTC mode, OCnA toggle on compare match,
+ * prescaler and OCRA are selected and applied with a single write of the control registers (or batched along with other
+ * changes when called between timer_8_bit_begin_update() and timer_8_bit_commit_update()). Timer starts counting right away, even
+ * if it was stopped : timer_8_bit_init() shall have been called first.
+ * Can be called again at runtime to retune the output frequency.
+ * @param[in]   id                  : targeted timer id (used to fetch internal configuration based on ids)
+ * @param[in]   cpu_freq            : cpu frequency, in Hz
+ * @param[in]   frequency           : requested output frequency, in Hz
+ * @param[out]  achieved_frequency  : closest frequency the timer can generate, in Hz
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
+ *      TIMER_ERROR_NULL_POINTER   :   achieved_frequency parameter points to NULL
+ *      TIMER_ERROR_NULL_HANDLE    :   driver handle is not set
+ *      TIMER_ERROR_NOT_INITIALISED :   timer was not initialised, nothing was written
+ *      TIMER_ERROR_CONFIG         :   requested frequency is out of the timer's range
+*/
+timer_error_t timer_8_bit_generate_frequency(uint8_t id, const uint32_t cpu_freq, const uint32_t frequency, uint32_t * const achieved_frequency);
+
 #define TIMER_8_BIT_MAX_PRESCALER_COUNT (5U)
 
 /**
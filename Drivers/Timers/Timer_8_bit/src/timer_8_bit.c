@@ -47,13 +47,39 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
     #warning "TIMER_8_BIT_COUNT is set to 0. If you don't project to use this timer, refer to not compile this file instead of setting this define to 0"
 #endif
 
+/* When TIMER_8_BIT_STATIC_BINDING is defined in config.h, registers addresses are resolved at compile time instead of being
+   fetched from the handle stored at runtime. The binding is only ever read with constant offsets so every register access
+   folds into a direct I/O instruction and no handle is kept in RAM, which restricts static binding to a single instance.
+   Default binding targets the ATmega328P Timer/Counter 0, another one can be provided through TIMER_8_BIT_STATIC_HANDLE.
+   Unit tests always rely on the runtime handle. */
+#if defined(TIMER_8_BIT_STATIC_BINDING) && !defined(UNIT_TESTING)
+    #include <avr/io.h>
+    #if TIMER_8_BIT_COUNT != 1
+        #error "TIMER_8_BIT_STATIC_BINDING only supports a single timer, please set TIMER_8_BIT_COUNT to 1"
+    #endif
+    #ifndef TIMER_8_BIT_STATIC_HANDLE
+        #define TIMER_8_BIT_STATIC_HANDLE { .TCCRA = &TCCR0A, .TCCRB = &TCCR0B, .TCNT = &TCNT0, .OCRA = &OCR0A, .OCRB = &OCR0B, .TIMSK = &TIMSK0, .TIFR = &TIFR0 }
+    #endif
+    #define USE_STATIC_BINDING
+    static const timer_8_bit_handle_t static_handle = TIMER_8_BIT_STATIC_HANDLE;
+    #define HANDLE(id) (*((void) (id), &static_handle))
+#else
+    #define HANDLE(id) (internal_config[(id)].handle)
+#endif
+
 static struct
 {
+#ifndef USE_STATIC_BINDING
     timer_8_bit_handle_t handle;
+    bool handle_is_valid;
+#endif
+    timer_generic_shadow_t shadow;
     timer_8_bit_prescaler_selection_t prescaler;
     bool is_initialised;
 } internal_config[TIMER_8_BIT_COUNT] = {0};
 
+#define SHADOW(id) (internal_config[(id)].shadow)
+
 const timer_generic_prescaler_pair_t timer_8_bit_prescaler_table[TIMER_8_BIT_MAX_PRESCALER_COUNT] =
 {
     {.value = 1U,       .type = (uint8_t) TIMER8BIT_CLK_PRESCALER_1     },
@@ -147,6 +173,36 @@ static inline timer_error_t check_id(uint8_t id)
     return TIMER_ERROR_OK;
 }
 
+/**
+ * @brief checks the handle stored for this timer, validity is evaluated once when the handle is set
+*/
+static inline timer_error_t check_stored_handle(const uint8_t id)
+{
+#ifdef USE_STATIC_BINDING
+    (void) id;
+    return TIMER_ERROR_OK;
+#else
+    if (false == internal_config[id].handle_is_valid)
+    {
+        return TIMER_ERROR_NULL_HANDLE;
+    }
+    return TIMER_ERROR_OK;
+#endif
+}
+
+/**
+ * @brief marks shadow registers as modified and writes them to the device, unless changes are batched
+ * using timer_8_bit_begin_update()
+*/
+static inline void update_registers(const uint8_t id, const uint8_t registers)
+{
+    SHADOW(id).dirty |= registers;
+    if (false == SHADOW(id).deferred)
+    {
+        timer_generic_shadow_commit(&SHADOW(id), HANDLE(id).TCCRA, HANDLE(id).TCCRB, HANDLE(id).TIMSK);
+    }
+}
+
 timer_error_t timer_8_bit_set_handle(uint8_t id, timer_8_bit_handle_t * const handle)
 {
     timer_error_t ret = check_id(id);
@@ -160,7 +216,18 @@ timer_error_t timer_8_bit_set_handle(uint8_t id, timer_8_bit_handle_t * const ha
         return TIMER_ERROR_NULL_POINTER;
     }
 
+#ifdef USE_STATIC_BINDING
+    /* Registers are bound at compile time, given handle is not stored */
+    (void) handle;
+#else
     memcpy(&internal_config[id].handle, handle, sizeof(timer_8_bit_handle_t));
+    internal_config[id].handle_is_valid = (TIMER_ERROR_OK == check_handle(handle));
+    if (false == internal_config[id].handle_is_valid)
+    {
+        return ret;
+    }
+#endif
+    timer_generic_shadow_load(&SHADOW(id), HANDLE(id).TCCRA, HANDLE(id).TCCRB, HANDLE(id).TIMSK, FOCA_MSK | FOCB_MSK);
     return ret;
 }
 
@@ -177,7 +244,18 @@ timer_error_t timer_8_bit_get_handle(uint8_t id, timer_8_bit_handle_t * const ha
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    memcpy(handle, &internal_config[id].handle, sizeof(timer_8_bit_handle_t));
+#ifdef USE_STATIC_BINDING
+    /* Field by field copy lets each address fold into an immediate store instead of copying the binding from memory */
+    handle->TCCRA = HANDLE(id).TCCRA;
+    handle->TCCRB = HANDLE(id).TCCRB;
+    handle->TCNT  = HANDLE(id).TCNT;
+    handle->OCRA  = HANDLE(id).OCRA;
+    handle->OCRB  = HANDLE(id).OCRB;
+    handle->TIMSK = HANDLE(id).TIMSK;
+    handle->TIFR  = HANDLE(id).TIFR;
+#else
+    memcpy(handle, &HANDLE(id), sizeof(timer_8_bit_handle_t));
+#endif
     return ret;
 }
 
@@ -236,31 +314,17 @@ timer_error_t timer_8_bit_set_force_compare_config(uint8_t id, timer_8_bit_force
     }
 
     /* Not fully configured handle, do not attempt to write to it until configured !*/
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
     /* Handles force output compare A flags */
-    if (true == force_comp_config->force_comp_match_a)
-    {
-        *(internal_config[id].handle.TCCRB) |= (1U << FOCA_BIT) ;
-    }
-    else
-    {
-        *(internal_config[id].handle.TCCRB) &=  ~(1U << FOCA_BIT) ;
-    }
+    timer_generic_reg_write_flag(HANDLE(id).TCCRB, 1U << FOCA_BIT, force_comp_config->force_comp_match_a);
 
     /* Handles force output compare A flags */
-    if (true == force_comp_config->force_comp_match_b)
-    {
-        *(internal_config[id].handle.TCCRB) |= (1U << FOCB_BIT) ;
-    }
-    else
-    {
-        *(internal_config[id].handle.TCCRB) &=  ~(1U << FOCB_BIT) ;
-    }
+    timer_generic_reg_write_flag(HANDLE(id).TCCRB, 1U << FOCB_BIT, force_comp_config->force_comp_match_b);
     return ret;
 }
 
@@ -276,31 +340,17 @@ timer_error_t timer_8_bit_get_force_compare_config(uint8_t id, timer_8_bit_force
         return TIMER_ERROR_NULL_POINTER;
     }
     /* Not fully configured handle, do not attempt to write to it until configured !*/
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
     /* Handles Force Compare Output A flag */
-    if (0U == (*(internal_config[id].handle.TCCRB) & FOCA_MSK))
-    {
-        force_comp_config->force_comp_match_a = false;
-    }
-    else
-    {
-        force_comp_config->force_comp_match_a = true;
-    }
+    force_comp_config->force_comp_match_a = timer_generic_reg_read_flag(HANDLE(id).TCCRB, FOCA_MSK);
 
     /* Handles Force Compare Output B flag */
-    if (0U == (*(internal_config[id].handle.TCCRB) & FOCB_MSK))
-    {
-        force_comp_config->force_comp_match_b = false;
-    }
-    else
-    {
-        force_comp_config->force_comp_match_b = true;
-    }
+    force_comp_config->force_comp_match_b = timer_generic_reg_read_flag(HANDLE(id).TCCRB, FOCB_MSK);
     return ret;
 }
 
@@ -316,40 +366,20 @@ timer_error_t timer_8_bit_set_interrupt_config(uint8_t id, timer_8_bit_interrupt
     {
         return TIMER_ERROR_NULL_POINTER;
     }
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
     /* TIMSK register */
-    if (true == it_config->it_comp_match_a)
-    {
-        *(internal_config[id].handle.TIMSK) |= 1U << OCIEA_BIT;
-    }
-    else
-    {
-        *(internal_config[id].handle.TIMSK) &= ~(1U << OCIEA_BIT);
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, 1U << OCIEA_BIT, it_config->it_comp_match_a);
 
-    if (true == it_config->it_comp_match_b)
-    {
-        *(internal_config[id].handle.TIMSK) |= 1U << OCIEB_BIT;
-    }
-    else
-    {
-        *(internal_config[id].handle.TIMSK) &= ~(1U << OCIEB_BIT);
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, 1U << OCIEB_BIT, it_config->it_comp_match_b);
 
     /* TOIE interrupt flag is the first bit, no need to bitshift it */
-    if (true == it_config->it_timer_overflow)
-    {
-        *(internal_config[id].handle.TIMSK) |= 1U;
-    }
-    else
-    {
-        *(internal_config[id].handle.TIMSK) &= ~1U;
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, 1U, it_config->it_timer_overflow);
+    update_registers(id, TIMER_GENERIC_SHADOW_TIMSK);
     return ret;
 }
 
@@ -367,45 +397,23 @@ timer_error_t timer_8_bit_get_interrupt_config(uint8_t id, timer_8_bit_interrupt
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
     /* Output Compare Match A Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIMSK) & OCIEA_MSK))
-    {
-        it_config->it_comp_match_a = false;
-    }
-    else
-    {
-        it_config->it_comp_match_a = true;
-    }
+    it_config->it_comp_match_a = timer_generic_read_flag(&SHADOW(id).TIMSK, OCIEA_MSK);
 
     /* Output Compare Match B Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIMSK) & OCIEB_MSK))
-    {
-        it_config->it_comp_match_b = false;
-    }
-    else
-    {
-        it_config->it_comp_match_b = true;
-    }
+    it_config->it_comp_match_b = timer_generic_read_flag(&SHADOW(id).TIMSK, OCIEB_MSK);
 
     /* Timer Overflow Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIMSK) & 1U))
-    {
-        it_config->it_timer_overflow = false;
-    }
-    else
-    {
-        it_config->it_timer_overflow = true;
-    }
+    it_config->it_timer_overflow = timer_generic_read_flag(&SHADOW(id).TIMSK, 1U);
     return ret;
 }
 
-#ifdef UNIT_TESTING
 timer_error_t timer_8_bit_get_interrupt_flags(uint8_t id, timer_8_bit_interrupt_config_t * it_flags)
 {
     timer_error_t ret = check_id(id);
@@ -419,7 +427,7 @@ timer_error_t timer_8_bit_get_interrupt_flags(uint8_t id, timer_8_bit_interrupt_
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -427,39 +435,56 @@ timer_error_t timer_8_bit_get_interrupt_flags(uint8_t id, timer_8_bit_interrupt_
 
 
     /* Output Compare Match A Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIFR) & OCIEA_MSK))
+    it_flags->it_comp_match_a = timer_generic_reg_read_flag(HANDLE(id).TIFR, OCIEA_MSK);
+
+    /* Output Compare Match B Interrupt Flag */
+    it_flags->it_comp_match_b = timer_generic_reg_read_flag(HANDLE(id).TIFR, OCIEB_MSK);
+
+    /* Timer Overflow Interrupt Flag */
+    it_flags->it_timer_overflow = timer_generic_reg_read_flag(HANDLE(id).TIFR, 1U);
+
+    return ret;
+
+}
+
+timer_error_t timer_8_bit_clear_interrupt_flags(uint8_t id, timer_8_bit_interrupt_config_t const * const it_flags)
+{
+    timer_error_t ret = check_id(id);
+    if (TIMER_ERROR_OK != ret)
     {
-        it_flags->it_comp_match_a = false;
+        return ret;
     }
-    else
+
+    if (NULL == it_flags)
     {
-        it_flags->it_comp_match_a = true;
+        return TIMER_ERROR_NULL_POINTER;
     }
 
-    /* Output Compare Match B Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIFR) & OCIEB_MSK))
+    ret = check_stored_handle(id);
+    if (TIMER_ERROR_OK != ret)
     {
-        it_flags->it_comp_match_b = false;
+        return ret;
     }
-    else
+
+    /* Flags are cleared by writing a logical one to them : only write selected bits, as a read-modify-write
+    operation would clear all pending flags at once */
+    uint8_t mask = 0U;
+    if (true == it_flags->it_comp_match_a)
     {
-        it_flags->it_comp_match_b = true;
+        mask |= OCFA_MSK;
     }
-
-    /* Timer Overflow Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIFR) & 1U))
+    if (true == it_flags->it_comp_match_b)
     {
-        it_flags->it_timer_overflow = false;
+        mask |= OCFB_MSK;
     }
-    else
+    if (true == it_flags->it_timer_overflow)
     {
-        it_flags->it_timer_overflow = true;
+        mask |= TOV_MSK;
     }
+    *(HANDLE(id).TIFR) = mask;
 
     return ret;
-
 }
-#endif
 
 
 
@@ -471,13 +496,14 @@ timer_error_t timer_8_bit_set_prescaler(uint8_t id, const timer_8_bit_prescaler_
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *(internal_config[id].handle.TCCRB) = (*(internal_config[id].handle.TCCRB) & ~CS_MSK) | prescaler;
+    timer_generic_write_field(&SHADOW(id).TCCRB, CS_MSK, prescaler);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRB);
     return ret;
 }
 
@@ -494,13 +520,13 @@ timer_error_t timer_8_bit_get_prescaler(uint8_t id, timer_8_bit_prescaler_select
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *prescaler = (*(internal_config[id].handle.TCCRB) & CS_MSK);
+    *prescaler = (SHADOW(id).TCCRB & CS_MSK);
     return ret;
 }
 
@@ -512,13 +538,14 @@ timer_error_t timer_8_bit_set_compare_match_A(uint8_t id, const timer_8_bit_comp
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *(internal_config[id].handle.TCCRA) = (*(internal_config[id].handle.TCCRA) & ~COMA_MSK) | (compA << COMA_BIT);
+    timer_generic_write_field(&SHADOW(id).TCCRA, COMA_MSK, compA << COMA_BIT);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRA);
     return ret;
 }
 
@@ -535,13 +562,13 @@ timer_error_t timer_8_bit_get_compare_match_A(uint8_t id, timer_8_bit_compare_ou
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *compA = ((*(internal_config[id].handle.TCCRA) & COMA_MSK) >> COMA_BIT);
+    *compA = ((SHADOW(id).TCCRA & COMA_MSK) >> COMA_BIT);
     return ret;
 }
 
@@ -553,13 +580,14 @@ timer_error_t timer_8_bit_set_compare_match_B(uint8_t id, timer_8_bit_compare_ou
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *(internal_config[id].handle.TCCRA) = (*(internal_config[id].handle.TCCRA) & ~COMB_MSK) | (compB << COMB_BIT);
+    timer_generic_write_field(&SHADOW(id).TCCRA, COMB_MSK, compB << COMB_BIT);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRA);
     return ret;
 }
 
@@ -576,13 +604,13 @@ timer_error_t timer_8_bit_get_compare_match_B(uint8_t id, timer_8_bit_compare_ou
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *compB = ((*(internal_config[id].handle.TCCRA) & COMB_MSK) >> COMB_BIT);
+    *compB = ((SHADOW(id).TCCRA & COMB_MSK) >> COMB_BIT);
     return ret;
 }
 
@@ -594,15 +622,14 @@ timer_error_t timer_8_bit_set_waveform_generation(uint8_t id, const timer_8_bit_
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *(internal_config[id].handle.TCCRA) = (*(internal_config[id].handle.TCCRA) & ~(WGM0_MSK | WGM1_MSK)) | (waveform & (WGM0_MSK | WGM1_MSK));
-    /* Select bit index 2 of waveform mode (matches datasheet bit mapping) and store it to bit index 3 of TCCRB with one more bitshift */
-    *(internal_config[id].handle.TCCRB) = (*(internal_config[id].handle.TCCRB) & ~WGM2_MSK) | (waveform & (1U << 2U) << 1U);
+    timer_generic_set_waveform(&SHADOW(id).TCCRA, &SHADOW(id).TCCRB, waveform, WGM2_MSK);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRA | TIMER_GENERIC_SHADOW_TCCRB);
     return ret;
 }
 
@@ -619,15 +646,13 @@ timer_error_t timer_8_bit_get_waveform_generation(uint8_t id, timer_8_bit_wavefo
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *waveform = (timer_8_bit_waveform_generation_t)(0U);
-    *waveform |= (*(internal_config[id].handle.TCCRA) & (WGM0_MSK | WGM1_MSK));
-    *waveform |= (*(internal_config[id].handle.TCCRB) & (WGM2_MSK)) >> 1U;
+    *waveform = (timer_8_bit_waveform_generation_t) timer_generic_get_waveform(&SHADOW(id).TCCRA, &SHADOW(id).TCCRB, WGM2_MSK);
     return ret;
 }
 
@@ -639,14 +664,14 @@ timer_error_t timer_8_bit_set_counter_value(uint8_t id, const uint8_t ticks)
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
     /* Write new value to internal timer/counter register */
-    *(internal_config[id].handle.TCNT) = ticks;
+    *(HANDLE(id).TCNT) = ticks;
     return ret;
 }
 
@@ -663,14 +688,14 @@ timer_error_t timer_8_bit_get_counter_value(uint8_t id, uint8_t * ticks)
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
     /* Transfer data from internal device's timer/count main register */
-    *ticks = *internal_config[id].handle.TCNT;
+    *ticks = *HANDLE(id).TCNT;
     return ret;
 }
 
@@ -682,13 +707,13 @@ timer_error_t timer_8_bit_set_ocra_register_value(uint8_t id, uint8_t ocra)
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *internal_config[id].handle.OCRA = ocra;
+    *HANDLE(id).OCRA = ocra;
     return ret;
 }
 
@@ -705,13 +730,13 @@ timer_error_t timer_8_bit_get_ocra_register_value(uint8_t id, uint8_t * ocra)
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *ocra = *internal_config[id].handle.OCRA;
+    *ocra = *HANDLE(id).OCRA;
     return ret;
 }
 
@@ -723,13 +748,13 @@ timer_error_t timer_8_bit_set_ocrb_register_value(uint8_t id, uint8_t ocrb)
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *internal_config[id].handle.OCRB = ocrb;
+    *HANDLE(id).OCRB = ocrb;
     return ret;
 }
 
@@ -746,20 +771,20 @@ timer_error_t timer_8_bit_get_ocrb_register_value(uint8_t id, uint8_t * ocrb)
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
-    *ocrb = *internal_config[id].handle.OCRB;
+    *ocrb = *HANDLE(id).OCRB;
     return ret;
 }
 
 static timer_error_t timer_8_bit_write_config(uint8_t id, timer_8_bit_config_t * const config)
 {
     timer_error_t ret = TIMER_ERROR_OK;
-    timer_8_bit_handle_t * handle = &internal_config[id].handle;
+    timer_8_bit_handle_t const * handle = &HANDLE(id);
     internal_config[id].prescaler = config->timing_config.prescaler;
 
     /* Initialise counter as well */
@@ -774,64 +799,31 @@ static timer_error_t timer_8_bit_write_config(uint8_t id, timer_8_bit_config_t *
     /* TCCRA register */
     *(handle->OCRA) = config->timing_config.ocra_val;
     *(handle->OCRB) = config->timing_config.ocrb_val;
-    *(handle->TCCRA) = (*(handle->TCCRA) & ~COMA_MSK) | (config->timing_config.comp_match_a << COMA_BIT);
-    *(handle->TCCRA) = (*(handle->TCCRA) & ~COMB_MSK) | (config->timing_config.comp_match_b << COMB_BIT);
-    *(handle->TCCRA) = (*(handle->TCCRA) & ~(WGM0_MSK | WGM1_MSK)) | (config->timing_config.waveform_mode & (WGM0_MSK | WGM1_MSK));
-
-    /* TCCRB register */
-    /* Select bit index 2 of waveform mode (matches datasheet bit mapping) and store it to bit index 3 of TCCRB with one more bitshift */
-    *(handle->TCCRB) = (*(handle->TCCRB) & ~WGM2_MSK) | ((config->timing_config.waveform_mode & (1U << 2U)) << 1U);
-
-    /* Handles force output compare A flags */
-    if (true == config->force_compare.force_comp_match_a)
-    {
-        *(handle->TCCRB) |= (1 << FOCA_BIT) ;
-    }
-    else
-    {
-        *(handle->TCCRB) &=  ~(1 << FOCA_BIT) ;
-    }
-
-    /* Handles force output compare A flags */
-    if (true == config->force_compare.force_comp_match_b)
-    {
-        *(handle->TCCRB) |= (1 << FOCB_BIT) ;
-    }
-    else
-    {
-        *(handle->TCCRB) &=  ~(1 << FOCB_BIT) ;
-    }
+    /* Control registers are composed in the shadow copies, then written once each */
+    SHADOW(id).TCCRA = 0U;
+    SHADOW(id).TCCRB = 0U;
+    SHADOW(id).TIMSK = 0U;
+    timer_generic_write_field(&SHADOW(id).TCCRA, COMA_MSK, config->timing_config.comp_match_a << COMA_BIT);
+    timer_generic_write_field(&SHADOW(id).TCCRA, COMB_MSK, config->timing_config.comp_match_b << COMB_BIT);
+    timer_generic_set_waveform(&SHADOW(id).TCCRA, &SHADOW(id).TCCRB, config->timing_config.waveform_mode, WGM2_MSK);
 
     /* NOTE : Do not handle prescaler until timer is manually started using timer_8_bit_start(id)*/
 
     /* TIMSK register */
-    if (true == config->interrupt_config.it_comp_match_a)
-    {
-        *(handle->TIMSK) |= 1U << OCIEA_BIT;
-    }
-    else
-    {
-        *(handle->TIMSK) &= ~(1U << OCIEA_BIT);
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, 1U << OCIEA_BIT, config->interrupt_config.it_comp_match_a);
 
-    if (true == config->interrupt_config.it_comp_match_b)
-    {
-        *(handle->TIMSK) |= 1U << OCIEB_BIT;
-    }
-    else
-    {
-        *(handle->TIMSK) &= ~(1U << OCIEB_BIT);
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, 1U << OCIEB_BIT, config->interrupt_config.it_comp_match_b);
 
     /* TOIE interrupt flag is the first bit, no need to bitshift it */
-    if (true == config->interrupt_config.it_timer_overflow)
-    {
-        *(handle->TIMSK) |= 1U;
-    }
-    else
-    {
-        *(handle->TIMSK) &= ~1U;
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, 1U, config->interrupt_config.it_timer_overflow);
+
+    SHADOW(id).dirty = TIMER_GENERIC_SHADOW_TCCRA | TIMER_GENERIC_SHADOW_TCCRB | TIMER_GENERIC_SHADOW_TIMSK;
+    SHADOW(id).deferred = false;
+    timer_generic_shadow_commit(&SHADOW(id), handle->TCCRA, handle->TCCRB, handle->TIMSK);
+
+    /* Force output compare strobes are not stored in the shadow copy, they only apply once */
+    timer_generic_reg_write_flag(handle->TCCRB, 1 << FOCA_BIT, config->force_compare.force_comp_match_a);
+    timer_generic_reg_write_flag(handle->TCCRB, 1 << FOCB_BIT, config->force_compare.force_comp_match_b);
     return ret;
 }
 
@@ -866,11 +858,13 @@ timer_error_t timer_8_bit_reconfigure(uint8_t id, timer_8_bit_config_t * const c
         return TIMER_ERROR_NULL_POINTER;
     }
 
+#ifndef USE_STATIC_BINDING
     ret = check_handle(&config->handle);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
+#endif
 
     ret = timer_8_bit_set_handle(id, &config->handle);
     if (TIMER_ERROR_OK != ret)
@@ -905,7 +899,7 @@ timer_error_t timer_8_bit_deinit(uint8_t id)
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -938,7 +932,7 @@ timer_error_t timer_8_bit_start(uint8_t id)
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -950,7 +944,8 @@ timer_error_t timer_8_bit_start(uint8_t id)
     }
 
     /* This time, set the prescaler to start the timer, unless prescaler is set to NO_CLOCK source */
-    *(internal_config[id].handle.TCCRB) = (*(internal_config[id].handle.TCCRB) & ~CS_MSK) | internal_config[id].prescaler;
+    timer_generic_write_field(&SHADOW(id).TCCRB, CS_MSK, internal_config[id].prescaler);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRB);
     return ret;
 }
 
@@ -968,7 +963,102 @@ timer_error_t timer_8_bit_stop(uint8_t id)
     }
 
     /* Reset prescaler to NO_CLOCK*/
-    *(internal_config[id].handle.TCCRB) = (*(internal_config[id].handle.TCCRB) & ~CS_MSK) | TIMER8BIT_CLK_NO_CLOCK;
+    timer_generic_write_field(&SHADOW(id).TCCRB, CS_MSK, TIMER8BIT_CLK_NO_CLOCK);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRB);
+    return ret;
+}
+
+timer_error_t timer_8_bit_begin_update(uint8_t id)
+{
+    timer_error_t ret = check_id(id);
+    if(TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    ret = check_stored_handle(id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    SHADOW(id).deferred = true;
+    return ret;
+}
+
+timer_error_t timer_8_bit_commit_update(uint8_t id)
+{
+    timer_error_t ret = check_id(id);
+    if(TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    ret = check_stored_handle(id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    SHADOW(id).deferred = false;
+    timer_generic_shadow_commit(&SHADOW(id), HANDLE(id).TCCRA, HANDLE(id).TCCRB, HANDLE(id).TIMSK);
+    return ret;
+}
+
+timer_error_t timer_8_bit_generate_frequency(uint8_t id, const uint32_t cpu_freq, const uint32_t frequency, uint32_t * const achieved_frequency)
+{
+    timer_error_t ret = check_id(id);
+    if(TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == achieved_frequency)
+    {
+        return TIMER_ERROR_NULL_POINTER;
+    }
+
+    ret = check_stored_handle(id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (false == internal_config[id].is_initialised)
+    {
+        return TIMER_ERROR_NOT_INITIALISED;
+    }
+
+    timer_generic_parameters_t parameters =
+    {
+        .input =
+        {
+            .cpu_frequency = cpu_freq,
+            .target_frequency = frequency,
+            .resolution = TIMER_GENERIC_RESOLUTION_8_BIT,
+            .prescaler_lookup_array.array = timer_8_bit_prescaler_table,
+            .prescaler_lookup_array.size = TIMER_8_BIT_MAX_PRESCALER_COUNT,
+        },
+    };
+    if (false == timer_generic_compute_toggle_parameters(&parameters, achieved_frequency))
+    {
+        return TIMER_ERROR_CONFIG;
+    }
+    const uint8_t ocra = (uint8_t) parameters.output.ocra;
+    internal_config[id].prescaler = timer_8_bit_prescaler_from_value(&parameters.output.prescaler);
+
+    /* OCRA is not buffered in CTC mode : when the period shrinks below current counter value, restart it
+       right away instead of letting the counter roll over MAX */
+    *HANDLE(id).OCRA = ocra;
+    if (*HANDLE(id).TCNT > ocra)
+    {
+        *HANDLE(id).TCNT = 0U;
+    }
+
+    timer_generic_set_waveform(&SHADOW(id).TCCRA, &SHADOW(id).TCCRB, TIMER8BIT_WG_CTC, WGM2_MSK);
+    timer_generic_write_field(&SHADOW(id).TCCRA, COMA_MSK, TIMER8BIT_CMOD_TOGGLE_OCnX << COMA_BIT);
+    timer_generic_write_field(&SHADOW(id).TCCRB, CS_MSK, internal_config[id].prescaler);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRA | TIMER_GENERIC_SHADOW_TCCRB);
     return ret;
 }
 
@@ -0,0 +1,255 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "timer_8_bit_async_model.h"
+#include <string.h>
+
+#define TIMER_8_BIT_ASYNC_MODEL_MAX   (0xFFU)
+
+static const uint16_t prescaler_values[8] = {0U, 1U, 8U, 32U, 64U, 128U, 256U, 1024U};
+
+static const uint8_t flag_masks[TIMER_8_BIT_ASYNC_MODEL_VECTOR_COUNT] = {OCFA_MSK, OCFB_MSK, TOV_MSK};
+static const uint8_t enable_masks[TIMER_8_BIT_ASYNC_MODEL_VECTOR_COUNT] = {OCIEA_MSK, OCIEB_MSK, TOIE_MSK};
+
+static inline timer_8_bit_async_waveform_generation_t get_waveform(timer_8_bit_async_model_t const * const model)
+{
+    uint8_t wgm = model->regs->TCCRA & (WGM0_MSK | WGM1_MSK);
+    if (0U != (model->regs->TCCRB & WGM2_MSK))
+    {
+        wgm |= 0x04U;
+    }
+    return (timer_8_bit_async_waveform_generation_t) wgm;
+}
+
+static inline bool is_phase_correct(const timer_8_bit_async_waveform_generation_t waveform)
+{
+    return (TIMER8BIT_ASYNC_WG_PWM_PHASE_CORRECT_FULL_RANGE == waveform) || (TIMER8BIT_ASYNC_WG_PWM_PHASE_CORRECT_OCRA_MAX == waveform);
+}
+
+static inline bool is_fast_pwm(const timer_8_bit_async_waveform_generation_t waveform)
+{
+    return (TIMER8BIT_ASYNC_WG_PWM_FAST_FULL_RANGE == waveform) || (TIMER8BIT_ASYNC_WG_PWM_FAST_OCRA_MAX == waveform);
+}
+
+static inline uint8_t get_top(timer_8_bit_async_model_t const * const model, const timer_8_bit_async_waveform_generation_t waveform)
+{
+    switch (waveform)
+    {
+        case TIMER8BIT_ASYNC_WG_CTC:
+            /* Compare registers are not buffered in CTC mode */
+            return model->regs->OCRA;
+        case TIMER8BIT_ASYNC_WG_PWM_FAST_OCRA_MAX:
+        case TIMER8BIT_ASYNC_WG_PWM_PHASE_CORRECT_OCRA_MAX:
+            return model->ocra;
+        default:
+            return TIMER_8_BIT_ASYNC_MODEL_MAX;
+    }
+}
+
+static inline void update_compare_buffers(timer_8_bit_async_model_t * const model)
+{
+    model->ocra = model->regs->OCRA;
+    model->ocrb = model->regs->OCRB;
+}
+
+/**
+ * @brief computes the output level after a compare match, using the COMnx bits of the channel
+*/
+static bool output_on_match(const uint8_t com, const bool level, const timer_8_bit_async_waveform_generation_t waveform, const bool counting_down)
+{
+    switch (com)
+    {
+        case TIMER8BIT_ASYNC_CMOD_TOGGLE_OCnX:
+            return !level;
+        case TIMER8BIT_ASYNC_CMOD_CLEAR_OCnX:
+            return (is_phase_correct(waveform) && counting_down);
+        case TIMER8BIT_ASYNC_CMOD_SET_OCnX:
+            return !(is_phase_correct(waveform) && counting_down);
+        default:
+            return level;
+    }
+}
+
+/**
+ * @brief compare units match while the counter holds the compare value, flags are raised and outputs change on the
+ * following timer clock (e.g. in CTC mode, OCFnA is raised when the counter is cleared)
+*/
+static void compare_match(timer_8_bit_async_model_t * const model, const timer_8_bit_async_waveform_generation_t waveform,
+                          const uint8_t counter, const bool counting_down)
+{
+    const uint8_t com_a = (model->regs->TCCRA & COMA_MSK) >> COMA_BIT;
+    const uint8_t com_b = (model->regs->TCCRA & COMB_MSK) >> COMB_BIT;
+    const uint8_t ocra = is_fast_pwm(waveform) || is_phase_correct(waveform) ? model->ocra : model->regs->OCRA;
+    const uint8_t ocrb = is_fast_pwm(waveform) || is_phase_correct(waveform) ? model->ocrb : model->regs->OCRB;
+
+    if (counter == ocra)
+    {
+        model->regs->TIFR |= OCFA_MSK;
+        model->output_a = output_on_match(com_a, model->output_a, waveform, counting_down);
+    }
+    if (counter == ocrb)
+    {
+        model->regs->TIFR |= OCFB_MSK;
+        model->output_b = output_on_match(com_b, model->output_b, waveform, counting_down);
+    }
+}
+
+/**
+ * @brief fast PWM outputs are set (non inverting) or cleared (inverting) when the counter restarts from BOTTOM
+*/
+static void restart_fast_pwm_outputs(timer_8_bit_async_model_t * const model)
+{
+    const uint8_t com_a = (model->regs->TCCRA & COMA_MSK) >> COMA_BIT;
+    const uint8_t com_b = (model->regs->TCCRA & COMB_MSK) >> COMB_BIT;
+    if (com_a >= TIMER8BIT_ASYNC_CMOD_CLEAR_OCnX)
+    {
+        model->output_a = (TIMER8BIT_ASYNC_CMOD_CLEAR_OCnX == com_a);
+    }
+    if (com_b >= TIMER8BIT_ASYNC_CMOD_CLEAR_OCnX)
+    {
+        model->output_b = (TIMER8BIT_ASYNC_CMOD_CLEAR_OCnX == com_b);
+    }
+}
+
+static void timer_clock(timer_8_bit_async_model_t * const model)
+{
+    const timer_8_bit_async_waveform_generation_t waveform = get_waveform(model);
+    const uint8_t top = get_top(model, waveform);
+    const uint8_t counter = model->regs->TCNT;
+    const bool counting_down = model->counting_down;
+    bool restarted = false;
+
+    if (is_phase_correct(waveform))
+    {
+        if (false == model->counting_down)
+        {
+            model->regs->TCNT++;
+            if (model->regs->TCNT >= top)
+            {
+                model->counting_down = true;
+                update_compare_buffers(model);
+            }
+        }
+        else
+        {
+            model->regs->TCNT--;
+            if (0U == model->regs->TCNT)
+            {
+                model->counting_down = false;
+                model->regs->TIFR |= TOV_MSK;
+            }
+        }
+    }
+    else if (counter == top)
+    {
+        model->regs->TCNT = 0U;
+        restarted = true;
+        /* TOV is raised at MAX, which is also TOP in normal and fast PWM modes */
+        if ((TIMER_8_BIT_ASYNC_MODEL_MAX == top) || is_fast_pwm(waveform))
+        {
+            model->regs->TIFR |= TOV_MSK;
+        }
+    }
+    else
+    {
+        model->regs->TCNT++;
+    }
+
+    compare_match(model, waveform, counter, counting_down);
+    if (restarted && is_fast_pwm(waveform))
+    {
+        update_compare_buffers(model);
+        restart_fast_pwm_outputs(model);
+    }
+
+    model->ticks++;
+    model->output_high_ticks[0] += model->output_a ? 1U : 0U;
+    model->output_high_ticks[1] += model->output_b ? 1U : 0U;
+}
+
+static void service_interrupts(timer_8_bit_async_model_t * const model)
+{
+    for (uint8_t i = 0 ; i < (uint8_t) TIMER_8_BIT_ASYNC_MODEL_VECTOR_COUNT ; i++)
+    {
+        if ((0U != (model->regs->TIFR & flag_masks[i]))
+        &&  (0U != (model->regs->TIMSK & enable_masks[i]))
+        &&  (NULL != model->isr[i]))
+        {
+            model->regs->TIFR &= (uint8_t) ~flag_masks[i];
+            model->isr_calls[i]++;
+            model->isr[i]();
+        }
+    }
+}
+
+void timer_8_bit_async_model_init(timer_8_bit_async_model_t * const model, timer_8_bit_async_registers_stub_t * const regs)
+{
+    memset(model, 0, sizeof(timer_8_bit_async_model_t));
+    model->regs = regs;
+    /* Flags cleared by the drivers (write one to clear) read back as set in the registers stub */
+    model->regs->TIFR = 0U;
+    update_compare_buffers(model);
+}
+
+void timer_8_bit_async_model_attach_isr(timer_8_bit_async_model_t * const model, const timer_8_bit_async_model_vector_t vector, timer_8_bit_async_model_isr_t isr)
+{
+    if (vector < TIMER_8_BIT_ASYNC_MODEL_VECTOR_COUNT)
+    {
+        model->isr[vector] = isr;
+    }
+}
+
+void timer_8_bit_async_model_run(timer_8_bit_async_model_t * const model, const uint32_t cycles)
+{
+    uint32_t remaining = cycles;
+    while (0U != remaining)
+    {
+        const uint16_t prescaler = prescaler_values[model->regs->TCCRB & CS_MSK];
+        if (0U == prescaler)
+        {
+            /* Stopped, nothing happens until the clock selection changes */
+            model->prescaler_count = 0U;
+            return;
+        }
+
+        /* Skips the cycles in between two timer clocks, the prescaler may have been lowered by an ISR */
+        const uint32_t to_clock = (model->prescaler_count < prescaler) ? (uint32_t)(prescaler - model->prescaler_count) : 1U;
+        if (remaining < to_clock)
+        {
+            model->prescaler_count += (uint16_t) remaining;
+            return;
+        }
+
+        remaining -= to_clock;
+        model->prescaler_count = 0U;
+        timer_clock(model);
+        service_interrupts(model);
+    }
+}
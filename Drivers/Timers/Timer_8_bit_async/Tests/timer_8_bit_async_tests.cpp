@@ -32,10 +32,17 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "config.h"
 #include "timer_8_bit_async.h"
 #include "timer_8_bit_async_registers_stub.h"
+#include "timer_8_bit_async_model.h"
 
 /* Default timer id */
 #define DT_ID 0
 
+static uint32_t prescaler_of(const timer_8_bit_async_prescaler_selection_t prescaler)
+{
+    const uint32_t values[8] = {0U, 1U, 8U, 32U, 64U, 128U, 256U, 1024U};
+    return values[prescaler];
+}
+
 class Timer8BitAsyncFixture : public ::testing::Test
 {
 public:
@@ -585,6 +592,66 @@ TEST_F(Timer8BitAsyncFixture, test_initialisation_deinitialisation)
 
 }
 
+TEST_F(Timer8BitAsyncFixture, test_rtc_mode)
+{
+    timer_error_t ret = timer_8_bit_async_rtc_init(DT_ID, &config.handle);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+
+    /* Crystal oscillator is selected, timer overflows once per second */
+    ASSERT_EQ(timer_8_bit_async_registers_stub.ASSR_REG & (AS2_MSK | EXCLK_MSK), AS2_MSK);
+    ASSERT_EQ(timer_8_bit_async_registers_stub.TCCRA, 0U);
+    ASSERT_EQ(timer_8_bit_async_registers_stub.TCCRB, (uint8_t) TIMER8BIT_ASYNC_CLK_PRESCALER_128);
+    ASSERT_EQ(timer_8_bit_async_registers_stub.TIMSK, TOIE_MSK);
+
+    uint32_t seconds = 0;
+    for (uint8_t i = 0 ; i < 3U ; i++)
+    {
+        timer_8_bit_async_rtc_overflow_callback(DT_ID);
+    }
+    ret = timer_8_bit_async_rtc_get_seconds(DT_ID, &seconds);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    ASSERT_EQ(seconds, 3U);
+
+    ret = timer_8_bit_async_rtc_set_seconds(DT_ID, 3600U);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    timer_8_bit_async_rtc_overflow_callback(DT_ID);
+    ret = timer_8_bit_async_rtc_get_seconds(DT_ID, &seconds);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    ASSERT_EQ(seconds, 3601U);
+
+    /* Device shall not enter sleep while an asynchronous update is still pending */
+    ret = timer_8_bit_async_rtc_prepare_sleep(DT_ID);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    timer_8_bit_async_registers_stub.ASSR_REG |= TCRBUB_MSK;
+    ret = timer_8_bit_async_rtc_prepare_sleep(DT_ID);
+    ASSERT_EQ(ret, TIMER_ERROR_REGISTER_IS_BUSY);
+
+    ret = timer_8_bit_async_rtc_get_seconds(DT_ID, NULL);
+    ASSERT_EQ(ret, TIMER_ERROR_NULL_POINTER);
+    ret = timer_8_bit_async_rtc_init(DT_ID, NULL);
+    ASSERT_EQ(ret, TIMER_ERROR_NULL_POINTER);
+}
+
+TEST_F(Timer8BitAsyncFixture, test_rtc_mode_crystal_not_started)
+{
+    timer_8_bit_async_registers_stub.TCCRA = (uint8_t) (TIMER8BIT_ASYNC_CMOD_TOGGLE_OCnX << COMA_BIT);
+    timer_8_bit_async_registers_stub.TCCRB = (uint8_t) TIMER8BIT_ASYNC_CLK_PRESCALER_8;
+    timer_8_bit_async_registers_stub.TIMSK = OCIEA_MSK;
+    timer_8_bit_async_registers_stub.OCRA = 42U;
+    timer_8_bit_async_registers_stub.OCRB = 12U;
+
+    /* Asynchronous updates never complete : previous configuration is restored on the I/O clock */
+    timer_8_bit_async_registers_stub.ASSR_REG = TCNUB_MSK;
+    timer_error_t ret = timer_8_bit_async_rtc_init(DT_ID, &config.handle);
+    ASSERT_EQ(ret, TIMER_ERROR_REGISTER_IS_BUSY);
+    ASSERT_EQ(timer_8_bit_async_registers_stub.ASSR_REG & AS2_MSK, 0U);
+    ASSERT_EQ(timer_8_bit_async_registers_stub.TCCRA, (uint8_t) (TIMER8BIT_ASYNC_CMOD_TOGGLE_OCnX << COMA_BIT));
+    ASSERT_EQ(timer_8_bit_async_registers_stub.TCCRB, (uint8_t) TIMER8BIT_ASYNC_CLK_PRESCALER_8);
+    ASSERT_EQ(timer_8_bit_async_registers_stub.TIMSK, OCIEA_MSK);
+    ASSERT_EQ(timer_8_bit_async_registers_stub.OCRA, 42U);
+    ASSERT_EQ(timer_8_bit_async_registers_stub.OCRB, 12U);
+}
+
 TEST(timer_8_bit_async_driver_tests, test_parameters_computation_prescaler)
 {
     uint32_t cpu_freq = 16'000'000;
@@ -632,6 +699,135 @@ TEST(timer_8_bit_async_driver_tests, test_parameters_computation_prescaler)
     ASSERT_EQ(accumulator, 124U);
 }
 
+static void model_compare_match_isr(void)
+{
+}
+
+TEST_F(Timer8BitAsyncFixture, test_model_ctc_tick_rate)
+{
+    timer_8_bit_async_model_t model;
+    timer_8_bit_async_model_init(&model, &timer_8_bit_async_registers_stub);
+    timer_8_bit_async_model_attach_isr(&model, TIMER_8_BIT_ASYNC_MODEL_VECTOR_COMPA, model_compare_match_isr);
+
+    /* Low frequencies need a software accumulator on top of the compare match : one tick every accumulator + 1 interrupts */
+    const uint32_t cpu_freq = 16'000'000;
+    const uint32_t target_freqs[3] = {1'000, 3'000, 1};
+    const uint32_t simulated_seconds[3] = {1U, 1U, 2U};
+    for (uint8_t i = 0 ; i < 3U ; i++)
+    {
+        uint16_t accumulator = 0;
+        timer_8_bit_async_compute_matching_parameters(&cpu_freq, &target_freqs[i], &config.timing_config.prescaler,
+                                                      &config.timing_config.ocra_val, &accumulator);
+        config.timing_config.waveform_mode = TIMER8BIT_ASYNC_WG_CTC;
+        config.interrupt_config.it_comp_match_a = true;
+        timer_error_t ret = timer_8_bit_async_reconfigure(DT_ID, &config);
+        ASSERT_EQ(ret, TIMER_ERROR_OK);
+        ret = timer_8_bit_async_start(DT_ID);
+        ASSERT_EQ(ret, TIMER_ERROR_OK);
+
+        model.isr_calls[TIMER_8_BIT_ASYNC_MODEL_VECTOR_COMPA] = 0U;
+        for (uint8_t second = 0 ; second < simulated_seconds[i] ; second++)
+        {
+            timer_8_bit_async_model_run(&model, cpu_freq);
+        }
+        /* 3 kHz is not an exact divider of the CPU clock : 16 MHz / 32 / 166 = 3012 Hz */
+        const uint32_t expected = cpu_freq / (prescaler_of(config.timing_config.prescaler) * (config.timing_config.ocra_val + 1U));
+        ASSERT_EQ(model.isr_calls[TIMER_8_BIT_ASYNC_MODEL_VECTOR_COMPA], expected * simulated_seconds[i]);
+        ASSERT_NEAR(expected, target_freqs[i] * (accumulator + 1U), target_freqs[i] / 100U);
+    }
+    ASSERT_EQ(model.isr_calls[TIMER_8_BIT_ASYNC_MODEL_VECTOR_OVF], 0U);
+}
+
+static uint32_t rtc_overflows = 0;
+static void model_rtc_overflow_isr(void)
+{
+    rtc_overflows++;
+    timer_8_bit_async_rtc_overflow_callback(DT_ID);
+}
+
+TEST_F(Timer8BitAsyncFixture, test_model_rtc_overflow_rate)
+{
+    timer_error_t ret = timer_8_bit_async_rtc_init(DT_ID, &config.handle);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    ret = timer_8_bit_async_rtc_set_seconds(DT_ID, 0U);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+
+    timer_8_bit_async_model_t model;
+    timer_8_bit_async_model_init(&model, &timer_8_bit_async_registers_stub);
+    timer_8_bit_async_model_attach_isr(&model, TIMER_8_BIT_ASYNC_MODEL_VECTOR_OVF, model_rtc_overflow_isr);
+    rtc_overflows = 0;
+
+    /* Timer is fed by the 32.768 kHz watch crystal on TOSC1 : one overflow per second */
+    for (uint8_t second = 0 ; second < 10U ; second++)
+    {
+        timer_8_bit_async_model_run(&model, 32'768U);
+    }
+    uint32_t seconds = 0;
+    ret = timer_8_bit_async_rtc_get_seconds(DT_ID, &seconds);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    ASSERT_EQ(seconds, 10U);
+    ASSERT_EQ(rtc_overflows, 10U);
+    ASSERT_EQ(model.isr_calls[TIMER_8_BIT_ASYNC_MODEL_VECTOR_COMPA], 0U);
+}
+
+TEST_F(Timer8BitAsyncFixture, test_model_pwm_duty_cycle)
+{
+    timer_8_bit_async_model_t model;
+    timer_8_bit_async_model_init(&model, &timer_8_bit_async_registers_stub);
+
+    /* Fast PWM : output is high during OCR + 1 timer clocks out of 256 */
+    config.timing_config.waveform_mode = TIMER8BIT_ASYNC_WG_PWM_FAST_FULL_RANGE;
+    config.timing_config.comp_match_a = TIMER8BIT_ASYNC_CMOD_CLEAR_OCnX;
+    config.timing_config.comp_match_b = TIMER8BIT_ASYNC_CMOD_SET_OCnX;
+    config.timing_config.ocra_val = 191U;
+    config.timing_config.ocrb_val = 191U;
+    config.timing_config.prescaler = TIMER8BIT_ASYNC_CLK_PRESCALER_32;
+    timer_error_t ret = timer_8_bit_async_reconfigure(DT_ID, &config);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+    ret = timer_8_bit_async_start(DT_ID);
+    ASSERT_EQ(ret, TIMER_ERROR_OK);
+
+    /* Output pins only change when counter restarts from BOTTOM : skip the first period */
+    timer_8_bit_async_model_run(&model, 256U * 32U);
+    model.ticks = 0U;
+    model.output_high_ticks[0] = 0U;
+    model.output_high_ticks[1] = 0U;
+    timer_8_bit_async_model_run(&model, 256U * 32U * 100U);
+    ASSERT_EQ(model.ticks, 25'600U);
+    ASSERT_EQ(model.output_high_ticks[0], 19'200U);
+
+    /* Inverting mode gives the complementary signal */
+    ASSERT_EQ(model.output_high_ticks[1], 6'400U);
+}
+
+TEST_F(Timer8BitAsyncFixture, test_generate_frequency)
+{
+    uint32_t achieved = 0;
+    ASSERT_EQ(timer_8_bit_async_generate_frequency(DT_ID, 16'000'000U, 1'000U, nullptr), TIMER_ERROR_NULL_POINTER);
+
+    /* Timer shall be initialised first, as this call starts it */
+    (void) timer_8_bit_async_deinit(DT_ID);
+    ASSERT_EQ(timer_8_bit_async_generate_frequency(DT_ID, 16'000'000U, 1'000U, &achieved), TIMER_ERROR_NOT_INITIALISED);
+    ASSERT_EQ(timer_8_bit_async_init(DT_ID, &config), TIMER_ERROR_OK);
+
+    timer_8_bit_async_model_t model;
+    timer_8_bit_async_model_init(&model, &timer_8_bit_async_registers_stub);
+    ASSERT_EQ(timer_8_bit_async_generate_frequency(DT_ID, 16'000'000U, 1'000U, &achieved), TIMER_ERROR_OK);
+    ASSERT_EQ(achieved, 1'000U);
+    ASSERT_EQ(timer_8_bit_async_registers_stub.OCRA, 249U);
+    ASSERT_EQ(timer_8_bit_async_registers_stub.TCCRB & CS_MSK, TIMER8BIT_ASYNC_CLK_PRESCALER_32);
+    ASSERT_EQ((timer_8_bit_async_registers_stub.TCCRA & COMA_MSK) >> COMA_BIT, TIMER8BIT_ASYNC_CMOD_TOGGLE_OCnX);
+
+    /* 100 ms : 100 periods, output pin toggles on each compare match and is high half of the time */
+    timer_8_bit_async_model_run(&model, 1'600'000U);
+    ASSERT_EQ(model.ticks, 50'000U);
+    ASSERT_EQ(model.output_high_ticks[0], 25'000U);
+
+    /* Registers being updated asynchronously cannot be written yet */
+    timer_8_bit_async_registers_stub.ASSR_REG |= OCRAUB_MSK;
+    ASSERT_EQ(timer_8_bit_async_generate_frequency(DT_ID, 16'000'000U, 3'000U, &achieved), TIMER_ERROR_REGISTER_IS_BUSY);
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
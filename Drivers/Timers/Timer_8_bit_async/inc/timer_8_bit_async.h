@@ -105,6 +105,8 @@ timer_error_t timer_8_bit_async_get_default_config(timer_8_bit_async_config_t *
 
 /**
  * @brief sets the handle of timer_8_bit driver
+ * Handle validity is checked once here : other functions return TIMER_ERROR_NULL_HANDLE as long as a complete handle is not set.
+ * When TIMER_8_BIT_ASYNC_STATIC_BINDING is defined, registers addresses are resolved at compile time and given handle is neither checked nor stored.
  * @param[in]   id     : targeted timer id (used to fetch internal configuration based on ids)
  * @param[in]   handle : handle to be copied into internal configuration
  * @return
@@ -428,6 +430,116 @@ timer_error_t timer_8_bit_async_start(uint8_t id);
 */
 timer_error_t timer_8_bit_async_stop(uint8_t id);
 
+/**
+ * @brief starts a batch of configuration changes : control registers (TCCRA, TCCRB, TIMSK) are only updated in the driver's
+ * shadow copies by subsequent setters, until timer_8_bit_async_commit_update() is called.
+ * @param[in]   id     : targeted timer id (used to fetch internal configuration based on ids)
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
+ *      TIMER_ERROR_NULL_HANDLE    :   driver handle is not set
+*/
+timer_error_t timer_8_bit_async_begin_update(uint8_t id);
+
+/**
+ * @brief ends a batch of configuration changes : each modified control register is written once, with its final value
+ * @param[in]   id     : targeted timer id (used to fetch internal configuration based on ids)
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
+ *      TIMER_ERROR_NULL_HANDLE    :   driver handle is not set
+ *      TIMER_ERROR_REGISTER_IS_BUSY : control registers are still being updated asynchronously, nothing was written
+*/
+timer_error_t timer_8_bit_async_commit_update(uint8_t id);
+
+/**
+ * @brief outputs a square wave of the requested frequency on OCnA pin, in one call : CTC mode, OCnA toggle on compare match,
+ * prescaler and OCRA are selected and applied with a single write of the control registers (or batched along with other
+ * changes when called between timer_8_bit_async_begin_update() and timer_8_bit_async_commit_update()). Timer starts counting right away, even
+ * if it was stopped : timer_8_bit_async_init() shall have been called first.
+ * Can be called again at runtime to retune the output frequency.
+ * @param[in]   id                  : targeted timer id (used to fetch internal configuration based on ids)
+ * @param[in]   cpu_freq            : cpu frequency, in Hz
+ * @param[in]   frequency           : requested output frequency, in Hz
+ * @param[out]  achieved_frequency  : closest frequency the timer can generate, in Hz
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
+ *      TIMER_ERROR_NULL_POINTER   :   achieved_frequency parameter points to NULL
+ *      TIMER_ERROR_NULL_HANDLE    :   driver handle is not set
+ *      TIMER_ERROR_NOT_INITIALISED :   timer was not initialised, nothing was written
+ *      TIMER_ERROR_CONFIG         :   requested frequency is out of the timer's range
+ *      TIMER_ERROR_REGISTER_IS_BUSY : control or compare registers are still being updated asynchronously, nothing was written
+*/
+timer_error_t timer_8_bit_async_generate_frequency(uint8_t id, const uint32_t cpu_freq, const uint32_t frequency, uint32_t * const achieved_frequency);
+
+/* ################################ Real time clock mode ############################### */
+
+/* Maximum number of ASSR polls before giving up on an asynchronous register update.
+   Once the crystal runs, an update completes within 2 asynchronous clock cycles (~61 us), but a 32768 Hz watch crystal
+   takes up to one second to start after power up (see the crystal datasheet). Each poll takes roughly 8 CPU cycles :
+   default value waits about one second at 16 MHz before timer_8_bit_async_rtc_init() gives up */
+#ifndef TIMER_8_BIT_ASYNC_BUSY_WAIT_LOOPS
+    #define TIMER_8_BIT_ASYNC_BUSY_WAIT_LOOPS (2000000UL)
+#endif
+
+/**
+ * @brief configures the timer as a real time clock fed by a 32768 Hz watch crystal connected to TOSC1/TOSC2.
+ * Timer runs in normal mode with a 128 prescaler and overflows once per second, overflow interrupt is enabled.
+ * Timer keeps on counting in power-save sleep mode and its overflow interrupt wakes the device up.
+ * timer_8_bit_async_rtc_overflow_callback() shall be called from the overflow ISR (e.g. TIMER2_OVF_vect).
+ * @param[in]   id     : targeted timer id (used to fetch internal configuration based on ids)
+ * @param[in]   handle : timer registers handle
+ * @return
+ *      TIMER_ERROR_OK               :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER    :   given id is out of range
+ *      TIMER_ERROR_NULL_POINTER     :   given handle points to NULL
+ *      TIMER_ERROR_NULL_HANDLE      :   given handle is not complete
+ *      TIMER_ERROR_REGISTER_IS_BUSY :   registers were not updated in time, crystal oscillator might not be stable yet (call it again).
+ *                                       Timer is switched back to the I/O clock and its previous configuration is restored
+*/
+timer_error_t timer_8_bit_async_rtc_init(uint8_t id, timer_8_bit_async_handle_t * const handle);
+
+/**
+ * @brief makes the timer ready for the device to enter power-save sleep mode. Shall be called right before each sleep,
+ * otherwise waking up and going back to sleep within the same asynchronous clock cycle prevents the next wake up.
+ * Note : this function busy-waits up to 2 asynchronous clock cycles
+ * @param[in]   id     : targeted timer id (used to fetch internal configuration based on ids)
+ * @return
+ *      TIMER_ERROR_OK               :   operation succeeded, device can enter power-save mode
+ *      TIMER_ERROR_UNKNOWN_TIMER    :   given id is out of range
+ *      TIMER_ERROR_NULL_HANDLE      :   driver handle is not set
+ *      TIMER_ERROR_REGISTER_IS_BUSY :   registers update did not complete in time, device shall not go to sleep
+*/
+timer_error_t timer_8_bit_async_rtc_prepare_sleep(uint8_t id);
+
+/**
+ * @brief A callback to be used within the timer overflow ISR (e.g. TIMER2_OVF_vect), increments the seconds counter
+ * @param[in]   id     : targeted timer id (used to fetch internal configuration based on ids)
+*/
+void timer_8_bit_async_rtc_overflow_callback(uint8_t id);
+
+/**
+ * @brief reads the seconds counter of the real time clock
+ * @param[in]   id      : targeted timer id (used to fetch internal configuration based on ids)
+ * @param[out]  seconds : seconds elapsed since timer_8_bit_async_rtc_init() (or since the last timer_8_bit_async_rtc_set_seconds())
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
+ *      TIMER_ERROR_NULL_POINTER   :   given seconds parameter points to NULL
+*/
+timer_error_t timer_8_bit_async_rtc_get_seconds(uint8_t id, uint32_t * const seconds);
+
+/**
+ * @brief sets the seconds counter of the real time clock (e.g. to set the wall clock time)
+ * @param[in]   id      : targeted timer id (used to fetch internal configuration based on ids)
+ * @param[in]   seconds : new seconds counter value
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER  :   given id is out of range
+*/
+timer_error_t timer_8_bit_async_rtc_set_seconds(uint8_t id, const uint32_t seconds);
+
 #define TIMER_8_BIT_ASYNC_MAX_PRESCALER_COUNT (7U)
 
 /**
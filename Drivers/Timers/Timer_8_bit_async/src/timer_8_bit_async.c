@@ -30,23 +30,56 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "config.h"
 #include "timer_8_bit_async.h"
+#include "critical_section.h"
 
 #include <stddef.h>
 #include <string.h>
 
+#ifndef UNIT_TESTING
+    #include <avr/io.h>
+    #include <avr/interrupt.h>
+#endif
+
 #ifndef TIMER_8_BIT_ASYNC_COUNT
     #error "TIMER_8_BIT_ASYNC_COUNT is not defined. Please add #define TIMER_8_BIT_ASYNC_COUNT in config.h to use this timer"
 #elif TIMER_8_BIT_ASYNC_COUNT == 0
     #warning "TIMER_8_BIT_ASYNC_COUNT is set to 0. If you don't project to use this timer, refer to not compile this file instead of setting this define to 0"
 #endif
 
+/* When TIMER_8_BIT_ASYNC_STATIC_BINDING is defined in config.h, registers addresses are resolved at compile time instead of being
+   fetched from the handle stored at runtime. The binding is only ever read with constant offsets so every register access
+   folds into a direct I/O instruction and no handle is kept in RAM, which restricts static binding to a single instance.
+   Default binding targets the ATmega328P Timer/Counter 2, another one can be provided through TIMER_8_BIT_ASYNC_STATIC_HANDLE.
+   Unit tests always rely on the runtime handle. */
+#if defined(TIMER_8_BIT_ASYNC_STATIC_BINDING) && !defined(UNIT_TESTING)
+    #include <avr/io.h>
+    #if TIMER_8_BIT_ASYNC_COUNT != 1
+        #error "TIMER_8_BIT_ASYNC_STATIC_BINDING only supports a single timer, please set TIMER_8_BIT_ASYNC_COUNT to 1"
+    #endif
+    #ifndef TIMER_8_BIT_ASYNC_STATIC_HANDLE
+        #define TIMER_8_BIT_ASYNC_STATIC_HANDLE { .TCCRA = &TCCR2A, .TCCRB = &TCCR2B, .TCNT = &TCNT2, .OCRA = &OCR2A, .OCRB = &OCR2B, .TIMSK = &TIMSK2, .TIFR = &TIFR2, .ASSR_REG = &ASSR }
+    #endif
+    #define USE_STATIC_BINDING
+    static const timer_8_bit_async_handle_t static_handle = TIMER_8_BIT_ASYNC_STATIC_HANDLE;
+    #define HANDLE(id) (*((void) (id), &static_handle))
+#else
+    #define HANDLE(id) (internal_config[(id)].handle)
+#endif
+
 static struct
 {
+#ifndef USE_STATIC_BINDING
     timer_8_bit_async_handle_t handle;
+    bool handle_is_valid;
+#endif
+    timer_generic_shadow_t shadow;
     timer_8_bit_async_prescaler_selection_t prescaler;
+    volatile uint32_t rtc_seconds;
     bool is_initialised;
 } internal_config[TIMER_8_BIT_ASYNC_COUNT] = {0};
 
+#define SHADOW(id) (internal_config[(id)].shadow)
+
 const timer_generic_prescaler_pair_t timer_8_bit_async_prescaler_table[TIMER_8_BIT_ASYNC_MAX_PRESCALER_COUNT] =
 {
     {.value = 1,    .type = (uint8_t) TIMER8BIT_ASYNC_CLK_PRESCALER_1      },
@@ -143,13 +176,59 @@ static inline timer_error_t check_id(uint8_t id)
 
 static inline timer_error_t check_reg_busy(uint8_t id, uint8_t mask)
 {
-    if (0 != (*internal_config[id].handle.ASSR_REG & mask))
+    if (0 != (*HANDLE(id).ASSR_REG & mask))
     {
         return TIMER_ERROR_REGISTER_IS_BUSY;
     }
     return TIMER_ERROR_OK;
 }
 
+/**
+ * @brief polls ASSR until selected update busy flags are cleared by hardware.
+ * Each asynchronous register update takes up to 2 cycles of the asynchronous clock (~61 us with a 32768 Hz crystal)
+*/
+static timer_error_t wait_reg_ready(uint8_t id, uint8_t mask)
+{
+    for (uint32_t i = 0 ; i < TIMER_8_BIT_ASYNC_BUSY_WAIT_LOOPS ; i++)
+    {
+        if (TIMER_ERROR_OK == check_reg_busy(id, mask))
+        {
+            return TIMER_ERROR_OK;
+        }
+    }
+    return check_reg_busy(id, mask);
+}
+
+/**
+ * @brief checks the handle stored for this timer, validity is evaluated once when the handle is set
+*/
+static inline timer_error_t check_stored_handle(const uint8_t id)
+{
+#ifdef USE_STATIC_BINDING
+    (void) id;
+    return TIMER_ERROR_OK;
+#else
+    if (false == internal_config[id].handle_is_valid)
+    {
+        return TIMER_ERROR_NULL_HANDLE;
+    }
+    return TIMER_ERROR_OK;
+#endif
+}
+
+/**
+ * @brief marks shadow registers as modified and writes them to the device, unless changes are batched
+ * using timer_8_bit_async_begin_update()
+*/
+static inline void update_registers(const uint8_t id, const uint8_t registers)
+{
+    SHADOW(id).dirty |= registers;
+    if (false == SHADOW(id).deferred)
+    {
+        timer_generic_shadow_commit(&SHADOW(id), HANDLE(id).TCCRA, HANDLE(id).TCCRB, HANDLE(id).TIMSK);
+    }
+}
+
 timer_error_t timer_8_bit_async_set_handle(uint8_t id, timer_8_bit_async_handle_t * const handle)
 {
     timer_error_t ret = check_id(id);
@@ -163,7 +242,18 @@ timer_error_t timer_8_bit_async_set_handle(uint8_t id, timer_8_bit_async_handle_
         return TIMER_ERROR_NULL_POINTER;
     }
 
+#ifdef USE_STATIC_BINDING
+    /* Registers are bound at compile time, given handle is not stored */
+    (void) handle;
+#else
     memcpy(&internal_config[id].handle, handle, sizeof(timer_8_bit_async_handle_t));
+    internal_config[id].handle_is_valid = (TIMER_ERROR_OK == check_handle(handle));
+    if (false == internal_config[id].handle_is_valid)
+    {
+        return ret;
+    }
+#endif
+    timer_generic_shadow_load(&SHADOW(id), HANDLE(id).TCCRA, HANDLE(id).TCCRB, HANDLE(id).TIMSK, FOCA_MSK | FOCB_MSK);
     return ret;
 }
 
@@ -180,7 +270,19 @@ timer_error_t timer_8_bit_async_get_handle(uint8_t id, timer_8_bit_async_handle_
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    memcpy(handle, &internal_config[id].handle, sizeof(timer_8_bit_async_handle_t));
+#ifdef USE_STATIC_BINDING
+    /* Field by field copy lets each address fold into an immediate store instead of copying the binding from memory */
+    handle->TCCRA    = HANDLE(id).TCCRA;
+    handle->TCCRB    = HANDLE(id).TCCRB;
+    handle->TCNT     = HANDLE(id).TCNT;
+    handle->OCRA     = HANDLE(id).OCRA;
+    handle->OCRB     = HANDLE(id).OCRB;
+    handle->TIMSK    = HANDLE(id).TIMSK;
+    handle->TIFR     = HANDLE(id).TIFR;
+    handle->ASSR_REG = HANDLE(id).ASSR_REG;
+#else
+    memcpy(handle, &HANDLE(id), sizeof(timer_8_bit_async_handle_t));
+#endif
     return ret;
 }
 
@@ -240,7 +342,7 @@ timer_error_t timer_8_bit_async_set_force_compare_config(uint8_t id, timer_8_bit
     }
 
     /* Not fully configured handle, do not attempt to write to it until configured !*/
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -255,24 +357,10 @@ timer_error_t timer_8_bit_async_set_force_compare_config(uint8_t id, timer_8_bit
     }
 
     /* Handles force output compare A flags */
-    if (true == force_comp_config->force_comp_match_a)
-    {
-        *(internal_config[id].handle.TCCRB) |= (1U << FOCA_BIT) ;
-    }
-    else
-    {
-        *(internal_config[id].handle.TCCRB) &=  ~(1U << FOCA_BIT) ;
-    }
+    timer_generic_reg_write_flag(HANDLE(id).TCCRB, 1U << FOCA_BIT, force_comp_config->force_comp_match_a);
 
     /* Handles force output compare A flags */
-    if (true == force_comp_config->force_comp_match_b)
-    {
-        *(internal_config[id].handle.TCCRB) |= (1U << FOCB_BIT) ;
-    }
-    else
-    {
-        *(internal_config[id].handle.TCCRB) &=  ~(1U << FOCB_BIT) ;
-    }
+    timer_generic_reg_write_flag(HANDLE(id).TCCRB, 1U << FOCB_BIT, force_comp_config->force_comp_match_b);
     return ret;
 }
 
@@ -288,7 +376,7 @@ timer_error_t timer_8_bit_async_get_force_compare_config(uint8_t id, timer_8_bit
         return TIMER_ERROR_NULL_POINTER;
     }
     /* Not fully configured handle, do not attempt to write to it until configured !*/
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -301,24 +389,10 @@ timer_error_t timer_8_bit_async_get_force_compare_config(uint8_t id, timer_8_bit
     }
 
     /* Handles Force Compare Output A flag */
-    if (0U == (*(internal_config[id].handle.TCCRB) & FOCA_MSK))
-    {
-        force_comp_config->force_comp_match_a = false;
-    }
-    else
-    {
-        force_comp_config->force_comp_match_a = true;
-    }
+    force_comp_config->force_comp_match_a = timer_generic_reg_read_flag(HANDLE(id).TCCRB, FOCA_MSK);
 
     /* Handles Force Compare Output B flag */
-    if (0U == (*(internal_config[id].handle.TCCRB) & FOCB_MSK))
-    {
-        force_comp_config->force_comp_match_b = false;
-    }
-    else
-    {
-        force_comp_config->force_comp_match_b = true;
-    }
+    force_comp_config->force_comp_match_b = timer_generic_reg_read_flag(HANDLE(id).TCCRB, FOCB_MSK);
     return ret;
 }
 
@@ -334,40 +408,20 @@ timer_error_t timer_8_bit_async_set_interrupt_config(uint8_t id, timer_8_bit_asy
     {
         return TIMER_ERROR_NULL_POINTER;
     }
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
     /* TIMSK register */
-    if (true == it_config->it_comp_match_a)
-    {
-        *(internal_config[id].handle.TIMSK) |= 1U << OCIEA_BIT;
-    }
-    else
-    {
-        *(internal_config[id].handle.TIMSK) &= ~(1U << OCIEA_BIT);
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, 1U << OCIEA_BIT, it_config->it_comp_match_a);
 
-    if (true == it_config->it_comp_match_b)
-    {
-        *(internal_config[id].handle.TIMSK) |= 1U << OCIEB_BIT;
-    }
-    else
-    {
-        *(internal_config[id].handle.TIMSK) &= ~(1U << OCIEB_BIT);
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, 1U << OCIEB_BIT, it_config->it_comp_match_b);
 
     /* TOIE interrupt flag is the first bit, no need to bitshift it */
-    if (true == it_config->it_timer_overflow)
-    {
-        *(internal_config[id].handle.TIMSK) |= 1U;
-    }
-    else
-    {
-        *(internal_config[id].handle.TIMSK) &= ~1U;
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, 1U, it_config->it_timer_overflow);
+    update_registers(id, TIMER_GENERIC_SHADOW_TIMSK);
     return ret;
 }
 
@@ -385,41 +439,20 @@ timer_error_t timer_8_bit_async_get_interrupt_config(uint8_t id, timer_8_bit_asy
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
 
     /* Output Compare Match A Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIMSK) & OCIEA_MSK))
-    {
-        it_config->it_comp_match_a = false;
-    }
-    else
-    {
-        it_config->it_comp_match_a = true;
-    }
+    it_config->it_comp_match_a = timer_generic_read_flag(&SHADOW(id).TIMSK, OCIEA_MSK);
 
     /* Output Compare Match B Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIMSK) & OCIEB_MSK))
-    {
-        it_config->it_comp_match_b = false;
-    }
-    else
-    {
-        it_config->it_comp_match_b = true;
-    }
+    it_config->it_comp_match_b = timer_generic_read_flag(&SHADOW(id).TIMSK, OCIEB_MSK);
 
     /* Timer Overflow Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIMSK) & 1U))
-    {
-        it_config->it_timer_overflow = false;
-    }
-    else
-    {
-        it_config->it_timer_overflow = true;
-    }
+    it_config->it_timer_overflow = timer_generic_read_flag(&SHADOW(id).TIMSK, 1U);
     return ret;
 }
 
@@ -437,7 +470,7 @@ timer_error_t timer_8_bit_async_get_interrupt_flags(uint8_t id, timer_8_bit_asyn
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -445,34 +478,13 @@ timer_error_t timer_8_bit_async_get_interrupt_flags(uint8_t id, timer_8_bit_asyn
 
 
     /* Output Compare Match A Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIFR) & OCIEA_MSK))
-    {
-        it_flags->it_comp_match_a = false;
-    }
-    else
-    {
-        it_flags->it_comp_match_a = true;
-    }
+    it_flags->it_comp_match_a = timer_generic_reg_read_flag(HANDLE(id).TIFR, OCIEA_MSK);
 
     /* Output Compare Match B Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIFR) & OCIEB_MSK))
-    {
-        it_flags->it_comp_match_b = false;
-    }
-    else
-    {
-        it_flags->it_comp_match_b = true;
-    }
+    it_flags->it_comp_match_b = timer_generic_reg_read_flag(HANDLE(id).TIFR, OCIEB_MSK);
 
     /* Timer Overflow Interrupt Flag */
-    if (0U == (*(internal_config[id].handle.TIFR) & 1U))
-    {
-        it_flags->it_timer_overflow = false;
-    }
-    else
-    {
-        it_flags->it_timer_overflow = true;
-    }
+    it_flags->it_timer_overflow = timer_generic_reg_read_flag(HANDLE(id).TIFR, 1U);
 
     return ret;
 
@@ -489,7 +501,7 @@ timer_error_t timer_8_bit_async_set_prescaler(uint8_t id, const timer_8_bit_asyn
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -503,7 +515,8 @@ timer_error_t timer_8_bit_async_set_prescaler(uint8_t id, const timer_8_bit_asyn
         return ret;
     }
 
-    *(internal_config[id].handle.TCCRB) = (*(internal_config[id].handle.TCCRB) & ~CS_MSK) | prescaler;
+    timer_generic_write_field(&SHADOW(id).TCCRB, CS_MSK, prescaler);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRB);
     return ret;
 }
 
@@ -520,7 +533,7 @@ timer_error_t timer_8_bit_async_get_prescaler(uint8_t id, timer_8_bit_async_pres
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -534,7 +547,7 @@ timer_error_t timer_8_bit_async_get_prescaler(uint8_t id, timer_8_bit_async_pres
         return ret;
     }
 
-    *prescaler = (*(internal_config[id].handle.TCCRB) & CS_MSK);
+    *prescaler = (SHADOW(id).TCCRB & CS_MSK);
     return ret;
 }
 
@@ -546,7 +559,7 @@ timer_error_t timer_8_bit_async_set_compare_match_A(uint8_t id, const timer_8_bi
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -560,7 +573,8 @@ timer_error_t timer_8_bit_async_set_compare_match_A(uint8_t id, const timer_8_bi
         return ret;
     }
 
-    *(internal_config[id].handle.TCCRA) = (*(internal_config[id].handle.TCCRA) & ~COMA_MSK) | (compA << COMA_BIT);
+    timer_generic_write_field(&SHADOW(id).TCCRA, COMA_MSK, compA << COMA_BIT);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRA);
     return ret;
 }
 
@@ -577,7 +591,7 @@ timer_error_t timer_8_bit_async_get_compare_match_A(uint8_t id, timer_8_bit_asyn
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -591,7 +605,7 @@ timer_error_t timer_8_bit_async_get_compare_match_A(uint8_t id, timer_8_bit_asyn
         return ret;
     }
 
-    *compA = ((*(internal_config[id].handle.TCCRA) & COMA_MSK) >> COMA_BIT);
+    *compA = ((SHADOW(id).TCCRA & COMA_MSK) >> COMA_BIT);
     return ret;
 }
 
@@ -603,7 +617,7 @@ timer_error_t timer_8_bit_async_set_compare_match_B(uint8_t id, timer_8_bit_asyn
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -617,7 +631,8 @@ timer_error_t timer_8_bit_async_set_compare_match_B(uint8_t id, timer_8_bit_asyn
         return ret;
     }
 
-    *(internal_config[id].handle.TCCRA) = (*(internal_config[id].handle.TCCRA) & ~COMB_MSK) | (compB << COMB_BIT);
+    timer_generic_write_field(&SHADOW(id).TCCRA, COMB_MSK, compB << COMB_BIT);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRA);
     return ret;
 }
 
@@ -634,7 +649,7 @@ timer_error_t timer_8_bit_async_get_compare_match_B(uint8_t id, timer_8_bit_asyn
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -648,7 +663,7 @@ timer_error_t timer_8_bit_async_get_compare_match_B(uint8_t id, timer_8_bit_asyn
         return ret;
     }
 
-    *compB = ((*(internal_config[id].handle.TCCRA) & COMB_MSK) >> COMB_BIT);
+    *compB = ((SHADOW(id).TCCRA & COMB_MSK) >> COMB_BIT);
     return ret;
 }
 
@@ -660,7 +675,7 @@ timer_error_t timer_8_bit_async_set_waveform_generation(uint8_t id, const timer_
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -672,9 +687,8 @@ timer_error_t timer_8_bit_async_set_waveform_generation(uint8_t id, const timer_
         return ret;
     }
 
-    *(internal_config[id].handle.TCCRA) = (*(internal_config[id].handle.TCCRA) & ~(WGM0_MSK | WGM1_MSK)) | (waveform & (WGM0_MSK | WGM1_MSK));
-    /* Select bit index 2 of waveform mode (matches datasheet bit mapping) and store it to bit index 3 of TCCRB with one more bitshift */
-    *(internal_config[id].handle.TCCRB) = (*(internal_config[id].handle.TCCRB) & ~WGM2_MSK) | (waveform & (1U << 2U) << 1U);
+    timer_generic_set_waveform(&SHADOW(id).TCCRA, &SHADOW(id).TCCRB, waveform, WGM2_MSK);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRA | TIMER_GENERIC_SHADOW_TCCRB);
     return ret;
 }
 
@@ -691,7 +705,7 @@ timer_error_t timer_8_bit_async_get_waveform_generation(uint8_t id, timer_8_bit_
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -703,9 +717,7 @@ timer_error_t timer_8_bit_async_get_waveform_generation(uint8_t id, timer_8_bit_
         return ret;
     }
 
-    *waveform = (timer_8_bit_async_waveform_generation_t)(0U);
-    *waveform |= (*(internal_config[id].handle.TCCRA) & (WGM0_MSK | WGM1_MSK));
-    *waveform |= (*(internal_config[id].handle.TCCRB) & (WGM2_MSK)) >> 1U;
+    *waveform = (timer_8_bit_async_waveform_generation_t) timer_generic_get_waveform(&SHADOW(id).TCCRA, &SHADOW(id).TCCRB, WGM2_MSK);
     return ret;
 }
 
@@ -717,7 +729,7 @@ timer_error_t timer_8_bit_async_set_counter_value(uint8_t id, const uint8_t tick
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -732,7 +744,7 @@ timer_error_t timer_8_bit_async_set_counter_value(uint8_t id, const uint8_t tick
     }
 
     /* Write new value to internal timer/counter register */
-    *(internal_config[id].handle.TCNT) = ticks;
+    *(HANDLE(id).TCNT) = ticks;
     return ret;
 }
 
@@ -749,7 +761,7 @@ timer_error_t timer_8_bit_async_get_counter_value(uint8_t id, uint8_t * ticks)
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -764,7 +776,7 @@ timer_error_t timer_8_bit_async_get_counter_value(uint8_t id, uint8_t * ticks)
     }
 
     /* Transfer data from internal device's timer/count main register */
-    *ticks = *internal_config[id].handle.TCNT;
+    *ticks = *HANDLE(id).TCNT;
     return ret;
 }
 
@@ -776,7 +788,7 @@ timer_error_t timer_8_bit_async_set_ocra_register_value(uint8_t id, uint8_t ocra
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -790,7 +802,7 @@ timer_error_t timer_8_bit_async_set_ocra_register_value(uint8_t id, uint8_t ocra
         return ret;
     }
 
-    *internal_config[id].handle.OCRA = ocra;
+    *HANDLE(id).OCRA = ocra;
     return ret;
 }
 
@@ -807,7 +819,7 @@ timer_error_t timer_8_bit_async_get_ocra_register_value(uint8_t id, uint8_t * oc
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -821,7 +833,7 @@ timer_error_t timer_8_bit_async_get_ocra_register_value(uint8_t id, uint8_t * oc
         return ret;
     }
 
-    *ocra = *internal_config[id].handle.OCRA;
+    *ocra = *HANDLE(id).OCRA;
     return ret;
 }
 
@@ -833,7 +845,7 @@ timer_error_t timer_8_bit_async_set_ocrb_register_value(uint8_t id, uint8_t ocrb
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -847,7 +859,7 @@ timer_error_t timer_8_bit_async_set_ocrb_register_value(uint8_t id, uint8_t ocrb
         return ret;
     }
 
-    *internal_config[id].handle.OCRB = ocrb;
+    *HANDLE(id).OCRB = ocrb;
     return ret;
 }
 
@@ -864,7 +876,7 @@ timer_error_t timer_8_bit_async_get_ocrb_register_value(uint8_t id, uint8_t * oc
         return TIMER_ERROR_NULL_POINTER;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -878,14 +890,14 @@ timer_error_t timer_8_bit_async_get_ocrb_register_value(uint8_t id, uint8_t * oc
         return ret;
     }
 
-    *ocrb = *internal_config[id].handle.OCRB;
+    *ocrb = *HANDLE(id).OCRB;
     return ret;
 }
 
 static timer_error_t timer_8_bit_async_write_config(uint8_t id, timer_8_bit_async_config_t * const config)
 {
     timer_error_t ret = TIMER_ERROR_OK;
-    timer_8_bit_async_handle_t * handle = &internal_config[id].handle;
+    timer_8_bit_async_handle_t const * handle = &HANDLE(id);
 
     /* If register is asynchronously updated, it will be blocked by hardware and any read/write operation
      * will be discarded. See datasheet for further details */
@@ -897,6 +909,10 @@ static timer_error_t timer_8_bit_async_write_config(uint8_t id, timer_8_bit_asyn
 
     internal_config[id].prescaler = config->timing_config.prescaler;
 
+    /* Clock source shall be selected before writing timer registers, as switching it may corrupt their content */
+    timer_generic_reg_write_flag(handle->ASSR_REG, EXCLK_MSK, false);
+    timer_generic_reg_write_flag(handle->ASSR_REG, AS2_MSK, (TIMER8BIT_ASYNC_CLK_SOURCE_EXTERNAL == config->timing_config.clock_source));
+
     /* Clear all interrupts */
     *(handle->TIFR) = 0U;
 
@@ -909,64 +925,31 @@ static timer_error_t timer_8_bit_async_write_config(uint8_t id, timer_8_bit_asyn
 	/* TCCRA register */
 	*(handle->OCRA) = config->timing_config.ocra_val;
     *(handle->OCRB) = config->timing_config.ocrb_val;
-    *(handle->TCCRA) = (*(handle->TCCRA) & ~COMA_MSK) | (config->timing_config.comp_match_a << COMA_BIT);
-    *(handle->TCCRA) = (*(handle->TCCRA) & ~COMB_MSK) | (config->timing_config.comp_match_b << COMB_BIT);
-    *(handle->TCCRA) = (*(handle->TCCRA) & ~(WGM0_MSK | WGM1_MSK)) | (config->timing_config.waveform_mode & (WGM0_MSK | WGM1_MSK));
-
-    /* TCCRB register */
-    /* Select bit index 2 of waveform mode (matches datasheet bit mapping) and store it to bit index 3 of TCCRB with one more bitshift */
-    *(handle->TCCRB) = (*(handle->TCCRB) & ~WGM2_MSK) | ((config->timing_config.waveform_mode & (1U << 2U)) << 1U);
-
-    /* Handles force output compare A flags */
-    if (true == config->force_compare.force_comp_match_a)
-    {
-        *(handle->TCCRB) |= (1 << FOCA_BIT) ;
-    }
-    else
-    {
-        *(handle->TCCRB) &=  ~(1 << FOCA_BIT) ;
-    }
-
-    /* Handles force output compare A flags */
-    if (true == config->force_compare.force_comp_match_b)
-    {
-        *(handle->TCCRB) |= (1 << FOCB_BIT) ;
-    }
-    else
-    {
-        *(handle->TCCRB) &=  ~(1 << FOCB_BIT) ;
-    }
+    /* Control registers are composed in the shadow copies, then written once each */
+    SHADOW(id).TCCRA = 0U;
+    SHADOW(id).TCCRB = 0U;
+    SHADOW(id).TIMSK = 0U;
+    timer_generic_write_field(&SHADOW(id).TCCRA, COMA_MSK, config->timing_config.comp_match_a << COMA_BIT);
+    timer_generic_write_field(&SHADOW(id).TCCRA, COMB_MSK, config->timing_config.comp_match_b << COMB_BIT);
+    timer_generic_set_waveform(&SHADOW(id).TCCRA, &SHADOW(id).TCCRB, config->timing_config.waveform_mode, WGM2_MSK);
 
     /* NOTE : Do not handle prescaler until timer is manually started using timer_8_bit_async_start(id)*/
 
     /* TIMSK register */
-    if (true == config->interrupt_config.it_comp_match_a)
-    {
-        *(handle->TIMSK) |= 1U << OCIEA_BIT;
-    }
-    else
-    {
-        *(handle->TIMSK) &= ~(1U << OCIEA_BIT);
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, 1U << OCIEA_BIT, config->interrupt_config.it_comp_match_a);
 
-    if (true == config->interrupt_config.it_comp_match_b)
-    {
-        *(handle->TIMSK) |= 1U << OCIEB_BIT;
-    }
-    else
-    {
-        *(handle->TIMSK) &= ~(1U << OCIEB_BIT);
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, 1U << OCIEB_BIT, config->interrupt_config.it_comp_match_b);
 
     /* TOIE interrupt flag is the first bit, no need to bitshift it */
-    if (true == config->interrupt_config.it_timer_overflow)
-    {
-        *(handle->TIMSK) |= 1U;
-    }
-    else
-    {
-        *(handle->TIMSK) &= ~1U;
-    }
+    timer_generic_write_flag(&SHADOW(id).TIMSK, 1U, config->interrupt_config.it_timer_overflow);
+
+    SHADOW(id).dirty = TIMER_GENERIC_SHADOW_TCCRA | TIMER_GENERIC_SHADOW_TCCRB | TIMER_GENERIC_SHADOW_TIMSK;
+    SHADOW(id).deferred = false;
+    timer_generic_shadow_commit(&SHADOW(id), handle->TCCRA, handle->TCCRB, handle->TIMSK);
+
+    /* Force output compare strobes are not stored in the shadow copy, they only apply once */
+    timer_generic_reg_write_flag(handle->TCCRB, 1 << FOCA_BIT, config->force_compare.force_comp_match_a);
+    timer_generic_reg_write_flag(handle->TCCRB, 1 << FOCB_BIT, config->force_compare.force_comp_match_b);
     return ret;
 }
 
@@ -1014,7 +997,7 @@ timer_error_t timer_8_bit_async_deinit(uint8_t id)
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -1051,11 +1034,13 @@ timer_error_t timer_8_bit_async_reconfigure(uint8_t id, timer_8_bit_async_config
         return TIMER_ERROR_NULL_POINTER;
     }
 
+#ifndef USE_STATIC_BINDING
     ret = check_handle(&config->handle);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
     }
+#endif
 
     ret = timer_8_bit_async_set_handle(id, &config->handle);
     if (TIMER_ERROR_OK != ret)
@@ -1091,7 +1076,7 @@ timer_error_t timer_8_bit_async_start(uint8_t id)
         return ret;
     }
 
-    ret = check_handle(&internal_config[id].handle);
+    ret = check_stored_handle(id);
     if (TIMER_ERROR_OK != ret)
     {
         return ret;
@@ -1111,7 +1096,8 @@ timer_error_t timer_8_bit_async_start(uint8_t id)
     }
 
     /* This time, set the prescaler to start the timer, unless prescaler is set to NO_CLOCK source */
-    *(internal_config[id].handle.TCCRB) = (*(internal_config[id].handle.TCCRB) & ~CS_MSK) | internal_config[id].prescaler;
+    timer_generic_write_field(&SHADOW(id).TCCRB, CS_MSK, internal_config[id].prescaler);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRB);
     return ret;
 }
 
@@ -1137,6 +1123,266 @@ timer_error_t timer_8_bit_async_stop(uint8_t id)
     }
 
     /* Reset prescaler to NO_CLOCK*/
-    *(internal_config[id].handle.TCCRB) = (*(internal_config[id].handle.TCCRB) & ~CS_MSK) | TIMER8BIT_ASYNC_CLK_NO_CLOCK;
+    timer_generic_write_field(&SHADOW(id).TCCRB, CS_MSK, TIMER8BIT_ASYNC_CLK_NO_CLOCK);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRB);
+    return ret;
+}
+
+timer_error_t timer_8_bit_async_begin_update(uint8_t id)
+{
+    timer_error_t ret = check_id(id);
+    if(TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    ret = check_stored_handle(id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    SHADOW(id).deferred = true;
+    return ret;
+}
+
+timer_error_t timer_8_bit_async_commit_update(uint8_t id)
+{
+    timer_error_t ret = check_id(id);
+    if(TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    ret = check_stored_handle(id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    /* Asynchronous registers updates are discarded by hardware while a previous update is still pending */
+    ret = check_reg_busy(id, (TCRBUB_MSK | TCRAUB_MSK));
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    SHADOW(id).deferred = false;
+    timer_generic_shadow_commit(&SHADOW(id), HANDLE(id).TCCRA, HANDLE(id).TCCRB, HANDLE(id).TIMSK);
+    return ret;
+}
+
+timer_error_t timer_8_bit_async_generate_frequency(uint8_t id, const uint32_t cpu_freq, const uint32_t frequency, uint32_t * const achieved_frequency)
+{
+    timer_error_t ret = check_id(id);
+    if(TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == achieved_frequency)
+    {
+        return TIMER_ERROR_NULL_POINTER;
+    }
+
+    ret = check_stored_handle(id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (false == internal_config[id].is_initialised)
+    {
+        return TIMER_ERROR_NOT_INITIALISED;
+    }
+
+    /* If register is asynchronously updated, it will be blocked by hardware and any read/write operation
+     * will be discarded. See datasheet for further details */
+    ret = check_reg_busy(id, (OCRAUB_MSK | TCNUB_MSK | TCRAUB_MSK | TCRBUB_MSK));
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    timer_generic_parameters_t parameters =
+    {
+        .input =
+        {
+            .cpu_frequency = cpu_freq,
+            .target_frequency = frequency,
+            .resolution = TIMER_GENERIC_RESOLUTION_8_BIT,
+            .prescaler_lookup_array.array = timer_8_bit_async_prescaler_table,
+            .prescaler_lookup_array.size = TIMER_8_BIT_ASYNC_MAX_PRESCALER_COUNT,
+        },
+    };
+    if (false == timer_generic_compute_toggle_parameters(&parameters, achieved_frequency))
+    {
+        return TIMER_ERROR_CONFIG;
+    }
+    const uint8_t ocra = (uint8_t) parameters.output.ocra;
+    internal_config[id].prescaler = timer_8_bit_async_prescaler_from_value(&parameters.output.prescaler);
+
+    /* OCRA is not buffered in CTC mode : when the period shrinks below current counter value, restart it
+       right away instead of letting the counter roll over MAX */
+    *HANDLE(id).OCRA = ocra;
+    if (*HANDLE(id).TCNT > ocra)
+    {
+        *HANDLE(id).TCNT = 0U;
+    }
+
+    timer_generic_set_waveform(&SHADOW(id).TCCRA, &SHADOW(id).TCCRB, TIMER8BIT_ASYNC_WG_CTC, WGM2_MSK);
+    timer_generic_write_field(&SHADOW(id).TCCRA, COMA_MSK, TIMER8BIT_ASYNC_CMOD_TOGGLE_OCnX << COMA_BIT);
+    timer_generic_write_field(&SHADOW(id).TCCRB, CS_MSK, internal_config[id].prescaler);
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRA | TIMER_GENERIC_SHADOW_TCCRB);
+    return ret;
+}
+
+timer_error_t timer_8_bit_async_rtc_init(uint8_t id, timer_8_bit_async_handle_t * const handle)
+{
+    timer_error_t ret = check_id(id);
+    if(TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == handle)
+    {
+        return TIMER_ERROR_NULL_POINTER;
+    }
+
+    ret = timer_8_bit_async_set_handle(id, handle);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    ret = check_stored_handle(id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    /* Previous configuration is restored if the crystal oscillator does not start */
+    const timer_generic_shadow_t previous_shadow = SHADOW(id);
+    const timer_8_bit_async_prescaler_selection_t previous_prescaler = internal_config[id].prescaler;
+    const uint8_t previous_tcnt = *(HANDLE(id).TCNT);
+    const uint8_t previous_ocra = *(HANDLE(id).OCRA);
+    const uint8_t previous_ocrb = *(HANDLE(id).OCRB);
+
+    /* Follows the datasheet sequence to switch to the asynchronous clock source :
+     * timer interrupts are disabled first, then the crystal oscillator is selected before any other timer register is written */
+    SHADOW(id).TIMSK = 0U;
+    SHADOW(id).deferred = false;
+    update_registers(id, TIMER_GENERIC_SHADOW_TIMSK);
+    timer_generic_reg_write_flag(HANDLE(id).ASSR_REG, EXCLK_MSK, false);
+    timer_generic_reg_write_flag(HANDLE(id).ASSR_REG, AS2_MSK, true);
+
+    /* Normal mode, 32768 Hz / 128 / 256 : timer overflows once per second */
+    *(HANDLE(id).TCNT) = 0U;
+    *(HANDLE(id).OCRA) = 0U;
+    *(HANDLE(id).OCRB) = 0U;
+    SHADOW(id).TCCRA = 0U;
+    SHADOW(id).TCCRB = (uint8_t) TIMER8BIT_ASYNC_CLK_PRESCALER_128;
+    update_registers(id, TIMER_GENERIC_SHADOW_TCCRA | TIMER_GENERIC_SHADOW_TCCRB);
+    internal_config[id].prescaler = TIMER8BIT_ASYNC_CLK_PRESCALER_128;
+    internal_config[id].rtc_seconds = 0U;
+
+    /* Updates are only transferred once the crystal runs, which can take a while after power up */
+    ret = wait_reg_ready(id, (OCRBUB_MSK | OCRAUB_MSK | TCNUB_MSK | TCRBUB_MSK | TCRAUB_MSK));
+    if (TIMER_ERROR_OK != ret)
+    {
+        /* Switches back to the I/O clock : counter, compare and control registers content is unreliable
+         * after a clock source change, so they are all written again before interrupts are restored */
+        timer_generic_reg_write_flag(HANDLE(id).ASSR_REG, AS2_MSK, false);
+        *(HANDLE(id).TCNT) = previous_tcnt;
+        *(HANDLE(id).OCRA) = previous_ocra;
+        *(HANDLE(id).OCRB) = previous_ocrb;
+        SHADOW(id).TCCRA = previous_shadow.TCCRA;
+        SHADOW(id).TCCRB = previous_shadow.TCCRB;
+        update_registers(id, TIMER_GENERIC_SHADOW_TCCRA | TIMER_GENERIC_SHADOW_TCCRB);
+        *(HANDLE(id).TIFR) = (TOV_MSK | OCFA_MSK | OCFB_MSK);
+        SHADOW(id).TIMSK = previous_shadow.TIMSK;
+        update_registers(id, TIMER_GENERIC_SHADOW_TIMSK);
+        SHADOW(id).deferred = previous_shadow.deferred;
+        internal_config[id].prescaler = previous_prescaler;
+        return ret;
+    }
+
+    /* Flags might have been raised while switching clocks, they are cleared by writing ones */
+    *(HANDLE(id).TIFR) = (TOV_MSK | OCFA_MSK | OCFB_MSK);
+    SHADOW(id).TIMSK = TOIE_MSK;
+    update_registers(id, TIMER_GENERIC_SHADOW_TIMSK);
+    internal_config[id].is_initialised = true;
+    return ret;
+}
+
+timer_error_t timer_8_bit_async_rtc_prepare_sleep(uint8_t id)
+{
+    timer_error_t ret = check_id(id);
+    if(TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    ret = check_stored_handle(id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    /* Rewriting TCCRB with its own value and waiting for the update to complete guarantees that at least one
+     * asynchronous clock cycle elapsed since wake up : otherwise the wake up logic is not rearmed and the device
+     * would either wake up immediately or never wake up. This also flushes any pending register update */
+    ret = wait_reg_ready(id, (OCRBUB_MSK | OCRAUB_MSK | TCNUB_MSK | TCRBUB_MSK | TCRAUB_MSK));
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    *(HANDLE(id).TCCRB) = SHADOW(id).TCCRB;
+    ret = wait_reg_ready(id, TCRBUB_MSK);
+    return ret;
+}
+
+void timer_8_bit_async_rtc_overflow_callback(uint8_t id)
+{
+    if (TIMER_ERROR_OK == check_id(id))
+    {
+        internal_config[id].rtc_seconds++;
+    }
+}
+
+timer_error_t timer_8_bit_async_rtc_get_seconds(uint8_t id, uint32_t * const seconds)
+{
+    timer_error_t ret = check_id(id);
+    if(TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == seconds)
+    {
+        return TIMER_ERROR_NULL_POINTER;
+    }
+
+    uint8_t sreg = 0;
+    CRITICAL_SECTION_ENTER(sreg);
+    *seconds = internal_config[id].rtc_seconds;
+    CRITICAL_SECTION_EXIT(sreg);
+    return ret;
+}
+
+timer_error_t timer_8_bit_async_rtc_set_seconds(uint8_t id, const uint32_t seconds)
+{
+    timer_error_t ret = check_id(id);
+    if(TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    uint8_t sreg = 0;
+    CRITICAL_SECTION_ENTER(sreg);
+    internal_config[id].rtc_seconds = seconds;
+    CRITICAL_SECTION_EXIT(sreg);
     return ret;
 }
@@ -83,6 +83,125 @@ TEST(timer_generic_driver_tests, test_compute_parameters)
 
 }
 
+TEST(timer_generic_driver_tests, test_compute_toggle_parameters)
+{
+    const uint8_t array_size = 5U;
+    timer_generic_prescaler_pair_t array[array_size] =
+    {
+        {1U,    1U},
+        {8U,    2U},
+        {64U,   3U},
+        {256U,  4U},
+        {1024U, 5U},
+    };
+    timer_generic_parameters_t parameters;
+    uint32_t achieved = 0;
+    parameters.input.cpu_frequency = 16'000'000U;
+    parameters.input.target_frequency = 1'000U;
+    parameters.input.resolution = TIMER_GENERIC_RESOLUTION_8_BIT;
+    parameters.input.prescaler_lookup_array.array = array;
+    parameters.input.prescaler_lookup_array.size = array_size;
+
+    ASSERT_TRUE(timer_generic_compute_toggle_parameters(&parameters, &achieved));
+    ASSERT_EQ(parameters.output.prescaler, 64U);
+    ASSERT_EQ(parameters.output.ocra, 124U);
+    ASSERT_EQ(parameters.output.accumulator, 0U);
+    ASSERT_EQ(achieved, 1'000U);
+    ASSERT_EQ(parameters.input.target_frequency, 1'000U);
+
+    /* 41.67 counts, rounded to the closest value */
+    parameters.input.target_frequency = 3'000U;
+    ASSERT_TRUE(timer_generic_compute_toggle_parameters(&parameters, &achieved));
+    ASSERT_EQ(parameters.output.prescaler, 64U);
+    ASSERT_EQ(parameters.output.ocra, 41U);
+    ASSERT_EQ(achieved, 2'976U);
+
+    /* Highest frequency : toggles on each cpu cycle */
+    parameters.input.target_frequency = 8'000'000U;
+    ASSERT_TRUE(timer_generic_compute_toggle_parameters(&parameters, &achieved));
+    ASSERT_EQ(parameters.output.prescaler, 1U);
+    ASSERT_EQ(parameters.output.ocra, 0U);
+    ASSERT_EQ(achieved, 8'000'000U);
+
+    /* Out of range frequencies */
+    parameters.input.target_frequency = 9'000'000U;
+    ASSERT_FALSE(timer_generic_compute_toggle_parameters(&parameters, &achieved));
+    parameters.input.target_frequency = 0U;
+    ASSERT_FALSE(timer_generic_compute_toggle_parameters(&parameters, &achieved));
+    parameters.input.target_frequency = 10U;
+    ASSERT_FALSE(timer_generic_compute_toggle_parameters(&parameters, &achieved));
+
+    /* ... but reachable with a 16 bit timer */
+    parameters.input.resolution = TIMER_GENERIC_RESOLUTION_16_BIT;
+    ASSERT_TRUE(timer_generic_compute_toggle_parameters(&parameters, &achieved));
+    ASSERT_EQ(parameters.output.prescaler, 64U);
+    ASSERT_EQ(parameters.output.ocra, 12'499U);
+    ASSERT_EQ(achieved, 10U);
+}
+
+TEST(timer_generic_driver_tests, test_shared_core_register_accesses)
+{
+    uint8_t tccra = 0xF0;
+    uint8_t tccrb = 0xC7;
+
+    /* Bit fields are written without touching other bits */
+    timer_generic_write_field(&tccra, 0x30, 0x2 << 4U);
+    ASSERT_EQ(0xE0, tccra);
+    timer_generic_write_flag(&tccrb, 0x40, false);
+    ASSERT_EQ(0x87, tccrb);
+    ASSERT_TRUE(timer_generic_read_flag(&tccrb, 0x80));
+    ASSERT_FALSE(timer_generic_read_flag(&tccrb, 0x40));
+
+    /* Device register flavour behaves the same way */
+    volatile uint8_t assr = 0x40;
+    timer_generic_reg_write_flag(&assr, 0x20, true);
+    ASSERT_EQ(0x60, assr);
+    timer_generic_reg_write_flag(&assr, 0x40, false);
+    ASSERT_EQ(0x20, assr);
+    ASSERT_TRUE(timer_generic_reg_read_flag(&assr, 0x20));
+    ASSERT_FALSE(timer_generic_reg_read_flag(&assr, 0x40));
+
+    /* 8 bits timers : WGM2 lands on bit 3 of TCCRB */
+    tccra = 0U;
+    tccrb = 0U;
+    timer_generic_set_waveform(&tccra, &tccrb, 0x07, 0x08);
+    ASSERT_EQ(0x03, tccra);
+    ASSERT_EQ(0x08, tccrb);
+    ASSERT_EQ(0x07, timer_generic_get_waveform(&tccra, &tccrb, 0x08));
+
+    /* 16 bits timers : WGM2 and WGM3 land on bits 3 and 4 of TCCRB */
+    timer_generic_set_waveform(&tccra, &tccrb, 0x0E, 0x18);
+    ASSERT_EQ(0x02, tccra);
+    ASSERT_EQ(0x18, tccrb);
+    ASSERT_EQ(0x0E, timer_generic_get_waveform(&tccra, &tccrb, 0x18));
+}
+
+TEST(timer_generic_driver_tests, test_shadow_registers_commit)
+{
+    volatile uint8_t tccra = 0x81;
+    volatile uint8_t tccrb = 0xC2;
+    volatile uint8_t timsk = 0x01;
+    timer_generic_shadow_t shadow;
+
+    /* Force output compare strobes are not part of the shadow copy */
+    timer_generic_shadow_load(&shadow, &tccra, &tccrb, &timsk, 0xC0);
+    ASSERT_EQ(0x81, shadow.TCCRA);
+    ASSERT_EQ(0x02, shadow.TCCRB);
+    ASSERT_EQ(0x01, shadow.TIMSK);
+    ASSERT_EQ(0U, shadow.dirty);
+
+    /* Only registers marked as dirty are written */
+    shadow.TCCRA = 0x00;
+    shadow.TCCRB = 0x05;
+    shadow.TIMSK = 0x06;
+    shadow.dirty = TIMER_GENERIC_SHADOW_TCCRB;
+    timer_generic_shadow_commit(&shadow, &tccra, &tccrb, &timsk);
+    ASSERT_EQ(0x81, tccra);
+    ASSERT_EQ(0x05, tccrb);
+    ASSERT_EQ(0x01, timsk);
+    ASSERT_EQ(0U, shadow.dirty);
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
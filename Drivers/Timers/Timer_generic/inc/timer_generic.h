@@ -98,6 +98,192 @@ typedef struct
 
 void timer_generic_compute_parameters(timer_generic_parameters_t * const parameters);
 
+/**
+ * @brief computes prescaler and OCRA values used to output a square wave by toggling an output compare pin in CTC mode.
+ * Output pin toggles once per compare match, so the timer is tuned to twice the requested frequency : prescaler is first selected
+ * by timer_generic_compute_parameters() then OCRA is rounded to the nearest value, moving on to the next prescaler if it does
+ * not fit in the timer's resolution. Accumulator is never used (always set to 0).
+ * @param[in,out]   parameters          : input.target_frequency is the requested output frequency, output is filled with the
+ *                                        selected prescaler and OCRA values
+ * @param[out]      achieved_frequency  : output frequency actually generated with the selected parameters
+ * @return true when the requested frequency can be generated, false otherwise (null, higher than half the cpu frequency or
+ * too low for the largest prescaler)
+*/
+bool timer_generic_compute_toggle_parameters(timer_generic_parameters_t * const parameters, uint32_t * const achieved_frequency);
+
+/* #########################################################################################
+   ################################ Shared timer core ######################################
+   ######################################################################################### */
+
+/* 8 bits, 8 bits async and 16 bits timers share the same layout for TCCRA (COMx and WGM0/1 bits),
+   TCCRB (CS and WGM2 bits) and TIMSK/TIFR registers. Register manipulation is implemented once here
+   and used by all timer drivers, drivers only keep their own parameters validation. */
+
+#define TIMER_GENERIC_WGM_TCCRA_MSK     (0x03)  /**< WGM0 and WGM1 bits, stored in TCCRA                           */
+#define TIMER_GENERIC_WGM_TCCRB_SHIFT   (1U)    /**< Upper WGM bits are stored in TCCRB, one bit further left   */
+
+#define TIMER_GENERIC_SHADOW_TCCRA      (0x01)  /**< TCCRA shadow register has to be written to the device   */
+#define TIMER_GENERIC_SHADOW_TCCRB      (0x02)  /**< TCCRB shadow register has to be written to the device   */
+#define TIMER_GENERIC_SHADOW_TIMSK      (0x04)  /**< TIMSK shadow register has to be written to the device   */
+
+/**
+ * @brief RAM copy of the control registers of a timer. Configuration changes are composed in this copy,
+ * then each modified register is written to the device with a single write operation.
+*/
+typedef struct
+{
+    uint8_t TCCRA;      /**< Timer/Counter control register A copy                                       */
+    uint8_t TCCRB;      /**< Timer/Counter control register B copy (strobe bits are never kept)          */
+    uint8_t TIMSK;      /**< Timer interrupt mask register copy                                          */
+    uint8_t dirty;      /**< Registers modified since last commit (TIMER_GENERIC_SHADOW_xxx flags)       */
+    bool deferred;      /**< When true, modified registers are only written on an explicit commit        */
+} timer_generic_shadow_t;
+
+/* Helpers below are static inline : they are called with compile-time masks from the timer drivers, so each call
+   folds into a few instructions instead of a call with a pointer argument. Bit field helpers work on the RAM shadow
+   copy (plain accesses, the compiler is free to merge them), only timer_generic_reg_xxx helpers and shadow
+   load/commit actually touch the device registers. */
+
+/**
+ * @brief writes a bit field of a shadow register, leaving other bits untouched
+ * @param[in]   reg     : targeted shadow register
+ * @param[in]   mask    : mask of the bit field
+ * @param[in]   value   : value to be written, already shifted to the bit field position
+*/
+static inline void timer_generic_write_field(uint8_t * const reg, const uint8_t mask, const uint8_t value)
+{
+    *reg = (uint8_t)((*reg & ~mask) | (value & mask));
+}
+
+/**
+ * @brief sets or clears bits of a shadow register, leaving other bits untouched
+ * @param[in]   reg     : targeted shadow register
+ * @param[in]   mask    : bits to be set or cleared
+ * @param[in]   enabled : sets bits when true, clears them otherwise
+*/
+static inline void timer_generic_write_flag(uint8_t * const reg, const uint8_t mask, const bool enabled)
+{
+    if (true == enabled)
+    {
+        *reg = (uint8_t)(*reg | mask);
+    }
+    else
+    {
+        *reg = (uint8_t)(*reg & ~mask);
+    }
+}
+
+/**
+ * @brief reads a flag from a shadow register
+ * @param[in]   reg     : targeted shadow register
+ * @param[in]   mask    : flag mask
+ * @return true if any of the bits of the mask is set
+*/
+static inline bool timer_generic_read_flag(const uint8_t * const reg, const uint8_t mask)
+{
+    return (0U != (*reg & mask));
+}
+
+/**
+ * @brief sets or clears bits of a device register (read-modify-write), used for registers which are not shadowed
+ * such as strobes (FOCx) and ASSR
+ * @param[in]   reg     : targeted device register
+ * @param[in]   mask    : bits to be set or cleared
+ * @param[in]   enabled : sets bits when true, clears them otherwise
+*/
+static inline void timer_generic_reg_write_flag(volatile uint8_t * const reg, const uint8_t mask, const bool enabled)
+{
+    if (true == enabled)
+    {
+        *reg = (uint8_t)(*reg | mask);
+    }
+    else
+    {
+        *reg = (uint8_t)(*reg & ~mask);
+    }
+}
+
+/**
+ * @brief reads a flag from a device register
+ * @param[in]   reg     : targeted device register
+ * @param[in]   mask    : flag mask
+ * @return true if any of the bits of the mask is set
+*/
+static inline bool timer_generic_reg_read_flag(volatile uint8_t * const reg, const uint8_t mask)
+{
+    return (0U != (*reg & mask));
+}
+
+/**
+ * @brief writes waveform generation mode : WGM0 and WGM1 bits go to TCCRA, upper bits go to TCCRB (starting from bit 3)
+ * @param[in]   tccra       : TCCRA shadow register of targeted timer
+ * @param[in]   tccrb       : TCCRB shadow register of targeted timer
+ * @param[in]   waveform    : waveform generation mode, as listed in the datasheet (WGMn..WGM0)
+ * @param[in]   tccrb_mask  : mask of WGM bits in TCCRB (WGM2 for 8 bits timers, WGM2 and WGM3 for 16 bits timers)
+*/
+static inline void timer_generic_set_waveform(uint8_t * const tccra, uint8_t * const tccrb, const uint8_t waveform, const uint8_t tccrb_mask)
+{
+    timer_generic_write_field(tccra, TIMER_GENERIC_WGM_TCCRA_MSK, waveform);
+    timer_generic_write_field(tccrb, tccrb_mask, (uint8_t)((waveform & ~TIMER_GENERIC_WGM_TCCRA_MSK) << TIMER_GENERIC_WGM_TCCRB_SHIFT));
+}
+
+/**
+ * @brief reads waveform generation mode from TCCRA and TCCRB shadow registers
+ * @param[in]   tccra       : TCCRA shadow register of targeted timer
+ * @param[in]   tccrb       : TCCRB shadow register of targeted timer
+ * @param[in]   tccrb_mask  : mask of WGM bits in TCCRB (WGM2 for 8 bits timers, WGM2 and WGM3 for 16 bits timers)
+ * @return waveform generation mode, as listed in the datasheet (WGMn..WGM0)
+*/
+static inline uint8_t timer_generic_get_waveform(const uint8_t * const tccra, const uint8_t * const tccrb, const uint8_t tccrb_mask)
+{
+    uint8_t waveform = (uint8_t)(*tccra & TIMER_GENERIC_WGM_TCCRA_MSK);
+    waveform = (uint8_t)(waveform | ((*tccrb & tccrb_mask) >> TIMER_GENERIC_WGM_TCCRB_SHIFT));
+    return waveform;
+}
+
+/**
+ * @brief loads shadow registers from the device, usually done once when a timer handle is set
+ * @param[out]  shadow          : shadow registers to be loaded
+ * @param[in]   tccra           : TCCRA register of targeted timer
+ * @param[in]   tccrb           : TCCRB register of targeted timer
+ * @param[in]   timsk           : TIMSK register of targeted timer
+ * @param[in]   tccrb_strobes   : mask of TCCRB bits which are only strobes and shall not be written back (e.g. FOCx bits)
+*/
+static inline void timer_generic_shadow_load(timer_generic_shadow_t * const shadow, volatile uint8_t * const tccra, volatile uint8_t * const tccrb,
+                                             volatile uint8_t * const timsk, const uint8_t tccrb_strobes)
+{
+    shadow->TCCRA = *tccra;
+    shadow->TCCRB = (uint8_t)(*tccrb & ~tccrb_strobes);
+    shadow->TIMSK = *timsk;
+    shadow->dirty = 0U;
+    shadow->deferred = false;
+}
+
+/**
+ * @brief writes modified shadow registers to the device (one write per register, no read back) and clears the dirty flags
+ * @param[in]   shadow  : shadow registers of targeted timer
+ * @param[in]   tccra   : TCCRA register of targeted timer
+ * @param[in]   tccrb   : TCCRB register of targeted timer
+ * @param[in]   timsk   : TIMSK register of targeted timer
+*/
+static inline void timer_generic_shadow_commit(timer_generic_shadow_t * const shadow, volatile uint8_t * const tccra, volatile uint8_t * const tccrb,
+                                               volatile uint8_t * const timsk)
+{
+    if (0U != (shadow->dirty & TIMER_GENERIC_SHADOW_TCCRA))
+    {
+        *tccra = shadow->TCCRA;
+    }
+    if (0U != (shadow->dirty & TIMER_GENERIC_SHADOW_TCCRB))
+    {
+        *tccrb = shadow->TCCRB;
+    }
+    if (0U != (shadow->dirty & TIMER_GENERIC_SHADOW_TIMSK))
+    {
+        *timsk = shadow->TIMSK;
+    }
+    shadow->dirty = 0U;
+}
+
 #ifdef __cplusplus
 }
 #endif
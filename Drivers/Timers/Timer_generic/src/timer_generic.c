@@ -108,3 +108,45 @@ void timer_generic_compute_parameters(timer_generic_parameters_t * const paramet
         parameters->output.ocra = computed_ocra;
     }
 }
+
+bool timer_generic_compute_toggle_parameters(timer_generic_parameters_t * const parameters, uint32_t * const achieved_frequency)
+{
+    const uint32_t frequency = parameters->input.target_frequency;
+    const uint32_t limit_value = (parameters->input.resolution == TIMER_GENERIC_RESOLUTION_8_BIT) ? TIMER_GENERIC_8_BIT_LIMIT_VALUE : TIMER_GENERIC_16_BIT_LIMIT_VALUE;
+    if ((0U == frequency) || (frequency > (parameters->input.cpu_frequency / 2U)))
+    {
+        return false;
+    }
+
+    // One period of the output signal lasts two compare matches
+    parameters->input.target_frequency = frequency * 2U;
+    timer_generic_compute_parameters(parameters);
+    parameters->input.target_frequency = frequency;
+    parameters->output.accumulator = 0;
+
+    for (uint8_t i = 0 ; i < parameters->input.prescaler_lookup_array.size ; i++)
+    {
+        const uint16_t prescaler = parameters->input.prescaler_lookup_array.array[i].value;
+        if (prescaler < parameters->output.prescaler)
+        {
+            continue;
+        }
+
+        // Rounded division, gives the closest frequency instead of always undershooting it
+        const uint32_t timer_frequency = parameters->input.cpu_frequency / prescaler;
+        uint32_t counts = (timer_frequency + frequency) / (2U * frequency);
+        if (0U == counts)
+        {
+            counts = 1U;
+        }
+
+        if (counts <= limit_value)
+        {
+            parameters->output.prescaler = prescaler;
+            parameters->output.ocra = (uint16_t)(counts - 1U);
+            *achieved_frequency = timer_frequency / (2U * counts);
+            return true;
+        }
+    }
+    return false;
+}
@@ -28,23 +28,10 @@ You should have received a copy of the GNU General Public License
 along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
-#ifndef TIMER_16_BIT_STUB_HEADER
-#define TIMER_16_BIT_STUB_HEADER
+#ifndef CONFIG_HEADER
+#define CONFIG_HEADER
 
-#ifdef __cplusplus
-extern "C"
-{
-#endif
+/* Allows to chain up to 3 handlers on each timer interrupt vector */
+#define TIMER_ISR_MAX_HANDLERS 3U
 
-#include "timer_16_bit.h"
-#define TIMER_16_BIT_STUB_MAX_INSTANCES (1U)
-
-void timer_16_bit_stub_set_next_parameters(const timer_16_bit_prescaler_selection_t prescaler, const uint16_t ocra, const uint32_t accumulator);
-void timer_16_bit_stub_set_initialised(const bool initialised);
-void timer_16_bit_stub_reset(void);
-#ifdef __cplusplus
-}
-#endif
-
-
-#endif /* TIMER_16_BIT_STUB_HEADER */
\ No newline at end of file
+#endif /* CONFIG_HEADER */
\ No newline at end of file
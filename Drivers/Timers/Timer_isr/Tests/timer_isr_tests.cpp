@@ -0,0 +1,112 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gtest/gtest.h"
+#include "timer_isr.h"
+
+#include <vector>
+
+static std::vector<uint16_t> calls;
+
+static void first_handler(const uint8_t arg)
+{
+    calls.push_back(0x100U | arg);
+}
+
+static void second_handler(const uint8_t arg)
+{
+    calls.push_back(0x200U | arg);
+}
+
+class TimerIsrFixture : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        timer_isr_init();
+        calls.clear();
+    }
+};
+
+TEST_F(TimerIsrFixture, guard_parameters)
+{
+    ASSERT_EQ(timer_isr_attach(TIMER_ISR_VECTOR_COUNT, first_handler, 0U), TIMER_ERROR_UNKNOWN_TIMER);
+    ASSERT_EQ(timer_isr_attach(TIMER_ISR_VECTOR_TIMER0_OVF, nullptr, 0U), TIMER_ERROR_NULL_POINTER);
+    ASSERT_EQ(timer_isr_detach(TIMER_ISR_VECTOR_COUNT, first_handler, 0U), TIMER_ERROR_UNKNOWN_TIMER);
+    ASSERT_EQ(timer_isr_detach(TIMER_ISR_VECTOR_TIMER0_OVF, nullptr, 0U), TIMER_ERROR_NULL_POINTER);
+    ASSERT_EQ(timer_isr_detach(TIMER_ISR_VECTOR_TIMER0_OVF, first_handler, 0U), TIMER_ERROR_NOT_INITIALISED);
+
+    /* Nothing attached, nothing called */
+    timer_isr_dispatch(TIMER_ISR_VECTOR_TIMER0_OVF);
+    ASSERT_TRUE(calls.empty());
+}
+
+TEST_F(TimerIsrFixture, test_chained_handlers)
+{
+    ASSERT_EQ(timer_isr_attach(TIMER_ISR_VECTOR_TIMER2_COMPA, first_handler, 0U), TIMER_ERROR_OK);
+    ASSERT_EQ(timer_isr_attach(TIMER_ISR_VECTOR_TIMER2_COMPA, second_handler, 1U), TIMER_ERROR_OK);
+    ASSERT_EQ(timer_isr_attach(TIMER_ISR_VECTOR_TIMER2_COMPA, first_handler, 2U), TIMER_ERROR_OK);
+    ASSERT_EQ(timer_isr_attach(TIMER_ISR_VECTOR_TIMER2_COMPA, second_handler, 3U), TIMER_ERROR_CONFIG);
+    ASSERT_EQ(timer_isr_attach(TIMER_ISR_VECTOR_TIMER1_CAPT, second_handler, 4U), TIMER_ERROR_OK);
+
+    /* Same handler and argument cannot be attached twice */
+    ASSERT_EQ(timer_isr_attach(TIMER_ISR_VECTOR_TIMER1_CAPT, second_handler, 4U), TIMER_ERROR_ALREADY_INITIALISED);
+
+    timer_isr_dispatch(TIMER_ISR_VECTOR_TIMER2_COMPA);
+    ASSERT_EQ(calls, std::vector<uint16_t>({0x100U, 0x201U, 0x102U}));
+
+    calls.clear();
+    timer_isr_dispatch(TIMER_ISR_VECTOR_TIMER1_CAPT);
+    ASSERT_EQ(calls, std::vector<uint16_t>({0x204U}));
+
+    /* Detaching from the middle of the chain keeps the order of remaining handlers */
+    ASSERT_EQ(timer_isr_detach(TIMER_ISR_VECTOR_TIMER2_COMPA, second_handler, 1U), TIMER_ERROR_OK);
+    ASSERT_EQ(timer_isr_detach(TIMER_ISR_VECTOR_TIMER2_COMPA, first_handler, 1U), TIMER_ERROR_NOT_INITIALISED);
+    calls.clear();
+    timer_isr_dispatch(TIMER_ISR_VECTOR_TIMER2_COMPA);
+    ASSERT_EQ(calls, std::vector<uint16_t>({0x100U, 0x102U}));
+
+    /* Freed slot can be used again, at the end of the chain */
+    ASSERT_EQ(timer_isr_attach(TIMER_ISR_VECTOR_TIMER2_COMPA, second_handler, 3U), TIMER_ERROR_OK);
+    calls.clear();
+    timer_isr_dispatch(TIMER_ISR_VECTOR_TIMER2_COMPA);
+    ASSERT_EQ(calls, std::vector<uint16_t>({0x100U, 0x102U, 0x203U}));
+
+    timer_isr_init();
+    calls.clear();
+    timer_isr_dispatch(TIMER_ISR_VECTOR_TIMER2_COMPA);
+    ASSERT_TRUE(calls.empty());
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TIMER_ISR_HEADER
+#define TIMER_ISR_HEADER
+
+#include <stdint.h>
+#include "timer_generic.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* #########################################################################################
+   ################################## Timer isr types ######################################
+   ######################################################################################### */
+
+/*
+ * Interrupt vectors of the timers can be routed to their users in two ways, selected per vector in config.h :
+ *  - compile time handler : #define TIMER_ISR_<VECTOR>_HANDLER my_callback (and optionally TIMER_ISR_<VECTOR>_ARG 1U)
+ *    the interrupt vector directly calls my_callback(arg), no lookup nor indirect call is involved.
+ *  - runtime dispatch     : #define TIMER_ISR_DISPATCH_<VECTOR>
+ *    the interrupt vector walks through the handlers attached with timer_isr_attach(), up to TIMER_ISR_MAX_HANDLERS
+ *    handlers per vector (defaults to 1, which makes the chain a single indirect call).
+ * Vectors which are not selected are left untouched and may still be implemented by the application.
+ * E.g : #define TIMER_ISR_TIMER2_COMPA_HANDLER timebase_interrupt_callback
+ *       #define TIMER_ISR_TIMER2_COMPA_ARG     0U
+*/
+
+/**
+ * @brief lists the interrupt vectors of the timers (ATmega328P layout)
+*/
+typedef enum
+{
+    TIMER_ISR_VECTOR_TIMER0_COMPA,  /**< Timer 0 (8 bit) output compare A match        */
+    TIMER_ISR_VECTOR_TIMER0_COMPB,  /**< Timer 0 (8 bit) output compare B match        */
+    TIMER_ISR_VECTOR_TIMER0_OVF,    /**< Timer 0 (8 bit) overflow                      */
+    TIMER_ISR_VECTOR_TIMER1_CAPT,   /**< Timer 1 (16 bit) input capture                */
+    TIMER_ISR_VECTOR_TIMER1_COMPA,  /**< Timer 1 (16 bit) output compare A match       */
+    TIMER_ISR_VECTOR_TIMER1_COMPB,  /**< Timer 1 (16 bit) output compare B match       */
+    TIMER_ISR_VECTOR_TIMER1_OVF,    /**< Timer 1 (16 bit) overflow                     */
+    TIMER_ISR_VECTOR_TIMER2_COMPA,  /**< Timer 2 (8 bit async) output compare A match  */
+    TIMER_ISR_VECTOR_TIMER2_COMPB,  /**< Timer 2 (8 bit async) output compare B match  */
+    TIMER_ISR_VECTOR_TIMER2_OVF,    /**< Timer 2 (8 bit async) overflow                */
+    TIMER_ISR_VECTOR_COUNT          /**< Number of vectors, not a valid vector         */
+} timer_isr_vector_t;
+
+/**
+ * @brief interrupt handler signature. Matches the module callbacks (e.g. timebase_interrupt_callback(id)),
+ * which receive the instance id they were attached with.
+*/
+typedef void (*timer_isr_handler_t)(const uint8_t arg);
+
+/* ##############################################################################################################
+   ################################## Timer isr API definition ##################################################
+   ############################################################################################################## */
+
+/**
+ * @brief detaches all runtime handlers. Shall be called once at startup : it also makes sure this driver (and
+ * the interrupt vectors it implements) is linked into the firmware.
+*/
+void timer_isr_init(void);
+
+/**
+ * @brief attaches a handler to an interrupt vector, at the end of its chain.
+ * Only effective on vectors routed to the runtime dispatch in config.h (TIMER_ISR_DISPATCH_<VECTOR>).
+ * @param[in]   vector  : targeted interrupt vector
+ * @param[in]   handler : function called from the interrupt
+ * @param[in]   arg     : argument given to the handler (usually the instance id of the calling module)
+ * @return
+ *      TIMER_ERROR_OK                  :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER       :   given vector is out of range
+ *      TIMER_ERROR_NULL_POINTER        :   handler points to NULL
+ *      TIMER_ERROR_ALREADY_INITIALISED :   this handler is already attached with the same argument
+ *      TIMER_ERROR_CONFIG              :   chain is full, see TIMER_ISR_MAX_HANDLERS
+*/
+timer_error_t timer_isr_attach(const timer_isr_vector_t vector, timer_isr_handler_t handler, const uint8_t arg);
+
+/**
+ * @brief detaches a handler from an interrupt vector, remaining handlers keep their order
+ * @param[in]   vector  : targeted interrupt vector
+ * @param[in]   handler : function previously attached
+ * @param[in]   arg     : argument it was attached with
+ * @return
+ *      TIMER_ERROR_OK                  :   operation succeeded
+ *      TIMER_ERROR_UNKNOWN_TIMER       :   given vector is out of range
+ *      TIMER_ERROR_NULL_POINTER        :   handler points to NULL
+ *      TIMER_ERROR_NOT_INITIALISED     :   this handler is not attached to this vector
+*/
+timer_error_t timer_isr_detach(const timer_isr_vector_t vector, timer_isr_handler_t handler, const uint8_t arg);
+
+/**
+ * @brief calls all handlers attached to a vector, in attachment order. Called by the interrupt vectors routed
+ * to the runtime dispatch, may also be used from an application-defined ISR.
+ * @param[in]   vector  : interrupt vector being serviced
+*/
+void timer_isr_dispatch(const timer_isr_vector_t vector);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMER_ISR_HEADER */
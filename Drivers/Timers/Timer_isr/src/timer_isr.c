@@ -0,0 +1,256 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+#include "timer_isr.h"
+#include "critical_section.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#ifndef UNIT_TESTING
+    #include <avr/io.h>
+    #include <avr/interrupt.h>
+#endif
+
+#ifndef TIMER_ISR_MAX_HANDLERS
+    #define TIMER_ISR_MAX_HANDLERS (1U)
+#elif TIMER_ISR_MAX_HANDLERS == 0
+    #error "TIMER_ISR_MAX_HANDLERS shall at least be 1"
+#endif
+
+typedef struct
+{
+    timer_isr_handler_t handler;
+    uint8_t arg;
+} timer_isr_slot_t;
+
+/* Chains are packed : first empty slot ends the chain */
+static timer_isr_slot_t dispatch_table[TIMER_ISR_VECTOR_COUNT][TIMER_ISR_MAX_HANDLERS] = {0};
+
+static inline timer_error_t check_parameters(const timer_isr_vector_t vector, timer_isr_handler_t handler)
+{
+    if (vector >= TIMER_ISR_VECTOR_COUNT)
+    {
+        return TIMER_ERROR_UNKNOWN_TIMER;
+    }
+    if (NULL == handler)
+    {
+        return TIMER_ERROR_NULL_POINTER;
+    }
+    return TIMER_ERROR_OK;
+}
+
+void timer_isr_init(void)
+{
+    uint8_t sreg = 0;
+    CRITICAL_SECTION_ENTER(sreg);
+    memset(dispatch_table, 0, sizeof(dispatch_table));
+    CRITICAL_SECTION_EXIT(sreg);
+}
+
+timer_error_t timer_isr_attach(const timer_isr_vector_t vector, timer_isr_handler_t handler, const uint8_t arg)
+{
+    timer_error_t ret = check_parameters(vector, handler);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    timer_isr_slot_t * const chain = dispatch_table[vector];
+    for (uint8_t i = 0 ; i < TIMER_ISR_MAX_HANDLERS ; i++)
+    {
+        if (NULL == chain[i].handler)
+        {
+            uint8_t sreg = 0;
+            CRITICAL_SECTION_ENTER(sreg);
+            chain[i].handler = handler;
+            chain[i].arg = arg;
+            CRITICAL_SECTION_EXIT(sreg);
+            return TIMER_ERROR_OK;
+        }
+
+        if ((handler == chain[i].handler) && (arg == chain[i].arg))
+        {
+            return TIMER_ERROR_ALREADY_INITIALISED;
+        }
+    }
+    return TIMER_ERROR_CONFIG;
+}
+
+timer_error_t timer_isr_detach(const timer_isr_vector_t vector, timer_isr_handler_t handler, const uint8_t arg)
+{
+    timer_error_t ret = check_parameters(vector, handler);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    timer_isr_slot_t * const chain = dispatch_table[vector];
+    for (uint8_t i = 0 ; (i < TIMER_ISR_MAX_HANDLERS) && (NULL != chain[i].handler) ; i++)
+    {
+        if ((handler == chain[i].handler) && (arg == chain[i].arg))
+        {
+            /* Shift remaining handlers to keep the chain packed */
+            uint8_t sreg = 0;
+            CRITICAL_SECTION_ENTER(sreg);
+            for (uint8_t j = i + 1U ; j < TIMER_ISR_MAX_HANDLERS ; j++)
+            {
+                chain[j - 1U] = chain[j];
+            }
+            chain[TIMER_ISR_MAX_HANDLERS - 1U].handler = NULL;
+            chain[TIMER_ISR_MAX_HANDLERS - 1U].arg = 0U;
+            CRITICAL_SECTION_EXIT(sreg);
+            return TIMER_ERROR_OK;
+        }
+    }
+    return TIMER_ERROR_NOT_INITIALISED;
+}
+
+void timer_isr_dispatch(const timer_isr_vector_t vector)
+{
+    timer_isr_slot_t const * const chain = dispatch_table[vector];
+    for (uint8_t i = 0 ; (i < TIMER_ISR_MAX_HANDLERS) && (NULL != chain[i].handler) ; i++)
+    {
+        chain[i].handler(chain[i].arg);
+    }
+}
+
+/* ##############################################################################################################
+   ############################################ Interrupt vectors ###############################################
+   ############################################################################################################## */
+
+#ifndef UNIT_TESTING
+
+/* Compile time handlers are declared here, they only need to match timer_isr_handler_t signature */
+#define TIMER_ISR_DIRECT(vect, handler, arg)    \
+    void handler(const uint8_t);                \
+    ISR(vect)                                   \
+    {                                           \
+        handler(arg);                           \
+    }
+
+#define TIMER_ISR_DISPATCH(vect, vector)        \
+    ISR(vect)                                   \
+    {                                           \
+        timer_isr_dispatch(vector);             \
+    }
+
+#if defined(TIMER_ISR_TIMER0_COMPA_HANDLER)
+    #ifndef TIMER_ISR_TIMER0_COMPA_ARG
+        #define TIMER_ISR_TIMER0_COMPA_ARG 0U
+    #endif
+    TIMER_ISR_DIRECT(TIMER0_COMPA_vect, TIMER_ISR_TIMER0_COMPA_HANDLER, TIMER_ISR_TIMER0_COMPA_ARG)
+#elif defined(TIMER_ISR_DISPATCH_TIMER0_COMPA)
+    TIMER_ISR_DISPATCH(TIMER0_COMPA_vect, TIMER_ISR_VECTOR_TIMER0_COMPA)
+#endif
+
+#if defined(TIMER_ISR_TIMER0_COMPB_HANDLER)
+    #ifndef TIMER_ISR_TIMER0_COMPB_ARG
+        #define TIMER_ISR_TIMER0_COMPB_ARG 0U
+    #endif
+    TIMER_ISR_DIRECT(TIMER0_COMPB_vect, TIMER_ISR_TIMER0_COMPB_HANDLER, TIMER_ISR_TIMER0_COMPB_ARG)
+#elif defined(TIMER_ISR_DISPATCH_TIMER0_COMPB)
+    TIMER_ISR_DISPATCH(TIMER0_COMPB_vect, TIMER_ISR_VECTOR_TIMER0_COMPB)
+#endif
+
+#if defined(TIMER_ISR_TIMER0_OVF_HANDLER)
+    #ifndef TIMER_ISR_TIMER0_OVF_ARG
+        #define TIMER_ISR_TIMER0_OVF_ARG 0U
+    #endif
+    TIMER_ISR_DIRECT(TIMER0_OVF_vect, TIMER_ISR_TIMER0_OVF_HANDLER, TIMER_ISR_TIMER0_OVF_ARG)
+#elif defined(TIMER_ISR_DISPATCH_TIMER0_OVF)
+    TIMER_ISR_DISPATCH(TIMER0_OVF_vect, TIMER_ISR_VECTOR_TIMER0_OVF)
+#endif
+
+#if defined(TIMER_ISR_TIMER1_CAPT_HANDLER)
+    #ifndef TIMER_ISR_TIMER1_CAPT_ARG
+        #define TIMER_ISR_TIMER1_CAPT_ARG 0U
+    #endif
+    TIMER_ISR_DIRECT(TIMER1_CAPT_vect, TIMER_ISR_TIMER1_CAPT_HANDLER, TIMER_ISR_TIMER1_CAPT_ARG)
+#elif defined(TIMER_ISR_DISPATCH_TIMER1_CAPT)
+    TIMER_ISR_DISPATCH(TIMER1_CAPT_vect, TIMER_ISR_VECTOR_TIMER1_CAPT)
+#endif
+
+#if defined(TIMER_ISR_TIMER1_COMPA_HANDLER)
+    #ifndef TIMER_ISR_TIMER1_COMPA_ARG
+        #define TIMER_ISR_TIMER1_COMPA_ARG 0U
+    #endif
+    TIMER_ISR_DIRECT(TIMER1_COMPA_vect, TIMER_ISR_TIMER1_COMPA_HANDLER, TIMER_ISR_TIMER1_COMPA_ARG)
+#elif defined(TIMER_ISR_DISPATCH_TIMER1_COMPA)
+    TIMER_ISR_DISPATCH(TIMER1_COMPA_vect, TIMER_ISR_VECTOR_TIMER1_COMPA)
+#endif
+
+#if defined(TIMER_ISR_TIMER1_COMPB_HANDLER)
+    #ifndef TIMER_ISR_TIMER1_COMPB_ARG
+        #define TIMER_ISR_TIMER1_COMPB_ARG 0U
+    #endif
+    TIMER_ISR_DIRECT(TIMER1_COMPB_vect, TIMER_ISR_TIMER1_COMPB_HANDLER, TIMER_ISR_TIMER1_COMPB_ARG)
+#elif defined(TIMER_ISR_DISPATCH_TIMER1_COMPB)
+    TIMER_ISR_DISPATCH(TIMER1_COMPB_vect, TIMER_ISR_VECTOR_TIMER1_COMPB)
+#endif
+
+#if defined(TIMER_ISR_TIMER1_OVF_HANDLER)
+    #ifndef TIMER_ISR_TIMER1_OVF_ARG
+        #define TIMER_ISR_TIMER1_OVF_ARG 0U
+    #endif
+    TIMER_ISR_DIRECT(TIMER1_OVF_vect, TIMER_ISR_TIMER1_OVF_HANDLER, TIMER_ISR_TIMER1_OVF_ARG)
+#elif defined(TIMER_ISR_DISPATCH_TIMER1_OVF)
+    TIMER_ISR_DISPATCH(TIMER1_OVF_vect, TIMER_ISR_VECTOR_TIMER1_OVF)
+#endif
+
+#if defined(TIMER_ISR_TIMER2_COMPA_HANDLER)
+    #ifndef TIMER_ISR_TIMER2_COMPA_ARG
+        #define TIMER_ISR_TIMER2_COMPA_ARG 0U
+    #endif
+    TIMER_ISR_DIRECT(TIMER2_COMPA_vect, TIMER_ISR_TIMER2_COMPA_HANDLER, TIMER_ISR_TIMER2_COMPA_ARG)
+#elif defined(TIMER_ISR_DISPATCH_TIMER2_COMPA)
+    TIMER_ISR_DISPATCH(TIMER2_COMPA_vect, TIMER_ISR_VECTOR_TIMER2_COMPA)
+#endif
+
+#if defined(TIMER_ISR_TIMER2_COMPB_HANDLER)
+    #ifndef TIMER_ISR_TIMER2_COMPB_ARG
+        #define TIMER_ISR_TIMER2_COMPB_ARG 0U
+    #endif
+    TIMER_ISR_DIRECT(TIMER2_COMPB_vect, TIMER_ISR_TIMER2_COMPB_HANDLER, TIMER_ISR_TIMER2_COMPB_ARG)
+#elif defined(TIMER_ISR_DISPATCH_TIMER2_COMPB)
+    TIMER_ISR_DISPATCH(TIMER2_COMPB_vect, TIMER_ISR_VECTOR_TIMER2_COMPB)
+#endif
+
+#if defined(TIMER_ISR_TIMER2_OVF_HANDLER)
+    #ifndef TIMER_ISR_TIMER2_OVF_ARG
+        #define TIMER_ISR_TIMER2_OVF_ARG 0U
+    #endif
+    TIMER_ISR_DIRECT(TIMER2_OVF_vect, TIMER_ISR_TIMER2_OVF_HANDLER, TIMER_ISR_TIMER2_OVF_ARG)
+#elif defined(TIMER_ISR_DISPATCH_TIMER2_OVF)
+    TIMER_ISR_DISPATCH(TIMER2_OVF_vect, TIMER_ISR_VECTOR_TIMER2_OVF)
+#endif
+
+#endif /* UNIT_TESTING */
@@ -0,0 +1,100 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "timer_drivers_stub.h"
+#include "timer_8_bit.h"
+#include "timer_8_bit_async.h"
+#include "timer_16_bit.h"
+#include <string.h>
+
+timer_drivers_stub_t timer_drivers_stub = {0};
+
+void timer_drivers_stub_erase(void)
+{
+    memset(&timer_drivers_stub, 0, sizeof(timer_drivers_stub_t));
+}
+
+void timer_drivers_stub_init_handle(timer_sync_handle_t * handle)
+{
+    if (NULL != handle)
+    {
+        handle->GTCCR_REG = &timer_drivers_stub.GTCCR;
+    }
+}
+
+static timer_error_t record_event(const timer_drivers_stub_event_type_t event, const timer_sync_timer_t timer, const uint8_t id, const uint16_t counter)
+{
+    if (timer_drivers_stub.events_count < TIMER_DRIVERS_STUB_MAX_EVENTS)
+    {
+        timer_drivers_stub_event_t * recorded = &timer_drivers_stub.events[timer_drivers_stub.events_count];
+        recorded->event = event;
+        recorded->timer = timer;
+        recorded->id = id;
+        recorded->counter = counter;
+        recorded->gtccr = timer_drivers_stub.GTCCR;
+        timer_drivers_stub.events_count++;
+    }
+
+    if (TIMER_DRIVERS_STUB_EVENT_START == event)
+    {
+        return timer_drivers_stub.next_error;
+    }
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_set_counter_value(uint8_t id, const uint8_t ticks)
+{
+    return record_event(TIMER_DRIVERS_STUB_EVENT_SET_COUNTER, TIMER_SYNC_TIMER_8_BIT, id, ticks);
+}
+
+timer_error_t timer_8_bit_start(uint8_t id)
+{
+    return record_event(TIMER_DRIVERS_STUB_EVENT_START, TIMER_SYNC_TIMER_8_BIT, id, 0U);
+}
+
+timer_error_t timer_8_bit_async_set_counter_value(uint8_t id, const uint8_t ticks)
+{
+    return record_event(TIMER_DRIVERS_STUB_EVENT_SET_COUNTER, TIMER_SYNC_TIMER_8_BIT_ASYNC, id, ticks);
+}
+
+timer_error_t timer_8_bit_async_start(uint8_t id)
+{
+    return record_event(TIMER_DRIVERS_STUB_EVENT_START, TIMER_SYNC_TIMER_8_BIT_ASYNC, id, 0U);
+}
+
+timer_error_t timer_16_bit_set_counter_value(uint8_t id, const uint16_t * const ticks)
+{
+    return record_event(TIMER_DRIVERS_STUB_EVENT_SET_COUNTER, TIMER_SYNC_TIMER_16_BIT, id, *ticks);
+}
+
+timer_error_t timer_16_bit_start(uint8_t id)
+{
+    return record_event(TIMER_DRIVERS_STUB_EVENT_START, TIMER_SYNC_TIMER_16_BIT, id, 0U);
+}
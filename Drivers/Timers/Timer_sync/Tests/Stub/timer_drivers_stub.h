@@ -0,0 +1,81 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TIMER_DRIVERS_STUB
+#define TIMER_DRIVERS_STUB
+
+#include "timer_sync.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define TIMER_DRIVERS_STUB_MAX_EVENTS (16U)
+
+/**
+ * @brief lists the timer driver calls recorded by this stub
+*/
+typedef enum
+{
+    TIMER_DRIVERS_STUB_EVENT_SET_COUNTER,   /**< timer_xxx_set_counter_value() was called  */
+    TIMER_DRIVERS_STUB_EVENT_START,         /**< timer_xxx_start() was called              */
+} timer_drivers_stub_event_type_t;
+
+/**
+ * @brief records a single call to one of the stubbed timer drivers
+*/
+typedef struct
+{
+    timer_drivers_stub_event_type_t event;  /**< Recorded call                                  */
+    timer_sync_timer_t timer;               /**< Timer driver which received the call           */
+    uint8_t id;                             /**< Timer id given to the driver                   */
+    uint16_t counter;                       /**< Counter value, when relevant                   */
+    uint8_t gtccr;                          /**< GTCCR stub register value at the time of call  */
+} timer_drivers_stub_event_t;
+
+typedef struct
+{
+    volatile uint8_t GTCCR;                                             /**< General Timer/Counter control register  */
+    timer_drivers_stub_event_t events[TIMER_DRIVERS_STUB_MAX_EVENTS];   /**< Recorded calls, in order                */
+    uint8_t events_count;                                               /**< Number of recorded calls                */
+    timer_error_t next_error;                                           /**< Error returned by next start call       */
+} timer_drivers_stub_t;
+
+extern timer_drivers_stub_t timer_drivers_stub;
+
+void timer_drivers_stub_erase(void);
+void timer_drivers_stub_init_handle(timer_sync_handle_t * handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMER_DRIVERS_STUB */
@@ -0,0 +1,153 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gtest/gtest.h"
+#include "timer_sync.h"
+#include "timer_8_bit_async_reg.h"
+#include "timer_drivers_stub.h"
+
+class TimerSyncFixture : public ::testing::Test
+{
+public:
+    timer_sync_handle_t handle;
+protected:
+    void SetUp() override
+    {
+        timer_drivers_stub_erase();
+        timer_drivers_stub_init_handle(&handle);
+        (void) timer_sync_set_handle(&handle);
+    }
+    void TearDown() override
+    {
+    }
+};
+
+TEST(timer_sync_driver_tests, guard_null_handle)
+{
+    timer_sync_handle_t handle = {0};
+    timer_sync_member_t members[1] = {{TIMER_SYNC_TIMER_8_BIT, 0U, 0U}};
+
+    timer_error_t ret = timer_sync_set_handle(NULL);
+    ASSERT_EQ(TIMER_ERROR_NULL_POINTER, ret);
+    ret = timer_sync_get_handle(NULL);
+    ASSERT_EQ(TIMER_ERROR_NULL_POINTER, ret);
+
+    ret = timer_sync_set_handle(&handle);
+    ASSERT_EQ(TIMER_ERROR_OK, ret);
+    ret = timer_sync_start_group(members, 1U);
+    ASSERT_EQ(TIMER_ERROR_NULL_HANDLE, ret);
+    ret = timer_sync_start_group(NULL, 1U);
+    ASSERT_EQ(TIMER_ERROR_NULL_POINTER, ret);
+}
+
+TEST_F(TimerSyncFixture, test_start_group_holds_prescalers)
+{
+    const timer_sync_member_t members[3] =
+    {
+        {TIMER_SYNC_TIMER_8_BIT,        0U, 0U  },
+        {TIMER_SYNC_TIMER_16_BIT,       0U, 512U},
+        {TIMER_SYNC_TIMER_8_BIT_ASYNC,  0U, 128U},
+    };
+
+    timer_error_t ret = timer_sync_start_group(members, 3U);
+    ASSERT_EQ(TIMER_ERROR_OK, ret);
+    ASSERT_EQ(6U, timer_drivers_stub.events_count);
+
+    /* Each timer is loaded with its phase offset, then started, while both prescalers are held in reset */
+    for (uint8_t i = 0 ; i < 3U ; i++)
+    {
+        const timer_drivers_stub_event_t * load = &timer_drivers_stub.events[2U * i];
+        const timer_drivers_stub_event_t * start = &timer_drivers_stub.events[(2U * i) + 1U];
+        ASSERT_EQ(TIMER_DRIVERS_STUB_EVENT_SET_COUNTER, load->event);
+        ASSERT_EQ(members[i].type, load->timer);
+        ASSERT_EQ(members[i].phase_offset, load->counter);
+        ASSERT_EQ(TIMER_DRIVERS_STUB_EVENT_START, start->event);
+        ASSERT_EQ(members[i].type, start->timer);
+        ASSERT_EQ(TSM_MSK | PSRSYNC_MSK | PSRASY_MSK, load->gtccr);
+        ASSERT_EQ(TSM_MSK | PSRSYNC_MSK | PSRASY_MSK, start->gtccr);
+    }
+
+    /* Prescalers are released at the end (PSRSYNC/PSRASY are cleared by hardware once TSM is cleared) */
+    ASSERT_EQ(0U, timer_drivers_stub.GTCCR & TSM_MSK);
+}
+
+TEST_F(TimerSyncFixture, test_start_group_only_halts_used_prescalers)
+{
+    const timer_sync_member_t members[2] =
+    {
+        {TIMER_SYNC_TIMER_8_BIT,    0U, 0U  },
+        {TIMER_SYNC_TIMER_16_BIT,   0U, 128U},
+    };
+
+    timer_error_t ret = timer_sync_start_group(members, 2U);
+    ASSERT_EQ(TIMER_ERROR_OK, ret);
+    ASSERT_EQ(4U, timer_drivers_stub.events_count);
+
+    /* Async prescaler is left untouched, so an async timer used as a timebase keeps on running */
+    ASSERT_EQ(TSM_MSK | PSRSYNC_MSK, timer_drivers_stub.events[0].gtccr);
+}
+
+TEST_F(TimerSyncFixture, test_start_group_rejects_wrong_offsets)
+{
+    const timer_sync_member_t members[2] =
+    {
+        {TIMER_SYNC_TIMER_16_BIT,   0U, 1000U},
+        {TIMER_SYNC_TIMER_8_BIT,    0U, 256U },
+    };
+
+    /* Nothing is touched when the group is ill-formed */
+    timer_error_t ret = timer_sync_start_group(members, 2U);
+    ASSERT_EQ(TIMER_ERROR_CONFIG, ret);
+    ASSERT_EQ(0U, timer_drivers_stub.events_count);
+    ASSERT_EQ(0U, timer_drivers_stub.GTCCR);
+}
+
+TEST_F(TimerSyncFixture, test_start_group_releases_prescalers_on_error)
+{
+    const timer_sync_member_t members[2] =
+    {
+        {TIMER_SYNC_TIMER_8_BIT,        0U, 10U},
+        {TIMER_SYNC_TIMER_8_BIT_ASYNC,  0U, 20U},
+    };
+
+    timer_drivers_stub.next_error = TIMER_ERROR_NOT_INITIALISED;
+    timer_error_t ret = timer_sync_start_group(members, 2U);
+    ASSERT_EQ(TIMER_ERROR_NOT_INITIALISED, ret);
+
+    /* First failure aborts the sequence, but prescalers are not left halted */
+    ASSERT_EQ(2U, timer_drivers_stub.events_count);
+    ASSERT_EQ(0U, timer_drivers_stub.GTCCR & TSM_MSK);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,117 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TIMER_SYNC_HEADER
+#define TIMER_SYNC_HEADER
+
+#include <stdint.h>
+#include "timer_generic.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* #########################################################################################
+   ################################## Timer sync types #####################################
+   ######################################################################################### */
+
+/**
+ * @brief handle for the General Timer/Counter Control Register, which is shared by all timers
+*/
+typedef struct
+{
+    volatile uint8_t * GTCCR_REG;  /**< General Timer/Counter control register (TSM, PSRASY and PSRSYNC bits) */
+} timer_sync_handle_t;
+
+/**
+ * @brief lists the timer drivers which can take part in a synchronised start
+*/
+typedef enum
+{
+    TIMER_SYNC_TIMER_8_BIT,         /**< Regular 8 bit timer (Timer 0), clocked by the synchronous prescaler    */
+    TIMER_SYNC_TIMER_8_BIT_ASYNC,   /**< Async 8 bit timer (Timer 2), clocked by the asynchronous prescaler     */
+    TIMER_SYNC_TIMER_16_BIT,        /**< 16 bit timer (Timer 1), clocked by the synchronous prescaler           */
+} timer_sync_timer_t;
+
+/**
+ * @brief describes a single timer which will be started alongside the others
+*/
+typedef struct
+{
+    timer_sync_timer_t type;    /**< Selects the timer driver used for this member                                          */
+    uint8_t id;                 /**< Id of the timer instance, as used by its own driver                                    */
+    uint16_t phase_offset;      /**< Counter value loaded in the timer before it is released. Must fit in the timer width  */
+} timer_sync_member_t;
+
+/* ##############################################################################################################
+   ################################## Timer sync API definition #################################################
+   ############################################################################################################## */
+
+/**
+ * @brief sets the handle of timer_sync driver
+ * @param[in]   handle : handle to be copied into internal configuration
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_NULL_POINTER   :   given handle parameter points to NULL
+*/
+timer_error_t timer_sync_set_handle(timer_sync_handle_t * const handle);
+
+/**
+ * @brief fetches the handle of timer_sync driver
+ * @param[out]  handle : output handle extracted from internal driver memory
+ * @return
+ *      TIMER_ERROR_OK             :   operation succeeded
+ *      TIMER_ERROR_NULL_POINTER   :   given handle parameter points to NULL
+*/
+timer_error_t timer_sync_get_handle(timer_sync_handle_t * const handle);
+
+/**
+ * @brief starts a group of already initialised timers at once, each one with its own phase offset.
+ * Prescalers used by the group are halted (GTCCR TSM + PSRSYNC and/or PSRASY), then each counter is loaded
+ * with its phase offset and its clock is selected. Clearing TSM finally releases all prescalers on the same clock edge.
+ * Note : timers running with an undivided clock (prescaler 1) bypass the prescaler and will start counting as soon as
+ * their clock is selected, hence they cannot be perfectly held back by this mechanism.
+ * @param[in]   members : array of timers to be started together
+ * @param[in]   count   : number of elements in members array
+ * @return
+ *      TIMER_ERROR_OK              :   operation succeeded
+ *      TIMER_ERROR_NULL_POINTER    :   given members parameter points to NULL
+ *      TIMER_ERROR_NULL_HANDLE     :   GTCCR handle is still NULL (unitialised). Operation failed
+ *      TIMER_ERROR_CONFIG          :   one of the phase offsets does not fit its timer or the timer type is unknown
+ *      Any error from underlying timer drivers (timers which were already started keep running, prescalers are released anyway)
+*/
+timer_error_t timer_sync_start_group(timer_sync_member_t const * const members, const uint8_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMER_SYNC_HEADER */
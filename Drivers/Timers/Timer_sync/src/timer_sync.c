@@ -0,0 +1,184 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "timer_sync.h"
+#include "timer_8_bit.h"
+#include "timer_8_bit_async.h"
+#include "timer_16_bit.h"
+
+#include <stddef.h>
+#include <string.h>
+
+static struct
+{
+    timer_sync_handle_t handle;
+} internal_config = {0};
+
+static inline timer_error_t check_handle(timer_sync_handle_t * const handle)
+{
+    if ((NULL == handle) || (NULL == handle->GTCCR_REG))
+    {
+        return TIMER_ERROR_NULL_HANDLE;
+    }
+    return TIMER_ERROR_OK;
+}
+
+/**
+ * @brief checks that a member is well-formed and returns the prescaler reset bits it needs
+*/
+static inline timer_error_t check_member(timer_sync_member_t const * const member, uint8_t * const reset_mask)
+{
+    switch (member->type)
+    {
+        case TIMER_SYNC_TIMER_8_BIT:
+            if (member->phase_offset >= TIMER_GENERIC_8_BIT_LIMIT_VALUE)
+            {
+                return TIMER_ERROR_CONFIG;
+            }
+            *reset_mask |= PSRSYNC_MSK;
+            break;
+
+        case TIMER_SYNC_TIMER_8_BIT_ASYNC:
+            if (member->phase_offset >= TIMER_GENERIC_8_BIT_LIMIT_VALUE)
+            {
+                return TIMER_ERROR_CONFIG;
+            }
+            *reset_mask |= PSRASY_MSK;
+            break;
+
+        case TIMER_SYNC_TIMER_16_BIT:
+            *reset_mask |= PSRSYNC_MSK;
+            break;
+
+        default:
+            return TIMER_ERROR_CONFIG;
+    }
+    return TIMER_ERROR_OK;
+}
+
+static timer_error_t load_and_start(timer_sync_member_t const * const member)
+{
+    timer_error_t ret = TIMER_ERROR_OK;
+    switch (member->type)
+    {
+        case TIMER_SYNC_TIMER_8_BIT:
+            ret = timer_8_bit_set_counter_value(member->id, (uint8_t) member->phase_offset);
+            if (TIMER_ERROR_OK == ret)
+            {
+                ret = timer_8_bit_start(member->id);
+            }
+            break;
+
+        case TIMER_SYNC_TIMER_8_BIT_ASYNC:
+            ret = timer_8_bit_async_set_counter_value(member->id, (uint8_t) member->phase_offset);
+            if (TIMER_ERROR_OK == ret)
+            {
+                ret = timer_8_bit_async_start(member->id);
+            }
+            break;
+
+        case TIMER_SYNC_TIMER_16_BIT:
+            ret = timer_16_bit_set_counter_value(member->id, &member->phase_offset);
+            if (TIMER_ERROR_OK == ret)
+            {
+                ret = timer_16_bit_start(member->id);
+            }
+            break;
+
+        default:
+            ret = TIMER_ERROR_CONFIG;
+            break;
+    }
+    return ret;
+}
+
+timer_error_t timer_sync_set_handle(timer_sync_handle_t * const handle)
+{
+    if (NULL == handle)
+    {
+        return TIMER_ERROR_NULL_POINTER;
+    }
+
+    memcpy(&internal_config.handle, handle, sizeof(timer_sync_handle_t));
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_sync_get_handle(timer_sync_handle_t * const handle)
+{
+    if (NULL == handle)
+    {
+        return TIMER_ERROR_NULL_POINTER;
+    }
+
+    memcpy(handle, &internal_config.handle, sizeof(timer_sync_handle_t));
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_sync_start_group(timer_sync_member_t const * const members, const uint8_t count)
+{
+    if (NULL == members)
+    {
+        return TIMER_ERROR_NULL_POINTER;
+    }
+
+    timer_error_t ret = check_handle(&internal_config.handle);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    /* Validate the whole group first, so that we never leave prescalers halted because of a configuration mistake */
+    uint8_t reset_mask = 0U;
+    for (uint8_t i = 0 ; i < count ; i++)
+    {
+        ret = check_member(&members[i], &reset_mask);
+        if (TIMER_ERROR_OK != ret)
+        {
+            return ret;
+        }
+    }
+
+    /* Halt the prescalers : with TSM set, PSRSYNC and PSRASY bits are kept high by hardware which holds the prescalers in reset.
+    Only the prescalers used by the group are halted, other timers keep on running */
+    *(internal_config.handle.GTCCR_REG) |= (TSM_MSK | reset_mask);
+
+    for (uint8_t i = 0 ; i < count ; i++)
+    {
+        ret = load_and_start(&members[i]);
+        if (TIMER_ERROR_OK != ret)
+        {
+            break;
+        }
+    }
+
+    /* Releasing TSM lets hardware clear PSRSYNC/PSRASY, all halted prescalers resume counting on the same clock edge */
+    *(internal_config.handle.GTCCR_REG) &= ~TSM_MSK;
+    return ret;
+}
@@ -0,0 +1,284 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "timer_drivers_stub.h"
+#include "string.h"
+
+timer_drivers_stub_t timer_drivers_stub = {0};
+
+static inline timer_error_t check_call(const uint8_t id)
+{
+    if (id >= TIMER_DRIVERS_STUB_MAX_INSTANCES)
+    {
+        return TIMER_ERROR_UNKNOWN_TIMER;
+    }
+    timer_error_t err = timer_drivers_stub.next_error;
+    timer_drivers_stub.next_error = TIMER_ERROR_OK;
+    return err;
+}
+
+void timer_drivers_stub_reset(void)
+{
+    memset(&timer_drivers_stub, 0, sizeof(timer_drivers_stub_t));
+}
+
+const timer_generic_prescaler_pair_t timer_8_bit_prescaler_table[TIMER_8_BIT_MAX_PRESCALER_COUNT] =
+{
+    {.value = 1U,       .type = (uint8_t) TIMER8BIT_CLK_PRESCALER_1     },
+    {.value = 8U,       .type = (uint8_t) TIMER8BIT_CLK_PRESCALER_8     },
+    {.value = 64U,      .type = (uint8_t) TIMER8BIT_CLK_PRESCALER_64    },
+    {.value = 256U,     .type = (uint8_t) TIMER8BIT_CLK_PRESCALER_256   },
+    {.value = 1024U,    .type = (uint8_t) TIMER8BIT_CLK_PRESCALER_1024  },
+};
+
+const timer_generic_prescaler_pair_t timer_16_bit_prescaler_table[TIMER_16_BIT_MAX_PRESCALER_COUNT] =
+{
+    {.value = 1U,       .type = (uint8_t) TIMER16BIT_CLK_PRESCALER_1     },
+    {.value = 8U,       .type = (uint8_t) TIMER16BIT_CLK_PRESCALER_8     },
+    {.value = 64U,      .type = (uint8_t) TIMER16BIT_CLK_PRESCALER_64    },
+    {.value = 256U,     .type = (uint8_t) TIMER16BIT_CLK_PRESCALER_256   },
+    {.value = 1024U,    .type = (uint8_t) TIMER16BIT_CLK_PRESCALER_1024  },
+};
+
+uint16_t timer_8_bit_prescaler_to_value(const timer_8_bit_prescaler_selection_t prescaler)
+{
+    for (uint8_t i = 0 ; i < TIMER_8_BIT_MAX_PRESCALER_COUNT ; i++)
+    {
+        if (prescaler == timer_8_bit_prescaler_table[i].type)
+        {
+            return timer_8_bit_prescaler_table[i].value;
+        }
+    }
+    return 0;
+}
+
+uint16_t timer_16_bit_prescaler_to_value(const timer_16_bit_prescaler_selection_t prescaler)
+{
+    for (uint8_t i = 0 ; i < TIMER_16_BIT_MAX_PRESCALER_COUNT ; i++)
+    {
+        if (prescaler == timer_16_bit_prescaler_table[i].type)
+        {
+            return timer_16_bit_prescaler_table[i].value;
+        }
+    }
+    return 0;
+}
+
+void timer_8_bit_compute_matching_parameters(const uint32_t * const cpu_freq,
+                                             const uint32_t * const target_freq,
+                                             timer_8_bit_prescaler_selection_t * const prescaler,
+                                             uint8_t * const ocra,
+                                             uint16_t * const accumulator)
+{
+    (void) cpu_freq;
+    (void) target_freq;
+    *prescaler = timer_drivers_stub.timer_8_bit.prescaler;
+    *ocra = timer_drivers_stub.timer_8_bit.ocra;
+    *accumulator = timer_drivers_stub.timer_8_bit.accumulator;
+}
+
+void timer_16_bit_compute_matching_parameters(const uint32_t * const cpu_freq,
+                                              const uint32_t * const target_freq,
+                                              timer_16_bit_prescaler_selection_t * const prescaler,
+                                              uint16_t * const ocra,
+                                              uint16_t * const accumulator)
+{
+    (void) cpu_freq;
+    (void) target_freq;
+    *prescaler = timer_drivers_stub.timer_16_bit.prescaler;
+    *ocra = timer_drivers_stub.timer_16_bit.ocra;
+    *accumulator = timer_drivers_stub.timer_16_bit.accumulator;
+}
+
+timer_error_t timer_8_bit_is_initialised(const uint8_t id, bool * const initialised)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    *initialised = timer_drivers_stub.timer_8_bit.initialised;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_get_default_config(timer_8_bit_config_t * config)
+{
+    memset(config, 0, sizeof(timer_8_bit_config_t));
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_get_handle(uint8_t id, timer_8_bit_handle_t * const handle)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    *handle = timer_drivers_stub.timer_8_bit.config.handle;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_reconfigure(uint8_t id, timer_8_bit_config_t * const config)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_8_bit.config = *config;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_get_interrupt_config(uint8_t id, timer_8_bit_interrupt_config_t * it_config)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    *it_config = timer_drivers_stub.timer_8_bit.config.interrupt_config;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_set_interrupt_config(uint8_t id, timer_8_bit_interrupt_config_t * const it_config)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_8_bit.config.interrupt_config = *it_config;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_start(uint8_t id)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_8_bit.running = true;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_stop(uint8_t id)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_8_bit.running = false;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_is_initialised(const uint8_t id, bool * const initialised)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    *initialised = timer_drivers_stub.timer_16_bit.initialised;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_get_default_config(timer_16_bit_config_t * config)
+{
+    memset(config, 0, sizeof(timer_16_bit_config_t));
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_get_handle(uint8_t id, timer_16_bit_handle_t * const handle)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    *handle = timer_drivers_stub.timer_16_bit.config.handle;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_reconfigure(uint8_t id, timer_16_bit_config_t * const config)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.config = *config;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_get_interrupt_config(uint8_t id, timer_16_bit_interrupt_config_t * it_config)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    *it_config = timer_drivers_stub.timer_16_bit.config.interrupt_config;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_set_interrupt_config(uint8_t id, timer_16_bit_interrupt_config_t * const it_config)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.config.interrupt_config = *it_config;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_start(uint8_t id)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.running = true;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_stop(uint8_t id)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.running = false;
+    return TIMER_ERROR_OK;
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TIMER_DRIVERS_STUB_HEADER
+#define TIMER_DRIVERS_STUB_HEADER
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "timer_8_bit.h"
+#include "timer_16_bit.h"
+#define TIMER_DRIVERS_STUB_MAX_INSTANCES (1U)
+
+typedef struct
+{
+    timer_8_bit_prescaler_selection_t prescaler;            /**< Prescaler given by the next parameters computation         */
+    uint8_t ocra;                                           /**< OCRA value given by the next parameters computation        */
+    uint16_t accumulator;                                   /**< Accumulator given by the next parameters computation       */
+    timer_8_bit_config_t config;                            /**< Last configuration written by the module                   */
+    bool initialised;                                       /**< Underlying timer is initialised                            */
+    bool running;                                           /**< Timer was started and not stopped since                    */
+} timer_8_bit_stub_t;
+
+typedef struct
+{
+    timer_16_bit_prescaler_selection_t prescaler;           /**< Prescaler given by the next parameters computation         */
+    uint16_t ocra;                                          /**< OCRA value given by the next parameters computation        */
+    uint16_t accumulator;                                   /**< Accumulator given by the next parameters computation       */
+    timer_16_bit_config_t config;                           /**< Last configuration written by the module                   */
+    bool initialised;                                       /**< Underlying timer is initialised                            */
+    bool running;                                           /**< Timer was started and not stopped since                    */
+} timer_16_bit_stub_t;
+
+typedef struct
+{
+    timer_8_bit_stub_t timer_8_bit;
+    timer_16_bit_stub_t timer_16_bit;
+    timer_error_t next_error;                               /**< Error returned by the next call to any stubbed function    */
+} timer_drivers_stub_t;
+
+extern timer_drivers_stub_t timer_drivers_stub;
+
+void timer_drivers_stub_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMER_DRIVERS_STUB_HEADER */
\ No newline at end of file
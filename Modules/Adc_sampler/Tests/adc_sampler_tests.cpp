@@ -0,0 +1,184 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gtest/gtest.h"
+#include "adc_sampler.h"
+#include "adc_sampler_internal.h"
+#include "timer_drivers_stub.h"
+
+class AdcSamplerFixture : public ::testing::Test
+{
+public:
+    adc_sampler_config_t config;
+protected:
+    void SetUp() override
+    {
+        timer_drivers_stub_reset();
+        timer_drivers_stub.timer_8_bit.initialised = true;
+        timer_drivers_stub.timer_16_bit.initialised = true;
+        config.timer_type = ADC_SAMPLER_TIMER_16_BIT;
+        config.timer_index = 0U;
+        config.cpu_freq = 16000000UL;
+        config.sample_rate = 1000UL;
+    }
+    void TearDown() override
+    {
+        (void) adc_sampler_deinit(0U);
+    }
+};
+
+TEST(adc_sampler_module_tests, guard_bad_parameters)
+{
+    adc_autotrigger_sources_t source = ADC_TRIGGER_FREE_RUNNING;
+    uint32_t rate = 0;
+    uint16_t count = 0;
+    adc_sampler_config_t config = {ADC_SAMPLER_TIMER_8_BIT, 0U, 16000000UL, 0UL};
+    timer_drivers_stub_reset();
+
+    ASSERT_EQ(ADC_SAMPLER_ERROR_NULL_POINTER, adc_sampler_init(0U, NULL));
+    ASSERT_EQ(ADC_SAMPLER_ERROR_INVALID_INDEX, adc_sampler_init(ADC_SAMPLER_MAX_MODULES, &config));
+    ASSERT_EQ(ADC_SAMPLER_ERROR_UNINITIALISED, adc_sampler_start(0U));
+    ASSERT_EQ(ADC_SAMPLER_ERROR_UNINITIALISED, adc_sampler_get_trigger_source(0U, &source));
+    ASSERT_EQ(ADC_SAMPLER_ERROR_UNINITIALISED, adc_sampler_get_sample_rate(0U, &rate));
+
+    /* Null sample rate or faster than the cpu clock */
+    ASSERT_EQ(ADC_SAMPLER_ERROR_CONFIG, adc_sampler_init(0U, &config));
+    config.sample_rate = 16000001UL;
+    ASSERT_EQ(ADC_SAMPLER_ERROR_CONFIG, adc_sampler_init(0U, &config));
+    config.sample_rate = 10000UL;
+
+    ASSERT_EQ(ADC_SAMPLER_ERROR_TIMER_UNINITIALISED, adc_sampler_init(0U, &config));
+    timer_drivers_stub.timer_8_bit.initialised = true;
+
+    /* Rate is too low to be reached without a software accumulator */
+    timer_drivers_stub.timer_8_bit.prescaler = TIMER8BIT_CLK_PRESCALER_1024;
+    timer_drivers_stub.timer_8_bit.ocra = 124U;
+    timer_drivers_stub.timer_8_bit.accumulator = 9U;
+    ASSERT_EQ(ADC_SAMPLER_ERROR_CONFIG, adc_sampler_init(0U, &config));
+    timer_drivers_stub.timer_8_bit.accumulator = 0U;
+
+    timer_drivers_stub.next_error = TIMER_ERROR_NOT_INITIALISED;
+    ASSERT_EQ(ADC_SAMPLER_ERROR_TIMER_ERROR, adc_sampler_init(0U, &config));
+    ASSERT_EQ(ADC_SAMPLER_ERROR_UNINITIALISED, adc_sampler_start(0U));
+
+    ASSERT_EQ(ADC_SAMPLER_ERROR_OK, adc_sampler_init(0U, &config));
+    ASSERT_EQ(ADC_SAMPLER_ERROR_NULL_POINTER, adc_sampler_get_trigger_source(0U, NULL));
+    ASSERT_EQ(ADC_SAMPLER_ERROR_NULL_POINTER, adc_sampler_get_sample_rate(0U, NULL));
+    ASSERT_EQ(ADC_SAMPLER_ERROR_NULL_POINTER, adc_sampler_get_trigger_count(0U, NULL));
+    ASSERT_EQ(ADC_SAMPLER_ERROR_INVALID_INDEX, adc_sampler_get_trigger_count(ADC_SAMPLER_MAX_MODULES, &count));
+    ASSERT_EQ(ADC_SAMPLER_ERROR_OK, adc_sampler_deinit(0U));
+}
+
+TEST_F(AdcSamplerFixture, test_8_bit_timer_ctc_trigger)
+{
+    adc_autotrigger_sources_t source = ADC_TRIGGER_FREE_RUNNING;
+    uint32_t rate = 0;
+    config.timer_type = ADC_SAMPLER_TIMER_8_BIT;
+    config.sample_rate = 9000UL;
+
+    /* 16 MHz / 8 / (221 + 1) = 9009 Hz */
+    timer_drivers_stub.timer_8_bit.prescaler = TIMER8BIT_CLK_PRESCALER_8;
+    timer_drivers_stub.timer_8_bit.ocra = 221U;
+    timer_drivers_stub.timer_8_bit.running = true;
+    ASSERT_EQ(ADC_SAMPLER_ERROR_OK, adc_sampler_init(0U, &config));
+
+    /* CTC with TOP in OCR0A, compare unit A triggers the ADC and no output pin is driven */
+    const timer_8_bit_config_t& timer_config = timer_drivers_stub.timer_8_bit.config;
+    ASSERT_FALSE(timer_drivers_stub.timer_8_bit.running);
+    ASSERT_EQ(TIMER8BIT_WG_CTC, timer_config.timing_config.waveform_mode);
+    ASSERT_EQ(TIMER8BIT_CMOD_NORMAL, timer_config.timing_config.comp_match_a);
+    ASSERT_EQ(TIMER8BIT_CMOD_NORMAL, timer_config.timing_config.comp_match_b);
+    ASSERT_EQ(221U, timer_config.timing_config.ocra_val);
+    ASSERT_EQ(TIMER8BIT_CLK_PRESCALER_8, timer_config.timing_config.prescaler);
+    ASSERT_TRUE(timer_config.interrupt_config.it_comp_match_a);
+
+    ASSERT_EQ(ADC_SAMPLER_ERROR_OK, adc_sampler_get_trigger_source(0U, &source));
+    ASSERT_EQ(ADC_TRIGGER_TIMER0_COMP_A_INT, source);
+    ASSERT_EQ(ADC_SAMPLER_ERROR_OK, adc_sampler_get_sample_rate(0U, &rate));
+    ASSERT_EQ(9009UL, rate);
+
+    ASSERT_EQ(ADC_SAMPLER_ERROR_OK, adc_sampler_start(0U));
+    ASSERT_TRUE(timer_drivers_stub.timer_8_bit.running);
+    ASSERT_EQ(ADC_SAMPLER_ERROR_OK, adc_sampler_stop(0U));
+    ASSERT_FALSE(timer_drivers_stub.timer_8_bit.running);
+
+    ASSERT_EQ(ADC_SAMPLER_ERROR_OK, adc_sampler_deinit(0U));
+    ASSERT_FALSE(timer_drivers_stub.timer_8_bit.config.interrupt_config.it_comp_match_a);
+}
+
+TEST_F(AdcSamplerFixture, test_16_bit_timer_trigger_count)
+{
+    adc_autotrigger_sources_t source = ADC_TRIGGER_FREE_RUNNING;
+    uint32_t rate = 0;
+    uint16_t count = 0;
+
+    timer_drivers_stub.timer_16_bit.prescaler = TIMER16BIT_CLK_PRESCALER_1;
+    timer_drivers_stub.timer_16_bit.ocra = 15999U;
+    ASSERT_EQ(ADC_SAMPLER_ERROR_OK, adc_sampler_init(0U, &config));
+
+    /* CTC with TOP in OCR1A, compare unit B matches at TOP and triggers the ADC */
+    const timer_16_bit_config_t& timer_config = timer_drivers_stub.timer_16_bit.config;
+    ASSERT_EQ(TIMER16BIT_WG_CTC_OCRA_MAX, timer_config.timing_config.waveform_mode);
+    ASSERT_EQ(TIMER16BIT_CMOD_NORMAL, timer_config.timing_config.comp_match_a);
+    ASSERT_EQ(TIMER16BIT_CMOD_NORMAL, timer_config.timing_config.comp_match_b);
+    ASSERT_EQ(15999U, timer_config.timing_config.ocra_val);
+    ASSERT_EQ(15999U, timer_config.timing_config.ocrb_val);
+    ASSERT_TRUE(timer_config.interrupt_config.it_comp_match_b);
+    ASSERT_FALSE(timer_config.interrupt_config.it_comp_match_a);
+
+    ASSERT_EQ(ADC_SAMPLER_ERROR_OK, adc_sampler_get_trigger_source(0U, &source));
+    ASSERT_EQ(ADC_TRIGGER_TIMER1_COMP_B_INT, source);
+    ASSERT_EQ(ADC_SAMPLER_ERROR_OK, adc_sampler_get_sample_rate(0U, &rate));
+    ASSERT_EQ(1000UL, rate);
+
+    /* Trigger interrupts are counted from the last start */
+    adc_sampler_interrupt_callback(0U);
+    ASSERT_EQ(ADC_SAMPLER_ERROR_OK, adc_sampler_start(0U));
+    for (uint8_t i = 0 ; i < 5U ; i++)
+    {
+        adc_sampler_interrupt_callback(0U);
+    }
+    ASSERT_EQ(ADC_SAMPLER_ERROR_OK, adc_sampler_get_trigger_count(0U, &count));
+    ASSERT_EQ(5U, count);
+
+    ASSERT_EQ(ADC_SAMPLER_ERROR_OK, adc_sampler_deinit(0U));
+    ASSERT_FALSE(timer_drivers_stub.timer_16_bit.running);
+    ASSERT_FALSE(timer_drivers_stub.timer_16_bit.config.interrupt_config.it_comp_match_b);
+
+    /* Callback does nothing once deinitialised */
+    adc_sampler_interrupt_callback(0U);
+    ASSERT_EQ(ADC_SAMPLER_ERROR_UNINITIALISED, adc_sampler_get_trigger_count(0U, &count));
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
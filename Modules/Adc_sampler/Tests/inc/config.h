@@ -28,23 +28,9 @@ You should have received a copy of the GNU General Public License
 along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
-#ifndef TIMER_8_BIT_ASYNC_STUB_HEADER
-#define TIMER_8_BIT_ASYNC_STUB_HEADER
+#ifndef CONFIG_HEADER_STUB
+#define CONFIG_HEADER_STUB
 
-#ifdef __cplusplus
-extern "C"
-{
-#endif
+#define ADC_SAMPLER_MAX_MODULES 1U
 
-#include "timer_8_bit_async.h"
-#define TIMER_8_BIT_ASYNC_STUB_MAX_INSTANCES (1U)
-
-void timer_8_bit_async_stub_set_next_parameters(const timer_8_bit_async_prescaler_selection_t prescaler, const uint8_t ocra, const uint32_t accumulator);
-void timer_8_bit_async_stub_set_initialised(const bool initialised);
-void timer_8_bit_async_stub_reset(void);
-#ifdef __cplusplus
-}
-#endif
-
-
-#endif /* TIMER_8_BIT_ASYNC_STUB_HEADER */
\ No newline at end of file
+#endif /* CONFIG_HEADER_STUB */
@@ -0,0 +1,186 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef ADC_SAMPLER_HEADER
+#define ADC_SAMPLER_HEADER
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "adc_reg.h"
+
+/**
+ * @brief Describes available error codes for this adc sampler module
+*/
+typedef enum
+{
+    ADC_SAMPLER_ERROR_OK,                   /**< No particular error                                                */
+    ADC_SAMPLER_ERROR_UNINITIALISED,        /**< Targeted instance has not been initialised yet                     */
+    ADC_SAMPLER_ERROR_NULL_POINTER,         /**< One or more parameters are not initialised properly                */
+    ADC_SAMPLER_ERROR_INVALID_INDEX,        /**< Index is not set correctly, probably out of bounds                 */
+    ADC_SAMPLER_ERROR_CONFIG,               /**< Given configuration is not well-formed or rate cannot be reached   */
+    ADC_SAMPLER_ERROR_TIMER_UNINITIALISED,  /**< Underlying timer is not initialised                                */
+    ADC_SAMPLER_ERROR_TIMER_ERROR,          /**< Encountered an error while using underlying timer driver           */
+} adc_sampler_error_t;
+
+/**
+ * @brief Selects the timer which paces the ADC conversions.
+ * Only two compare units are wired to the ADC trigger logic : Timer 0 compare match A and Timer 1 compare match B.
+*/
+typedef enum
+{
+    ADC_SAMPLER_TIMER_8_BIT,        /**< Timer 0 : CTC mode with TOP in OCR0A, ADC triggered by compare match A           */
+    ADC_SAMPLER_TIMER_16_BIT,       /**< Timer 1 : CTC mode with TOP in OCR1A, ADC triggered by compare match B at TOP    */
+} adc_sampler_timer_t;
+
+/**
+ * @brief Initialisation structure
+*/
+typedef struct
+{
+    adc_sampler_timer_t timer_type;     /**< Kind of the underlying timer                                                   */
+    uint8_t timer_index;                /**< Index of the underlying timer (as used by timer_8_bit or timer_16_bit drivers)  */
+    uint32_t cpu_freq;                  /**< CPU frequency, used to compute the timer prescaler and TOP value               */
+    uint32_t sample_rate;               /**< Requested conversion rate, in Hz                                               */
+} adc_sampler_config_t;
+
+/**
+ * @brief Initialises the module using an id and a configuration.
+ * Underlying timer shall already be initialised : it is stopped and reconfigured in CTC mode so that one compare match
+ * happens every sample period. Both output compare pins are left disconnected.
+ * The compare match interrupt of the trigger unit is enabled, as its flag has to be cleared for the next trigger to happen :
+ * application shall route the matching vector to adc_sampler_interrupt_callback() (e.g. using TIMER_ISR_TIMER0_COMPA_HANDLER
+ * of the timer_isr driver).
+ * ADC shall be configured in auto triggered mode with the source given by adc_sampler_get_trigger_source() : conversions
+ * are then started by hardware at a fixed rate, without any software latency, and the ADC interrupt selects the next
+ * channel while the following conversion waits for its trigger. Sample period shall be longer than a conversion
+ * (13 ADC clock cycles) plus the ADC interrupt latency, otherwise triggers are delayed until the ADC is ready.
+ * @param[in] id     :  index of module to be initialised
+ * @param[in] config :  configuration to be used to initialise the targeted module
+ * @return
+ *          ADC_SAMPLER_ERROR_OK                    :   operation succeeded
+ *          ADC_SAMPLER_ERROR_NULL_POINTER          :   given parameter is uninitialised
+ *          ADC_SAMPLER_ERROR_INVALID_INDEX         :   given module id is out of bounds
+ *          ADC_SAMPLER_ERROR_CONFIG                :   timer type is unknown, or sample rate is null, higher than cpu
+ *                                                      frequency or too low to be reached without a software accumulator
+ *          ADC_SAMPLER_ERROR_TIMER_UNINITIALISED   :   underlying timer has not been initialised
+ *          ADC_SAMPLER_ERROR_TIMER_ERROR           :   underlying timer could not be configured
+*/
+adc_sampler_error_t adc_sampler_init(const uint8_t id, adc_sampler_config_t const * const config);
+
+/**
+ * @brief Deinitialises targeted module : underlying timer is stopped and trigger interrupt disabled
+ * @param[in] id    :   targeted module index
+ * @return
+ *          ADC_SAMPLER_ERROR_OK               :   operation succeeded
+ *          ADC_SAMPLER_ERROR_INVALID_INDEX    :   given module id is out of bounds
+ *          ADC_SAMPLER_ERROR_UNINITIALISED    :   cannot deinit a module which has not been initialised yet
+ *          ADC_SAMPLER_ERROR_TIMER_ERROR      :   underlying timer could not be configured
+*/
+adc_sampler_error_t adc_sampler_deinit(const uint8_t id);
+
+/**
+ * @brief Starts the underlying timer : first conversion is triggered one sample period later.
+ * ADC shall already be started, so that it only waits for the trigger event.
+ * @param[in] id    :   targeted module index
+ * @return
+ *          ADC_SAMPLER_ERROR_OK               :   operation succeeded
+ *          ADC_SAMPLER_ERROR_INVALID_INDEX    :   given module id is out of bounds
+ *          ADC_SAMPLER_ERROR_UNINITIALISED    :   selected module has not been initialised
+ *          ADC_SAMPLER_ERROR_TIMER_ERROR      :   underlying timer could not be started
+*/
+adc_sampler_error_t adc_sampler_start(const uint8_t id);
+
+/**
+ * @brief Stops the underlying timer : no conversion is triggered anymore
+ * @param[in] id    :   targeted module index
+ * @return
+ *          ADC_SAMPLER_ERROR_OK               :   operation succeeded
+ *          ADC_SAMPLER_ERROR_INVALID_INDEX    :   given module id is out of bounds
+ *          ADC_SAMPLER_ERROR_UNINITIALISED    :   selected module has not been initialised
+ *          ADC_SAMPLER_ERROR_TIMER_ERROR      :   underlying timer could not be stopped
+*/
+adc_sampler_error_t adc_sampler_stop(const uint8_t id);
+
+/**
+ * @brief Gives the sample rate actually generated by the underlying timer, which is the closest rate not lower than the
+ * requested one
+ * @param[in]   id      :   targeted module index
+ * @param[out]  rate    :   achieved sample rate, in Hz
+ * @return
+ *          ADC_SAMPLER_ERROR_OK               :   operation succeeded
+ *          ADC_SAMPLER_ERROR_NULL_POINTER     :   given parameter is uninitialised
+ *          ADC_SAMPLER_ERROR_INVALID_INDEX    :   given module id is out of bounds
+ *          ADC_SAMPLER_ERROR_UNINITIALISED    :   selected module has not been initialised
+*/
+adc_sampler_error_t adc_sampler_get_sample_rate(const uint8_t id, uint32_t * const rate);
+
+/**
+ * @brief Gives the ADC auto trigger source matching the timer used by the module
+ * @param[in]   id      :   targeted module index
+ * @param[out]  source  :   ADC trigger source to be used in ADC configuration
+ * @return
+ *          ADC_SAMPLER_ERROR_OK               :   operation succeeded
+ *          ADC_SAMPLER_ERROR_NULL_POINTER     :   given parameter is uninitialised
+ *          ADC_SAMPLER_ERROR_INVALID_INDEX    :   given module id is out of bounds
+ *          ADC_SAMPLER_ERROR_UNINITIALISED    :   selected module has not been initialised
+*/
+adc_sampler_error_t adc_sampler_get_trigger_source(const uint8_t id, adc_autotrigger_sources_t * const source);
+
+/**
+ * @brief Reads the number of conversions triggered since the module was started. Counter wraps around, a control loop can
+ * use it to detect missed periods.
+ * @param[in]   id      :   targeted module index
+ * @param[out]  count   :   number of trigger events
+ * @return
+ *          ADC_SAMPLER_ERROR_OK               :   operation succeeded
+ *          ADC_SAMPLER_ERROR_NULL_POINTER     :   given parameter is uninitialised
+ *          ADC_SAMPLER_ERROR_INVALID_INDEX    :   given module id is out of bounds
+ *          ADC_SAMPLER_ERROR_UNINITIALISED    :   selected module has not been initialised
+*/
+adc_sampler_error_t adc_sampler_get_trigger_count(const uint8_t id, uint16_t * const count);
+
+/**
+ * @brief A callback to be used within the trigger unit compare match ISR. Servicing the interrupt clears the trigger flag,
+ * which arms the next conversion trigger.
+ * @param[in]  id : index of targeted module
+*/
+void adc_sampler_interrupt_callback(const uint8_t id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADC_SAMPLER_HEADER */
\ No newline at end of file
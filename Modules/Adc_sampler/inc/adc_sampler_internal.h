@@ -0,0 +1,61 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef ADC_SAMPLER_INTERNAL_HEADER
+#define ADC_SAMPLER_INTERNAL_HEADER
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "config.h"
+#include "adc_sampler.h"
+
+#ifndef ADC_SAMPLER_MAX_MODULES
+    #error "ADC_SAMPLER_MAX_MODULES define is missing, please set the maximum number of available adc sampler modules in your config.h"
+#endif
+
+typedef struct
+{
+    adc_sampler_timer_t timer_type;     /**< Kind of the underlying timer                           */
+    uint8_t timer_id;                   /**< Index of the underlying timer                          */
+    uint32_t rate;                      /**< Achieved sample rate, in Hz                            */
+    volatile uint16_t trigger_count;    /**< Trigger events counted by the interrupt callback       */
+    bool initialised;
+} adc_sampler_internal_config_t;
+
+extern adc_sampler_internal_config_t adc_sampler_internal_config[ADC_SAMPLER_MAX_MODULES];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADC_SAMPLER_INTERNAL_HEADER */
\ No newline at end of file
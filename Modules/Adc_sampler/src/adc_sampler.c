@@ -0,0 +1,415 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "config.h"
+#include "adc_sampler.h"
+#include "adc_sampler_internal.h"
+#include "critical_section.h"
+
+#include "timer_8_bit.h"
+#include "timer_16_bit.h"
+
+#ifndef UNIT_TESTING
+    #include <avr/io.h>
+    #include <avr/interrupt.h>
+#endif
+
+adc_sampler_internal_config_t adc_sampler_internal_config[ADC_SAMPLER_MAX_MODULES] = {0};
+
+static inline bool is_index_valid(const uint8_t id)
+{
+    bool out = true;
+    if (id >= ADC_SAMPLER_MAX_MODULES)
+    {
+        out = false;
+    }
+    return out;
+}
+
+static void reset_internal_config(const uint8_t id)
+{
+    adc_sampler_internal_config[id].timer_type = ADC_SAMPLER_TIMER_8_BIT;
+    adc_sampler_internal_config[id].timer_id = 0;
+    adc_sampler_internal_config[id].rate = 0;
+    adc_sampler_internal_config[id].trigger_count = 0;
+    adc_sampler_internal_config[id].initialised = false;
+}
+
+static inline adc_sampler_error_t check_module(const uint8_t id)
+{
+    if (false == is_index_valid(id))
+    {
+        return ADC_SAMPLER_ERROR_INVALID_INDEX;
+    }
+
+    if (false == adc_sampler_internal_config[id].initialised)
+    {
+        return ADC_SAMPLER_ERROR_UNINITIALISED;
+    }
+    return ADC_SAMPLER_ERROR_OK;
+}
+
+/**
+ * @brief rate generated by a timer clocked at cpu_freq / prescaler which counts from 0 to top included
+*/
+static inline uint32_t compute_achieved_rate(const uint32_t cpu_freq, const uint16_t prescaler, const uint16_t top)
+{
+    return cpu_freq / ((uint32_t) prescaler * ((uint32_t) top + 1U));
+}
+
+/**
+ * @brief Timer 0 : CTC mode with TOP in OCR0A, compare match A triggers the ADC once per period.
+*/
+static adc_sampler_error_t setup_timer_8_bit(adc_sampler_internal_config_t * const module, adc_sampler_config_t const * const config)
+{
+    bool initialised = false;
+    timer_error_t err = timer_8_bit_is_initialised(module->timer_id, &initialised);
+    if (TIMER_ERROR_OK != err)
+    {
+        return ADC_SAMPLER_ERROR_TIMER_ERROR;
+    }
+
+    if (false == initialised)
+    {
+        return ADC_SAMPLER_ERROR_TIMER_UNINITIALISED;
+    }
+
+    uint8_t ocra = 0;
+    uint16_t accumulator = 0;
+    timer_8_bit_prescaler_selection_t prescaler;
+    timer_8_bit_compute_matching_parameters(&config->cpu_freq, &config->sample_rate, &prescaler, &ocra, &accumulator);
+
+    /* A software accumulator would bring the interrupt latency back into the sample period */
+    if (0U != accumulator)
+    {
+        return ADC_SAMPLER_ERROR_CONFIG;
+    }
+
+    timer_8_bit_config_t timer_config = {0};
+    err = timer_8_bit_stop(module->timer_id);
+    if (TIMER_ERROR_OK == err)
+    {
+        err = timer_8_bit_get_default_config(&timer_config);
+    }
+    if (TIMER_ERROR_OK == err)
+    {
+        err = timer_8_bit_get_handle(module->timer_id, &timer_config.handle);
+    }
+    if (TIMER_ERROR_OK == err)
+    {
+        timer_config.timing_config.waveform_mode = TIMER8BIT_WG_CTC;
+        timer_config.timing_config.comp_match_a = TIMER8BIT_CMOD_NORMAL;
+        timer_config.timing_config.comp_match_b = TIMER8BIT_CMOD_NORMAL;
+        timer_config.timing_config.ocra_val = ocra;
+        timer_config.timing_config.prescaler = prescaler;
+        timer_config.interrupt_config.it_comp_match_a = true;
+        err = timer_8_bit_reconfigure(module->timer_id, &timer_config);
+    }
+
+    if (TIMER_ERROR_OK != err)
+    {
+        return ADC_SAMPLER_ERROR_TIMER_ERROR;
+    }
+
+    module->rate = compute_achieved_rate(config->cpu_freq, timer_8_bit_prescaler_to_value(prescaler), ocra);
+    return ADC_SAMPLER_ERROR_OK;
+}
+
+/**
+ * @brief Timer 1 : CTC mode with TOP in OCR1A, compare match B is set to TOP as well and triggers the ADC once per period.
+*/
+static adc_sampler_error_t setup_timer_16_bit(adc_sampler_internal_config_t * const module, adc_sampler_config_t const * const config)
+{
+    bool initialised = false;
+    timer_error_t err = timer_16_bit_is_initialised(module->timer_id, &initialised);
+    if (TIMER_ERROR_OK != err)
+    {
+        return ADC_SAMPLER_ERROR_TIMER_ERROR;
+    }
+
+    if (false == initialised)
+    {
+        return ADC_SAMPLER_ERROR_TIMER_UNINITIALISED;
+    }
+
+    uint16_t ocra = 0;
+    uint16_t accumulator = 0;
+    timer_16_bit_prescaler_selection_t prescaler;
+    timer_16_bit_compute_matching_parameters(&config->cpu_freq, &config->sample_rate, &prescaler, &ocra, &accumulator);
+
+    if (0U != accumulator)
+    {
+        return ADC_SAMPLER_ERROR_CONFIG;
+    }
+
+    timer_16_bit_config_t timer_config = {0};
+    err = timer_16_bit_stop(module->timer_id);
+    if (TIMER_ERROR_OK == err)
+    {
+        err = timer_16_bit_get_default_config(&timer_config);
+    }
+    if (TIMER_ERROR_OK == err)
+    {
+        err = timer_16_bit_get_handle(module->timer_id, &timer_config.handle);
+    }
+    if (TIMER_ERROR_OK == err)
+    {
+        timer_config.timing_config.waveform_mode = TIMER16BIT_WG_CTC_OCRA_MAX;
+        timer_config.timing_config.comp_match_a = TIMER16BIT_CMOD_NORMAL;
+        timer_config.timing_config.comp_match_b = TIMER16BIT_CMOD_NORMAL;
+        timer_config.timing_config.ocra_val = ocra;
+        timer_config.timing_config.ocrb_val = ocra;
+        timer_config.timing_config.prescaler = prescaler;
+        timer_config.interrupt_config.it_comp_match_b = true;
+        err = timer_16_bit_reconfigure(module->timer_id, &timer_config);
+    }
+
+    if (TIMER_ERROR_OK != err)
+    {
+        return ADC_SAMPLER_ERROR_TIMER_ERROR;
+    }
+
+    module->rate = compute_achieved_rate(config->cpu_freq, timer_16_bit_prescaler_to_value(prescaler), ocra);
+    return ADC_SAMPLER_ERROR_OK;
+}
+
+adc_sampler_error_t adc_sampler_init(const uint8_t id, adc_sampler_config_t const * const config)
+{
+    if (false == is_index_valid(id))
+    {
+        return ADC_SAMPLER_ERROR_INVALID_INDEX;
+    }
+
+    if (NULL == config)
+    {
+        return ADC_SAMPLER_ERROR_NULL_POINTER;
+    }
+
+    if ((config->timer_type > ADC_SAMPLER_TIMER_16_BIT)
+    || (0U == config->sample_rate)
+    || (config->sample_rate > config->cpu_freq))
+    {
+        return ADC_SAMPLER_ERROR_CONFIG;
+    }
+
+    reset_internal_config(id);
+    adc_sampler_internal_config_t * const module = &adc_sampler_internal_config[id];
+    module->timer_type = config->timer_type;
+    module->timer_id = config->timer_index;
+
+    adc_sampler_error_t ret = ADC_SAMPLER_ERROR_OK;
+    if (ADC_SAMPLER_TIMER_8_BIT == config->timer_type)
+    {
+        ret = setup_timer_8_bit(module, config);
+    }
+    else
+    {
+        ret = setup_timer_16_bit(module, config);
+    }
+
+    if (ADC_SAMPLER_ERROR_OK != ret)
+    {
+        reset_internal_config(id);
+        return ret;
+    }
+
+    module->initialised = true;
+    return ADC_SAMPLER_ERROR_OK;
+}
+
+adc_sampler_error_t adc_sampler_deinit(const uint8_t id)
+{
+    adc_sampler_error_t ret = check_module(id);
+    if (ADC_SAMPLER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    adc_sampler_internal_config_t * const module = &adc_sampler_internal_config[id];
+    timer_error_t err = TIMER_ERROR_OK;
+    if (ADC_SAMPLER_TIMER_8_BIT == module->timer_type)
+    {
+        timer_8_bit_interrupt_config_t it_config = {0};
+        err = timer_8_bit_stop(module->timer_id);
+        if (TIMER_ERROR_OK == err)
+        {
+            err = timer_8_bit_get_interrupt_config(module->timer_id, &it_config);
+        }
+        if (TIMER_ERROR_OK == err)
+        {
+            it_config.it_comp_match_a = false;
+            err = timer_8_bit_set_interrupt_config(module->timer_id, &it_config);
+        }
+    }
+    else
+    {
+        timer_16_bit_interrupt_config_t it_config = {0};
+        err = timer_16_bit_stop(module->timer_id);
+        if (TIMER_ERROR_OK == err)
+        {
+            err = timer_16_bit_get_interrupt_config(module->timer_id, &it_config);
+        }
+        if (TIMER_ERROR_OK == err)
+        {
+            it_config.it_comp_match_b = false;
+            err = timer_16_bit_set_interrupt_config(module->timer_id, &it_config);
+        }
+    }
+
+    reset_internal_config(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return ADC_SAMPLER_ERROR_TIMER_ERROR;
+    }
+    return ADC_SAMPLER_ERROR_OK;
+}
+
+adc_sampler_error_t adc_sampler_start(const uint8_t id)
+{
+    adc_sampler_error_t ret = check_module(id);
+    if (ADC_SAMPLER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    adc_sampler_internal_config_t * const module = &adc_sampler_internal_config[id];
+    uint8_t sreg = 0;
+    CRITICAL_SECTION_ENTER(sreg);
+    module->trigger_count = 0;
+    CRITICAL_SECTION_EXIT(sreg);
+
+    timer_error_t err = TIMER_ERROR_OK;
+    if (ADC_SAMPLER_TIMER_8_BIT == module->timer_type)
+    {
+        err = timer_8_bit_start(module->timer_id);
+    }
+    else
+    {
+        err = timer_16_bit_start(module->timer_id);
+    }
+
+    if (TIMER_ERROR_OK != err)
+    {
+        return ADC_SAMPLER_ERROR_TIMER_ERROR;
+    }
+    return ADC_SAMPLER_ERROR_OK;
+}
+
+adc_sampler_error_t adc_sampler_stop(const uint8_t id)
+{
+    adc_sampler_error_t ret = check_module(id);
+    if (ADC_SAMPLER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    adc_sampler_internal_config_t * const module = &adc_sampler_internal_config[id];
+    timer_error_t err = TIMER_ERROR_OK;
+    if (ADC_SAMPLER_TIMER_8_BIT == module->timer_type)
+    {
+        err = timer_8_bit_stop(module->timer_id);
+    }
+    else
+    {
+        err = timer_16_bit_stop(module->timer_id);
+    }
+
+    if (TIMER_ERROR_OK != err)
+    {
+        return ADC_SAMPLER_ERROR_TIMER_ERROR;
+    }
+    return ADC_SAMPLER_ERROR_OK;
+}
+
+adc_sampler_error_t adc_sampler_get_sample_rate(const uint8_t id, uint32_t * const rate)
+{
+    adc_sampler_error_t ret = check_module(id);
+    if (ADC_SAMPLER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == rate)
+    {
+        return ADC_SAMPLER_ERROR_NULL_POINTER;
+    }
+
+    *rate = adc_sampler_internal_config[id].rate;
+    return ADC_SAMPLER_ERROR_OK;
+}
+
+adc_sampler_error_t adc_sampler_get_trigger_source(const uint8_t id, adc_autotrigger_sources_t * const source)
+{
+    adc_sampler_error_t ret = check_module(id);
+    if (ADC_SAMPLER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == source)
+    {
+        return ADC_SAMPLER_ERROR_NULL_POINTER;
+    }
+
+    *source = (ADC_SAMPLER_TIMER_8_BIT == adc_sampler_internal_config[id].timer_type) ? ADC_TRIGGER_TIMER0_COMP_A_INT
+                                                                                      : ADC_TRIGGER_TIMER1_COMP_B_INT;
+    return ADC_SAMPLER_ERROR_OK;
+}
+
+adc_sampler_error_t adc_sampler_get_trigger_count(const uint8_t id, uint16_t * const count)
+{
+    adc_sampler_error_t ret = check_module(id);
+    if (ADC_SAMPLER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == count)
+    {
+        return ADC_SAMPLER_ERROR_NULL_POINTER;
+    }
+
+    uint8_t sreg = 0;
+    CRITICAL_SECTION_ENTER(sreg);
+    *count = adc_sampler_internal_config[id].trigger_count;
+    CRITICAL_SECTION_EXIT(sreg);
+    return ADC_SAMPLER_ERROR_OK;
+}
+
+void adc_sampler_interrupt_callback(const uint8_t id)
+{
+    if (ADC_SAMPLER_ERROR_OK == check_module(id))
+    {
+        adc_sampler_internal_config[id].trigger_count++;
+    }
+}
\ No newline at end of file
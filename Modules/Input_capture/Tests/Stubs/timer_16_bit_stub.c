@@ -0,0 +1,123 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "timer_16_bit_stub.h"
+#include "string.h"
+
+timer_16_bit_stub_t timer_16_bit_stub = {0};
+
+static inline bool id_is_valid(const uint8_t id)
+{
+    return (id < TIMER_16_BIT_STUB_MAX_INSTANCES);
+}
+
+void timer_16_bit_stub_reset(void)
+{
+    memset(&timer_16_bit_stub, 0, sizeof(timer_16_bit_stub_t));
+}
+
+timer_error_t timer_16_bit_get_input_capture_value(uint8_t id, uint16_t * ticks)
+{
+    if (!id_is_valid(id))
+    {
+        return TIMER_ERROR_UNKNOWN_TIMER;
+    }
+    *ticks = timer_16_bit_stub.icr;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_get_interrupt_flags(uint8_t id, timer_16_bit_interrupt_config_t * const it_flags)
+{
+    if (!id_is_valid(id))
+    {
+        return TIMER_ERROR_UNKNOWN_TIMER;
+    }
+    *it_flags = timer_16_bit_stub.flags;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_clear_interrupt_flags(uint8_t id, timer_16_bit_interrupt_config_t const * const it_flags)
+{
+    if (!id_is_valid(id))
+    {
+        return TIMER_ERROR_UNKNOWN_TIMER;
+    }
+
+    if (it_flags->it_input_capture)
+    {
+        timer_16_bit_stub.flags.it_input_capture = false;
+    }
+    if (it_flags->it_timer_overflow)
+    {
+        timer_16_bit_stub.flags.it_timer_overflow = false;
+    }
+    timer_16_bit_stub.cleared_flags_count++;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_set_input_compare_edge_select(uint8_t id, const timer_16_bit_input_capture_edge_select_flag_t edge)
+{
+    if (!id_is_valid(id))
+    {
+        return TIMER_ERROR_UNKNOWN_TIMER;
+    }
+    timer_16_bit_stub.edge = edge;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_get_interrupt_config(uint8_t id, timer_16_bit_interrupt_config_t * const it_config)
+{
+    if (!id_is_valid(id))
+    {
+        return TIMER_ERROR_UNKNOWN_TIMER;
+    }
+    *it_config = timer_16_bit_stub.it_config;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_set_interrupt_config(uint8_t id, timer_16_bit_interrupt_config_t * const it_config)
+{
+    if (!id_is_valid(id))
+    {
+        return TIMER_ERROR_UNKNOWN_TIMER;
+    }
+    timer_16_bit_stub.it_config = *it_config;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_get_waveform_generation(uint8_t id, timer_16_bit_waveform_generation_t * waveform)
+{
+    if (!id_is_valid(id))
+    {
+        return TIMER_ERROR_UNKNOWN_TIMER;
+    }
+    *waveform = timer_16_bit_stub.waveform;
+    return TIMER_ERROR_OK;
+}
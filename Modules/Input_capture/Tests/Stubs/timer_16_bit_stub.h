@@ -0,0 +1,60 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TIMER_16_BIT_STUB_HEADER
+#define TIMER_16_BIT_STUB_HEADER
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "timer_16_bit.h"
+#define TIMER_16_BIT_STUB_MAX_INSTANCES (1U)
+
+typedef struct
+{
+    uint16_t icr;                                           /**< Value returned by the input capture getter                 */
+    timer_16_bit_interrupt_config_t flags;                  /**< Pending interrupt flags                                    */
+    timer_16_bit_interrupt_config_t it_config;              /**< Interrupt configuration written by the module              */
+    timer_16_bit_input_capture_edge_select_flag_t edge;     /**< Last input capture edge selected by the module             */
+    timer_16_bit_waveform_generation_t waveform;            /**< Waveform returned by the waveform getter                   */
+    uint8_t cleared_flags_count;                            /**< Number of calls to timer_16_bit_clear_interrupt_flags()    */
+} timer_16_bit_stub_t;
+
+extern timer_16_bit_stub_t timer_16_bit_stub;
+
+void timer_16_bit_stub_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMER_16_BIT_STUB_HEADER */
@@ -28,25 +28,9 @@ You should have received a copy of the GNU General Public License
 along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
-#ifndef TIMER_8_BIT_STUB_HEADER
-#define TIMER_8_BIT_STUB_HEADER
+#ifndef CONFIG_HEADER_STUB
+#define CONFIG_HEADER_STUB
 
-#ifdef __cplusplus
-extern "C"
-{
-#endif
+#define INPUT_CAPTURE_MAX_MODULES 1U
 
-#include "timer_8_bit.h"
-#define TIMER_8_BIT_STUB_MAX_INSTANCES (1U)
-
-void timer_8_bit_stub_set_next_parameters(const timer_8_bit_prescaler_selection_t prescaler, const uint8_t ocra, const uint32_t accumulator);
-void timer_8_bit_stub_set_initialised(const bool initialised);
-void timer_8_bit_stub_reset(void);
-void timer_8_bit_stub_get_driver_configuration(timer_8_bit_config_t * const config);
-
-#ifdef __cplusplus
-}
-#endif
-
-
-#endif /* TIMER_8_BIT_STUB_HEADER */
\ No newline at end of file
+#endif /* CONFIG_HEADER_STUB */
@@ -0,0 +1,194 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gtest/gtest.h"
+
+#include "config.h"
+#include "input_capture.h"
+#include "input_capture_internal.h"
+#include "timer_16_bit_stub.h"
+
+class InputCaptureFixture : public ::testing::Test
+{
+public:
+    void SetUp(void) override
+    {
+        timer_16_bit_stub_reset();
+        memset((void*) input_capture_internal_config, 0, sizeof(input_capture_internal_config));
+
+        config.timer_index = 0U;
+        config.timer_freq = 2'000'000;
+        config.timer_top = 0U;
+        config.edge = INPUT_CAPTURE_EDGE_RISING;
+    }
+
+    void TearDown(void) override
+    {
+
+    }
+
+    void capture(const uint16_t icr)
+    {
+        timer_16_bit_stub.icr = icr;
+        input_capture_capture_callback(0U);
+    }
+
+    input_capture_config_t config;
+};
+
+TEST_F(InputCaptureFixture, guard_uninitialised_and_wrong_parameters)
+{
+    uint32_t value = 0;
+    uint16_t duty = 0;
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_INVALID_INDEX, input_capture_init(INPUT_CAPTURE_MAX_MODULES, &config));
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_NULL_POINTER, input_capture_init(0U, NULL));
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_UNINITIALISED, input_capture_get_period(0U, &value));
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_UNINITIALISED, input_capture_deinit(0U));
+
+    config.timer_freq = 0U;
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_CONFIG, input_capture_init(0U, &config));
+
+    config.timer_freq = 2'000'000;
+    config.timer_index = 3U;
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_TIMER_ERROR, input_capture_init(0U, &config));
+
+    /* Counter is cleared on compare match without raising the overflow flag */
+    config.timer_index = 0U;
+    timer_16_bit_stub.waveform = TIMER16BIT_WG_CTC_OCRA_MAX;
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_CONFIG, input_capture_init(0U, &config));
+    timer_16_bit_stub.waveform = TIMER16BIT_WG_PWM_FAST_ICR_MAX;
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_CONFIG, input_capture_init(0U, &config));
+
+    timer_16_bit_stub.waveform = TIMER16BIT_WG_PWM_FAST_OCRA_MAX;
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_OK, input_capture_init(0U, &config));
+    timer_16_bit_stub.waveform = TIMER16BIT_WG_NORMAL;
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_OK, input_capture_init(0U, &config));
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_NULL_POINTER, input_capture_get_frequency(0U, NULL));
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_NOT_ENOUGH_DATA, input_capture_get_last_timestamp(0U, &value));
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_CONFIG, input_capture_get_duty_cycle(0U, &duty));
+
+    /* Only one edge captured so far */
+    capture(100U);
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_NOT_ENOUGH_DATA, input_capture_get_period(0U, &value));
+}
+
+TEST_F(InputCaptureFixture, test_init_enables_interrupts)
+{
+    timer_16_bit_stub.it_config.it_comp_match_a = true;
+    timer_16_bit_stub.flags.it_input_capture = true;
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_OK, input_capture_init(0U, &config));
+
+    ASSERT_TRUE(timer_16_bit_stub.it_config.it_input_capture);
+    ASSERT_TRUE(timer_16_bit_stub.it_config.it_timer_overflow);
+    ASSERT_TRUE(timer_16_bit_stub.it_config.it_comp_match_a);
+    ASSERT_FALSE(timer_16_bit_stub.flags.it_input_capture);
+    ASSERT_EQ(TIMER16BIT_INPUT_CAPTURE_EDGE_RISING_EDGE, timer_16_bit_stub.edge);
+
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_OK, input_capture_deinit(0U));
+    ASSERT_FALSE(timer_16_bit_stub.it_config.it_input_capture);
+    ASSERT_TRUE(timer_16_bit_stub.it_config.it_comp_match_a);
+}
+
+TEST_F(InputCaptureFixture, test_period_and_frequency_across_overflows)
+{
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_OK, input_capture_init(0U, &config));
+
+    capture(60000U);
+    input_capture_overflow_callback(0U);
+    input_capture_overflow_callback(0U);
+    capture(1000U);
+
+    uint32_t timestamp = 0;
+    uint32_t period = 0;
+    uint32_t frequency = 0;
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_OK, input_capture_get_last_timestamp(0U, &timestamp));
+    ASSERT_EQ(2U * 65536U + 1000U, timestamp);
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_OK, input_capture_get_period(0U, &period));
+    ASSERT_EQ(2U * 65536U + 1000U - 60000U, period);
+
+    /* 2 MHz / 72072 ticks = 27.7500 Hz */
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_OK, input_capture_get_frequency(0U, &frequency));
+    ASSERT_EQ(27750U, frequency);
+}
+
+TEST_F(InputCaptureFixture, test_pending_overflow_is_accounted)
+{
+    config.timer_top = 999U;
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_OK, input_capture_init(0U, &config));
+
+    /* Overflow is pending but edge was captured right before the timer wrapped around */
+    timer_16_bit_stub.flags.it_timer_overflow = true;
+    capture(990U);
+
+    /* Edge captured right after the timer wrapped around, overflow ISR did not run yet */
+    capture(5U);
+
+    uint32_t timestamp = 0;
+    ASSERT_EQ(990U, input_capture_internal_config[0].events[0].timestamp);
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_OK, input_capture_get_last_timestamp(0U, &timestamp));
+    ASSERT_EQ(1005U, timestamp);
+
+    /* Overflow is now handled */
+    timer_16_bit_stub.flags.it_timer_overflow = false;
+    input_capture_overflow_callback(0U);
+    capture(10U);
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_OK, input_capture_get_last_timestamp(0U, &timestamp));
+    ASSERT_EQ(1010U, timestamp);
+}
+
+TEST_F(InputCaptureFixture, test_duty_cycle_with_both_edges)
+{
+    config.edge = INPUT_CAPTURE_EDGE_BOTH;
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_OK, input_capture_init(0U, &config));
+
+    capture(1000U);
+    ASSERT_EQ(TIMER16BIT_INPUT_CAPTURE_EDGE_FALLING_EDGE, timer_16_bit_stub.edge);
+    capture(1250U);
+    ASSERT_EQ(TIMER16BIT_INPUT_CAPTURE_EDGE_RISING_EDGE, timer_16_bit_stub.edge);
+    capture(2000U);
+
+    uint16_t duty = 0;
+    uint32_t period = 0;
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_OK, input_capture_get_period(0U, &period));
+    ASSERT_EQ(1000U, period);
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_OK, input_capture_get_duty_cycle(0U, &duty));
+    ASSERT_EQ(250U, duty);
+
+    /* Last edge is a falling one : high time is measured between the two last edges */
+    capture(2250U);
+    ASSERT_EQ(INPUT_CAPTURE_ERROR_OK, input_capture_get_duty_cycle(0U, &duty));
+    ASSERT_EQ(250U, duty);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,172 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef INPUT_CAPTURE_HEADER
+#define INPUT_CAPTURE_HEADER
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Describes available error codes for this input capture module
+*/
+typedef enum
+{
+    INPUT_CAPTURE_ERROR_OK,                 /**< No particular error                                                */
+    INPUT_CAPTURE_ERROR_UNINITIALISED,      /**< Targeted input capture instance has not been initialised yet       */
+    INPUT_CAPTURE_ERROR_NULL_POINTER,       /**< One or more parameters are not initialised properly                */
+    INPUT_CAPTURE_ERROR_INVALID_INDEX,      /**< Index is not set correctly, probably out of bounds                 */
+    INPUT_CAPTURE_ERROR_CONFIG,             /**< Given configuration is not well-formed                             */
+    INPUT_CAPTURE_ERROR_NOT_ENOUGH_DATA,    /**< Not enough edges were captured yet to compute the requested value  */
+    INPUT_CAPTURE_ERROR_TIMER_ERROR,        /**< Encountered an error while using underlying timer driver           */
+} input_capture_error_t;
+
+/**
+ * @brief Selects which edges are captured
+*/
+typedef enum
+{
+    INPUT_CAPTURE_EDGE_RISING,      /**< Captures rising edges only, period and frequency are available                     */
+    INPUT_CAPTURE_EDGE_FALLING,     /**< Captures falling edges only, period and frequency are available                    */
+    INPUT_CAPTURE_EDGE_BOTH,        /**< Edge selection is toggled after each capture, which also gives access to duty cycle */
+} input_capture_edge_t;
+
+/**
+ * @brief Initialisation structure
+*/
+typedef struct
+{
+    uint8_t timer_index;        /**< Index of the underlying 16 bit timer (as used by timer_16_bit driver)              */
+    uint32_t timer_freq;        /**< Frequency at which the underlying timer counts (CPU frequency / timer prescaler)   */
+    uint16_t timer_top;         /**< TOP value of the underlying timer, 0 stands for 0xFFFF (normal counting mode).
+                                     Timer shall run in normal mode or in a fast PWM mode which does not use ICR as TOP */
+    input_capture_edge_t edge;  /**< Selects which edges are captured                                                   */
+} input_capture_config_t;
+
+/**
+ * @brief Initialises the input capture module using an id and a configuration.
+ * Underlying timer shall already be initialised, its input capture and overflow interrupts are enabled by this function.
+ * @param[in] id     :  index of input capture module to be initialised
+ * @param[in] config :  configuration to be used to initialise the targeted input capture module
+ * @return
+ *          INPUT_CAPTURE_ERROR_OK              :   operation succeeded
+ *          INPUT_CAPTURE_ERROR_NULL_POINTER    :   given parameter is uninitialised
+ *          INPUT_CAPTURE_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          INPUT_CAPTURE_ERROR_CONFIG          :   timer frequency is null, edge selection is unknown or timer waveform is not supported
+ *          INPUT_CAPTURE_ERROR_TIMER_ERROR     :   underlying timer could not be configured
+*/
+input_capture_error_t input_capture_init(const uint8_t id, input_capture_config_t const * const config);
+
+/**
+ * @brief Deinitialises targeted input capture module and disables the input capture interrupt
+ * @param[in] id    :   targeted input capture module index
+ * @return
+ *          INPUT_CAPTURE_ERROR_OK              :   operation succeeded
+ *          INPUT_CAPTURE_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          INPUT_CAPTURE_ERROR_UNINITIALISED   :   cannot deinit a module which has not been initialised yet
+*/
+input_capture_error_t input_capture_deinit(const uint8_t id);
+
+/**
+ * @brief Reads the last captured timestamp, extended to 32 bits using the overflow count of underlying timer
+ * @param[in]   id          : index of targeted input capture module
+ * @param[out]  timestamp   : last captured timestamp, in timer ticks
+ * @return
+ *          INPUT_CAPTURE_ERROR_OK              :   operation succeeded
+ *          INPUT_CAPTURE_ERROR_NULL_POINTER    :   given parameter is uninitialised
+ *          INPUT_CAPTURE_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          INPUT_CAPTURE_ERROR_UNINITIALISED   :   selected module has not been initialised
+ *          INPUT_CAPTURE_ERROR_NOT_ENOUGH_DATA :   no edge was captured yet
+*/
+input_capture_error_t input_capture_get_last_timestamp(const uint8_t id, uint32_t * const timestamp);
+
+/**
+ * @brief Computes the period of the measured signal using the last captured edges
+ * @param[in]   id      : index of targeted input capture module
+ * @param[out]  period  : signal period, in timer ticks
+ * @return
+ *          INPUT_CAPTURE_ERROR_OK              :   operation succeeded
+ *          INPUT_CAPTURE_ERROR_NULL_POINTER    :   given parameter is uninitialised
+ *          INPUT_CAPTURE_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          INPUT_CAPTURE_ERROR_UNINITIALISED   :   selected module has not been initialised
+ *          INPUT_CAPTURE_ERROR_NOT_ENOUGH_DATA :   not enough edges were captured yet
+*/
+input_capture_error_t input_capture_get_period(const uint8_t id, uint32_t * const period);
+
+/**
+ * @brief Computes the frequency of the measured signal using the last captured edges
+ * @param[in]   id          : index of targeted input capture module
+ * @param[out]  frequency   : signal frequency, in millihertz
+ * @return
+ *          INPUT_CAPTURE_ERROR_OK              :   operation succeeded
+ *          INPUT_CAPTURE_ERROR_NULL_POINTER    :   given parameter is uninitialised
+ *          INPUT_CAPTURE_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          INPUT_CAPTURE_ERROR_UNINITIALISED   :   selected module has not been initialised
+ *          INPUT_CAPTURE_ERROR_NOT_ENOUGH_DATA :   not enough edges were captured yet
+*/
+input_capture_error_t input_capture_get_frequency(const uint8_t id, uint32_t * const frequency);
+
+/**
+ * @brief Computes the duty cycle of the measured signal using the last captured edges.
+ * Only available when module captures both edges (INPUT_CAPTURE_EDGE_BOTH)
+ * @param[in]   id      : index of targeted input capture module
+ * @param[out]  duty    : signal duty cycle (high level time over period), in per mille
+ * @return
+ *          INPUT_CAPTURE_ERROR_OK              :   operation succeeded
+ *          INPUT_CAPTURE_ERROR_NULL_POINTER    :   given parameter is uninitialised
+ *          INPUT_CAPTURE_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          INPUT_CAPTURE_ERROR_UNINITIALISED   :   selected module has not been initialised
+ *          INPUT_CAPTURE_ERROR_CONFIG          :   module does not capture both edges
+ *          INPUT_CAPTURE_ERROR_NOT_ENOUGH_DATA :   not enough edges were captured yet
+*/
+input_capture_error_t input_capture_get_duty_cycle(const uint8_t id, uint16_t * const duty);
+
+/**
+ * @brief A callback to be used within the Timer input capture ISR (e.g. TIMER1_CAPT_vect) which stores the captured edge
+ * @param[in]  id : index of targeted input capture module
+*/
+void input_capture_capture_callback(const uint8_t id);
+
+/**
+ * @brief A callback to be used within the Timer overflow ISR (e.g. TIMER1_OVF_vect) which extends timestamps to 32 bits
+ * @param[in]  id : index of targeted input capture module
+*/
+void input_capture_overflow_callback(const uint8_t id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INPUT_CAPTURE_HEADER */
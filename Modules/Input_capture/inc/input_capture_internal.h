@@ -0,0 +1,81 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef INPUT_CAPTURE_INTERNAL_HEADER
+#define INPUT_CAPTURE_INTERNAL_HEADER
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "config.h"
+#include "input_capture.h"
+
+#ifndef INPUT_CAPTURE_MAX_MODULES
+    #error "INPUT_CAPTURE_MAX_MODULES define is missing, please set the maximum number of available input capture modules in your config.h"
+#endif
+
+/* Captured edges ring buffer depth, shall be a power of 2 */
+#ifndef INPUT_CAPTURE_BUFFER_SIZE
+    #define INPUT_CAPTURE_BUFFER_SIZE 8U
+#endif
+
+#if (INPUT_CAPTURE_BUFFER_SIZE < 4U) || ((INPUT_CAPTURE_BUFFER_SIZE & (INPUT_CAPTURE_BUFFER_SIZE - 1U)) != 0U)
+    #error "INPUT_CAPTURE_BUFFER_SIZE shall be a power of 2, at least 4"
+#endif
+
+typedef struct
+{
+    uint32_t timestamp;     /**< Captured timer value, extended to 32 bits with the overflows       */
+    bool rising;            /**< Tells whether this capture was triggered by a rising edge          */
+} input_capture_event_t;
+
+typedef struct
+{
+    uint8_t timer_id;                   /**< Index of the underlying 16 bit timer                                       */
+    uint32_t timer_freq;                /**< Underlying timer counting frequency                                        */
+    uint32_t timer_period;              /**< Number of ticks between two overflows of underlying timer (TOP + 1)        */
+    input_capture_edge_t edge;          /**< Captured edges                                                             */
+    bool next_edge_rising;              /**< Edge currently armed on the input capture unit                             */
+    volatile uint32_t base;             /**< Timestamp of the last timer overflow, used to extend captures to 32 bits   */
+    volatile uint8_t head;
+    volatile uint8_t count;
+    volatile input_capture_event_t events[INPUT_CAPTURE_BUFFER_SIZE];
+    bool initialised;
+} input_capture_internal_config_t;
+
+extern input_capture_internal_config_t input_capture_internal_config[INPUT_CAPTURE_MAX_MODULES];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INPUT_CAPTURE_INTERNAL_HEADER */
@@ -0,0 +1,427 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <limits.h>
+
+#include "config.h"
+#include "input_capture.h"
+#include "input_capture_internal.h"
+
+#include "timer_16_bit.h"
+
+#define INPUT_CAPTURE_BUFFER_MASK (INPUT_CAPTURE_BUFFER_SIZE - 1U)
+#define INPUT_CAPTURE_PER_MILLE   (1000UL)
+
+input_capture_internal_config_t input_capture_internal_config[INPUT_CAPTURE_MAX_MODULES] = {0};
+
+static inline bool is_index_valid(const uint8_t id)
+{
+    bool out = true;
+    if (id >= INPUT_CAPTURE_MAX_MODULES)
+    {
+        out = false;
+    }
+    return out;
+}
+
+static void reset_internal_config(const uint8_t id)
+{
+    input_capture_internal_config[id].timer_id = 0;
+    input_capture_internal_config[id].timer_freq = 0;
+    input_capture_internal_config[id].timer_period = 0;
+    input_capture_internal_config[id].edge = INPUT_CAPTURE_EDGE_RISING;
+    input_capture_internal_config[id].next_edge_rising = true;
+    input_capture_internal_config[id].base = 0;
+    input_capture_internal_config[id].head = 0;
+    input_capture_internal_config[id].count = 0;
+    input_capture_internal_config[id].initialised = false;
+}
+
+static inline input_capture_error_t check_module(const uint8_t id)
+{
+    if (false == is_index_valid(id))
+    {
+        return INPUT_CAPTURE_ERROR_INVALID_INDEX;
+    }
+
+    if (false == input_capture_internal_config[id].initialised)
+    {
+        return INPUT_CAPTURE_ERROR_UNINITIALISED;
+    }
+    return INPUT_CAPTURE_ERROR_OK;
+}
+
+/**
+ * @brief copies the last captured events, newest first. Captures keep on being written by the ISR while we read them,
+ * so the copy is started again if a new edge was captured in the meantime. Events are volatile as well : their loads
+ * cannot be moved across the head reads by the compiler.
+*/
+static uint8_t read_last_events(const uint8_t id, input_capture_event_t * const events, const uint8_t wanted)
+{
+    input_capture_internal_config_t * const module = &input_capture_internal_config[id];
+    uint8_t head = 0;
+    uint8_t count = 0;
+    do
+    {
+        head = module->head;
+        count = module->count;
+        if (count > wanted)
+        {
+            count = wanted;
+        }
+
+        for (uint8_t i = 0 ; i < count ; i++)
+        {
+            events[i] = module->events[(uint8_t)(head - 1U - i) & INPUT_CAPTURE_BUFFER_MASK];
+        }
+    } while (head != module->head);
+    return count;
+}
+
+/**
+ * @brief computes (numerator * scale) / denominator without overflowing 32 bits integers.
+ * Both operands are scaled down when needed, which only loses precision on very long periods.
+*/
+static uint32_t scaled_ratio(uint32_t numerator, uint32_t denominator, const uint32_t scale)
+{
+    while (numerator > (UINT32_MAX / scale))
+    {
+        numerator >>= 1U;
+        denominator >>= 1U;
+    }
+    return (numerator * scale) / denominator;
+}
+
+/**
+ * @brief tells whether timestamps can be extended using the overflow interrupt with the given waveform.
+ * Timer shall count upwards only and raise its overflow flag when it wraps around : CTC modes clear the counter on a
+ * compare match without raising the overflow flag, and ICR based modes use the input capture register as TOP value.
+*/
+static bool is_waveform_supported(const timer_16_bit_waveform_generation_t waveform)
+{
+    switch (waveform)
+    {
+        case TIMER16BIT_WG_NORMAL:
+        case TIMER16BIT_WG_PWM_FAST_8_bit_FULL_RANGE:
+        case TIMER16BIT_WG_PWM_FAST_9_bit_FULL_RANGE:
+        case TIMER16BIT_WG_PWM_FAST_10_bit_FULL_RANGE:
+        case TIMER16BIT_WG_PWM_FAST_OCRA_MAX:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+input_capture_error_t input_capture_init(const uint8_t id, input_capture_config_t const * const config)
+{
+    if (false == is_index_valid(id))
+    {
+        return INPUT_CAPTURE_ERROR_INVALID_INDEX;
+    }
+
+    if (NULL == config)
+    {
+        return INPUT_CAPTURE_ERROR_NULL_POINTER;
+    }
+
+    if ((0U == config->timer_freq) || (config->edge > INPUT_CAPTURE_EDGE_BOTH))
+    {
+        return INPUT_CAPTURE_ERROR_CONFIG;
+    }
+
+    timer_16_bit_waveform_generation_t waveform = TIMER16BIT_WG_NORMAL;
+    timer_error_t err = timer_16_bit_get_waveform_generation(config->timer_index, &waveform);
+    if (TIMER_ERROR_OK != err)
+    {
+        return INPUT_CAPTURE_ERROR_TIMER_ERROR;
+    }
+
+    if (false == is_waveform_supported(waveform))
+    {
+        return INPUT_CAPTURE_ERROR_CONFIG;
+    }
+
+    reset_internal_config(id);
+    input_capture_internal_config_t * const module = &input_capture_internal_config[id];
+    module->timer_id = config->timer_index;
+    module->timer_freq = config->timer_freq;
+    module->timer_period = (uint32_t) config->timer_top + 1U;
+    if (0U == config->timer_top)
+    {
+        module->timer_period = TIMER_GENERIC_16_BIT_LIMIT_VALUE;
+    }
+    module->edge = config->edge;
+    module->next_edge_rising = (INPUT_CAPTURE_EDGE_FALLING != config->edge);
+
+    timer_16_bit_input_capture_edge_select_flag_t edge = module->next_edge_rising ? TIMER16BIT_INPUT_CAPTURE_EDGE_RISING_EDGE
+                                                                                  : TIMER16BIT_INPUT_CAPTURE_EDGE_FALLING_EDGE;
+    err = timer_16_bit_set_input_compare_edge_select(module->timer_id, edge);
+    if (TIMER_ERROR_OK != err)
+    {
+        return INPUT_CAPTURE_ERROR_TIMER_ERROR;
+    }
+
+    /* Keep interrupts already used by the application untouched */
+    timer_16_bit_interrupt_config_t it_config = {0};
+    err = timer_16_bit_get_interrupt_config(module->timer_id, &it_config);
+    if (TIMER_ERROR_OK != err)
+    {
+        return INPUT_CAPTURE_ERROR_TIMER_ERROR;
+    }
+
+    /* Discard edges which could have been captured before this module was set up */
+    timer_16_bit_interrupt_config_t flags = {0};
+    flags.it_input_capture = true;
+    flags.it_timer_overflow = true;
+    err = timer_16_bit_clear_interrupt_flags(module->timer_id, &flags);
+    if (TIMER_ERROR_OK != err)
+    {
+        return INPUT_CAPTURE_ERROR_TIMER_ERROR;
+    }
+
+    it_config.it_input_capture = true;
+    it_config.it_timer_overflow = true;
+    err = timer_16_bit_set_interrupt_config(module->timer_id, &it_config);
+    if (TIMER_ERROR_OK != err)
+    {
+        return INPUT_CAPTURE_ERROR_TIMER_ERROR;
+    }
+
+    module->initialised = true;
+    return INPUT_CAPTURE_ERROR_OK;
+}
+
+input_capture_error_t input_capture_deinit(const uint8_t id)
+{
+    input_capture_error_t ret = check_module(id);
+    if (INPUT_CAPTURE_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    /* Overflow interrupt might still be used by the application, only release the input capture one */
+    timer_16_bit_interrupt_config_t it_config = {0};
+    timer_error_t err = timer_16_bit_get_interrupt_config(input_capture_internal_config[id].timer_id, &it_config);
+    if (TIMER_ERROR_OK == err)
+    {
+        it_config.it_input_capture = false;
+        err = timer_16_bit_set_interrupt_config(input_capture_internal_config[id].timer_id, &it_config);
+    }
+
+    reset_internal_config(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return INPUT_CAPTURE_ERROR_TIMER_ERROR;
+    }
+    return INPUT_CAPTURE_ERROR_OK;
+}
+
+input_capture_error_t input_capture_get_last_timestamp(const uint8_t id, uint32_t * const timestamp)
+{
+    input_capture_error_t ret = check_module(id);
+    if (INPUT_CAPTURE_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == timestamp)
+    {
+        return INPUT_CAPTURE_ERROR_NULL_POINTER;
+    }
+
+    input_capture_event_t last = {0};
+    if (1U != read_last_events(id, &last, 1U))
+    {
+        return INPUT_CAPTURE_ERROR_NOT_ENOUGH_DATA;
+    }
+
+    *timestamp = last.timestamp;
+    return INPUT_CAPTURE_ERROR_OK;
+}
+
+input_capture_error_t input_capture_get_period(const uint8_t id, uint32_t * const period)
+{
+    input_capture_error_t ret = check_module(id);
+    if (INPUT_CAPTURE_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == period)
+    {
+        return INPUT_CAPTURE_ERROR_NULL_POINTER;
+    }
+
+    /* When both edges are captured, the previous edge of the same kind is two captures behind */
+    const uint8_t wanted = (INPUT_CAPTURE_EDGE_BOTH == input_capture_internal_config[id].edge) ? 3U : 2U;
+    input_capture_event_t events[3] = {0};
+    if (wanted != read_last_events(id, events, wanted))
+    {
+        return INPUT_CAPTURE_ERROR_NOT_ENOUGH_DATA;
+    }
+
+    /* Unsigned arithmetic handles the 32 bits timestamp roll over */
+    *period = events[0].timestamp - events[wanted - 1U].timestamp;
+    return INPUT_CAPTURE_ERROR_OK;
+}
+
+input_capture_error_t input_capture_get_frequency(const uint8_t id, uint32_t * const frequency)
+{
+    if (NULL == frequency)
+    {
+        return INPUT_CAPTURE_ERROR_NULL_POINTER;
+    }
+
+    uint32_t period = 0;
+    input_capture_error_t ret = input_capture_get_period(id, &period);
+    if (INPUT_CAPTURE_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (0U == period)
+    {
+        return INPUT_CAPTURE_ERROR_NOT_ENOUGH_DATA;
+    }
+
+    const uint32_t timer_freq = input_capture_internal_config[id].timer_freq;
+    const uint32_t hertz = timer_freq / period;
+    if (hertz > (UINT32_MAX / INPUT_CAPTURE_PER_MILLE))
+    {
+        *frequency = UINT32_MAX;
+    }
+    else
+    {
+        *frequency = (hertz * INPUT_CAPTURE_PER_MILLE) + scaled_ratio(timer_freq % period, period, INPUT_CAPTURE_PER_MILLE);
+    }
+    return INPUT_CAPTURE_ERROR_OK;
+}
+
+input_capture_error_t input_capture_get_duty_cycle(const uint8_t id, uint16_t * const duty)
+{
+    input_capture_error_t ret = check_module(id);
+    if (INPUT_CAPTURE_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == duty)
+    {
+        return INPUT_CAPTURE_ERROR_NULL_POINTER;
+    }
+
+    if (INPUT_CAPTURE_EDGE_BOTH != input_capture_internal_config[id].edge)
+    {
+        return INPUT_CAPTURE_ERROR_CONFIG;
+    }
+
+    input_capture_event_t events[3] = {0};
+    if (3U != read_last_events(id, events, 3U))
+    {
+        return INPUT_CAPTURE_ERROR_NOT_ENOUGH_DATA;
+    }
+
+    const uint32_t period = events[0].timestamp - events[2].timestamp;
+    if (0U == period)
+    {
+        return INPUT_CAPTURE_ERROR_NOT_ENOUGH_DATA;
+    }
+
+    /* High level time always spans from a rising edge to the next falling one */
+    uint32_t high_time = 0;
+    if (true == events[0].rising)
+    {
+        high_time = events[1].timestamp - events[2].timestamp;
+    }
+    else
+    {
+        high_time = events[0].timestamp - events[1].timestamp;
+    }
+
+    *duty = (uint16_t) scaled_ratio(high_time, period, INPUT_CAPTURE_PER_MILLE);
+    return INPUT_CAPTURE_ERROR_OK;
+}
+
+void input_capture_capture_callback(const uint8_t id)
+{
+    if (false == is_index_valid(id))
+    {
+        return;
+    }
+
+    input_capture_internal_config_t * const module = &input_capture_internal_config[id];
+    uint16_t captured = 0;
+    timer_16_bit_interrupt_config_t flags = {0};
+    (void) timer_16_bit_get_input_capture_value(module->timer_id, &captured);
+    (void) timer_16_bit_get_interrupt_flags(module->timer_id, &flags);
+
+    /* Input capture interrupt has a higher priority than the overflow one : if an overflow is still pending and
+    the captured value sits in the lower half of the counting range, the edge came after the overflow */
+    uint32_t base = module->base;
+    if ((true == flags.it_timer_overflow) && (captured < (module->timer_period >> 1U)))
+    {
+        base += module->timer_period;
+    }
+
+    volatile input_capture_event_t * const event = &module->events[module->head & INPUT_CAPTURE_BUFFER_MASK];
+    event->timestamp = base + captured;
+    event->rising = module->next_edge_rising;
+    module->head++;
+    if (module->count < INPUT_CAPTURE_BUFFER_SIZE)
+    {
+        module->count++;
+    }
+
+    if (INPUT_CAPTURE_EDGE_BOTH == module->edge)
+    {
+        module->next_edge_rising = !module->next_edge_rising;
+        timer_16_bit_input_capture_edge_select_flag_t edge = module->next_edge_rising ? TIMER16BIT_INPUT_CAPTURE_EDGE_RISING_EDGE
+                                                                                      : TIMER16BIT_INPUT_CAPTURE_EDGE_FALLING_EDGE;
+        (void) timer_16_bit_set_input_compare_edge_select(module->timer_id, edge);
+
+        /* Changing the edge selection may raise the input capture flag, which has to be cleared afterwards */
+        timer_16_bit_interrupt_config_t capture_flag = {0};
+        capture_flag.it_input_capture = true;
+        (void) timer_16_bit_clear_interrupt_flags(module->timer_id, &capture_flag);
+    }
+}
+
+void input_capture_overflow_callback(const uint8_t id)
+{
+    if (false == is_index_valid(id))
+    {
+        return;
+    }
+
+    input_capture_internal_config[id].base += input_capture_internal_config[id].timer_period;
+}
@@ -0,0 +1,232 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "timer_drivers_stub.h"
+#include "string.h"
+
+timer_drivers_stub_t timer_drivers_stub = {0};
+
+static inline timer_error_t check_call(const uint8_t id)
+{
+    if (id >= TIMER_DRIVERS_STUB_MAX_INSTANCES)
+    {
+        return TIMER_ERROR_UNKNOWN_TIMER;
+    }
+    timer_error_t err = timer_drivers_stub.next_error;
+    timer_drivers_stub.next_error = TIMER_ERROR_OK;
+    return err;
+}
+
+void timer_drivers_stub_reset(void)
+{
+    memset(&timer_drivers_stub, 0, sizeof(timer_drivers_stub_t));
+}
+
+timer_error_t timer_8_bit_set_waveform_generation(uint8_t id, const timer_8_bit_waveform_generation_t waveform)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_8_bit.waveform = waveform;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_set_counter_value(uint8_t id, const uint8_t ticks)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_8_bit.counter = ticks;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_get_counter_value(uint8_t id, uint8_t * ticks)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    *ticks = timer_drivers_stub.timer_8_bit.counter;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_get_interrupt_config(uint8_t id, timer_8_bit_interrupt_config_t * it_config)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    *it_config = timer_drivers_stub.timer_8_bit.it_config;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_set_interrupt_config(uint8_t id, timer_8_bit_interrupt_config_t * const it_config)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_8_bit.it_config = *it_config;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_get_interrupt_flags(uint8_t id, timer_8_bit_interrupt_config_t * it_flags)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    *it_flags = timer_drivers_stub.timer_8_bit.flags;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_clear_interrupt_flags(uint8_t id, timer_8_bit_interrupt_config_t const * const it_flags)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    if (it_flags->it_timer_overflow)
+    {
+        timer_drivers_stub.timer_8_bit.flags.it_timer_overflow = false;
+    }
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_set_prescaler(uint8_t id, const timer_8_bit_prescaler_selection_t prescaler)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_8_bit.prescaler = prescaler;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_set_waveform_generation(uint8_t id, const timer_16_bit_waveform_generation_t waveform)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.waveform = waveform;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_set_counter_value(uint8_t id, const uint16_t * const ticks)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.counter = *ticks;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_get_counter_value(uint8_t id, uint16_t * const ticks)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    *ticks = timer_drivers_stub.timer_16_bit.counter;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_get_interrupt_config(uint8_t id, timer_16_bit_interrupt_config_t * it_config)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    *it_config = timer_drivers_stub.timer_16_bit.it_config;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_set_interrupt_config(uint8_t id, timer_16_bit_interrupt_config_t * const it_config)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.it_config = *it_config;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_get_interrupt_flags(uint8_t id, timer_16_bit_interrupt_config_t * it_flags)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    *it_flags = timer_drivers_stub.timer_16_bit.flags;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_clear_interrupt_flags(uint8_t id, timer_16_bit_interrupt_config_t const * const it_flags)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    if (it_flags->it_timer_overflow)
+    {
+        timer_drivers_stub.timer_16_bit.flags.it_timer_overflow = false;
+    }
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_set_prescaler(uint8_t id, const timer_16_bit_prescaler_selection_t prescaler)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.prescaler = prescaler;
+    return TIMER_ERROR_OK;
+}
@@ -0,0 +1,158 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gtest/gtest.h"
+#include "pulse_counter.h"
+#include "pulse_counter_internal.h"
+#include "timer_drivers_stub.h"
+
+class PulseCounterFixture : public ::testing::Test
+{
+public:
+    pulse_counter_config_t config;
+protected:
+    void SetUp() override
+    {
+        timer_drivers_stub_reset();
+        config.timer_type = PULSE_COUNTER_TIMER_16_BIT;
+        config.timer_index = 0U;
+        config.edge = PULSE_COUNTER_EDGE_RISING;
+    }
+    void TearDown() override
+    {
+        (void) pulse_counter_deinit(0U);
+    }
+};
+
+TEST(pulse_counter_module_tests, guard_bad_parameters)
+{
+    uint32_t value = 0;
+    pulse_counter_config_t config = {PULSE_COUNTER_TIMER_8_BIT, 0U, PULSE_COUNTER_EDGE_RISING};
+    timer_drivers_stub_reset();
+
+    ASSERT_EQ(PULSE_COUNTER_ERROR_NULL_POINTER, pulse_counter_init(0U, NULL));
+    ASSERT_EQ(PULSE_COUNTER_ERROR_INVALID_INDEX, pulse_counter_init(PULSE_COUNTER_MAX_MODULES, &config));
+    ASSERT_EQ(PULSE_COUNTER_ERROR_UNINITIALISED, pulse_counter_get_count(0U, &value));
+    ASSERT_EQ(PULSE_COUNTER_ERROR_UNINITIALISED, pulse_counter_deinit(0U));
+
+    config.edge = (pulse_counter_edge_t) 3;
+    ASSERT_EQ(PULSE_COUNTER_ERROR_CONFIG, pulse_counter_init(0U, &config));
+    config.edge = PULSE_COUNTER_EDGE_FALLING;
+
+    timer_drivers_stub.next_error = TIMER_ERROR_UNKNOWN_TIMER;
+    ASSERT_EQ(PULSE_COUNTER_ERROR_TIMER_ERROR, pulse_counter_init(0U, &config));
+
+    ASSERT_EQ(PULSE_COUNTER_ERROR_OK, pulse_counter_init(0U, &config));
+    ASSERT_EQ(PULSE_COUNTER_ERROR_NULL_POINTER, pulse_counter_get_count(0U, NULL));
+    ASSERT_EQ(PULSE_COUNTER_ERROR_CONFIG, pulse_counter_get_rate(0U, 0U, &value));
+    ASSERT_EQ(PULSE_COUNTER_ERROR_OK, pulse_counter_deinit(0U));
+}
+
+TEST_F(PulseCounterFixture, test_timer_configuration)
+{
+    timer_drivers_stub.timer_8_bit.counter = 42U;
+    timer_drivers_stub.timer_8_bit.flags.it_timer_overflow = true;
+    timer_drivers_stub.timer_8_bit.it_config.it_comp_match_a = true;
+    config.timer_type = PULSE_COUNTER_TIMER_8_BIT;
+    config.edge = PULSE_COUNTER_EDGE_FALLING;
+    ASSERT_EQ(PULSE_COUNTER_ERROR_OK, pulse_counter_init(0U, &config));
+
+    /* Counter restarts from 0, clocked by the external pin, stale overflow is discarded and other interrupts are kept */
+    ASSERT_EQ(TIMER8BIT_WG_NORMAL, timer_drivers_stub.timer_8_bit.waveform);
+    ASSERT_EQ(TIMER8BIT_CLK_EXTERNAL_CLK_FALLING_EDGE, timer_drivers_stub.timer_8_bit.prescaler);
+    ASSERT_EQ(0U, timer_drivers_stub.timer_8_bit.counter);
+    ASSERT_FALSE(timer_drivers_stub.timer_8_bit.flags.it_timer_overflow);
+    ASSERT_TRUE(timer_drivers_stub.timer_8_bit.it_config.it_timer_overflow);
+    ASSERT_TRUE(timer_drivers_stub.timer_8_bit.it_config.it_comp_match_a);
+    ASSERT_EQ(256U, pulse_counter_internal_config[0].timer_period);
+
+    ASSERT_EQ(PULSE_COUNTER_ERROR_OK, pulse_counter_deinit(0U));
+    ASSERT_EQ(TIMER8BIT_CLK_NO_CLOCK, timer_drivers_stub.timer_8_bit.prescaler);
+
+    config.timer_type = PULSE_COUNTER_TIMER_16_BIT;
+    config.edge = PULSE_COUNTER_EDGE_RISING;
+    ASSERT_EQ(PULSE_COUNTER_ERROR_OK, pulse_counter_init(0U, &config));
+    ASSERT_EQ(TIMER16BIT_CLK_EXTERNAL_CLK_RISING_EDGE, timer_drivers_stub.timer_16_bit.prescaler);
+    ASSERT_TRUE(timer_drivers_stub.timer_16_bit.it_config.it_timer_overflow);
+    ASSERT_EQ(65536U, pulse_counter_internal_config[0].timer_period);
+}
+
+TEST_F(PulseCounterFixture, test_count_extended_with_overflows)
+{
+    uint32_t count = 0;
+    ASSERT_EQ(PULSE_COUNTER_ERROR_OK, pulse_counter_init(0U, &config));
+
+    timer_drivers_stub.timer_16_bit.counter = 1234U;
+    ASSERT_EQ(PULSE_COUNTER_ERROR_OK, pulse_counter_get_count(0U, &count));
+    ASSERT_EQ(1234U, count);
+
+    /* Two overflows handled by the ISR */
+    pulse_counter_overflow_callback(0U);
+    pulse_counter_overflow_callback(0U);
+    ASSERT_EQ(PULSE_COUNTER_ERROR_OK, pulse_counter_get_count(0U, &count));
+    ASSERT_EQ((2UL * 65536UL) + 1234U, count);
+
+    /* Counter wrapped but ISR did not run yet : pending overflow is accounted for */
+    timer_drivers_stub.timer_16_bit.counter = 3U;
+    timer_drivers_stub.timer_16_bit.flags.it_timer_overflow = true;
+    ASSERT_EQ(PULSE_COUNTER_ERROR_OK, pulse_counter_get_count(0U, &count));
+    ASSERT_EQ((3UL * 65536UL) + 3U, count);
+
+    /* Flag raised right after the counter was read : value still belongs to the previous period */
+    timer_drivers_stub.timer_16_bit.counter = 65535U;
+    ASSERT_EQ(PULSE_COUNTER_ERROR_OK, pulse_counter_get_count(0U, &count));
+    ASSERT_EQ((2UL * 65536UL) + 65535U, count);
+}
+
+TEST_F(PulseCounterFixture, test_rate_over_window)
+{
+    uint32_t rate = 0;
+    ASSERT_EQ(PULSE_COUNTER_ERROR_OK, pulse_counter_init(0U, &config));
+
+    /* 150 000 pulses counted over 250 ms */
+    for (uint8_t i = 0 ; i < 2U ; i++)
+    {
+        pulse_counter_overflow_callback(0U);
+    }
+    timer_drivers_stub.timer_16_bit.counter = (uint16_t)(150000UL - (2UL * 65536UL));
+    ASSERT_EQ(PULSE_COUNTER_ERROR_OK, pulse_counter_get_rate(0U, 250U, &rate));
+    ASSERT_EQ(600000U, rate);
+
+    /* Next window only accounts for the new pulses : 7 pulses in 3 ms */
+    timer_drivers_stub.timer_16_bit.counter += 7U;
+    ASSERT_EQ(PULSE_COUNTER_ERROR_OK, pulse_counter_get_rate(0U, 3U, &rate));
+    ASSERT_EQ(2333U, rate);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
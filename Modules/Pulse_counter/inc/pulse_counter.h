@@ -0,0 +1,149 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef PULSE_COUNTER_HEADER
+#define PULSE_COUNTER_HEADER
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Describes available error codes for this pulse counter module
+*/
+typedef enum
+{
+    PULSE_COUNTER_ERROR_OK,                 /**< No particular error                                                */
+    PULSE_COUNTER_ERROR_UNINITIALISED,      /**< Targeted pulse counter instance has not been initialised yet       */
+    PULSE_COUNTER_ERROR_NULL_POINTER,       /**< One or more parameters are not initialised properly                */
+    PULSE_COUNTER_ERROR_INVALID_INDEX,      /**< Index is not set correctly, probably out of bounds                 */
+    PULSE_COUNTER_ERROR_CONFIG,             /**< Given configuration is not well-formed                             */
+    PULSE_COUNTER_ERROR_TIMER_ERROR,        /**< Encountered an error while using underlying timer driver           */
+} pulse_counter_error_t;
+
+/**
+ * @brief Selects which kind of timer counts the pulses
+*/
+typedef enum
+{
+    PULSE_COUNTER_TIMER_8_BIT,      /**< 8 bit timer (e.g. Timer 0, pulses on T0 pin)   */
+    PULSE_COUNTER_TIMER_16_BIT,     /**< 16 bit timer (e.g. Timer 1, pulses on T1 pin)  */
+} pulse_counter_timer_t;
+
+/**
+ * @brief Selects which edge of the input signal is counted
+*/
+typedef enum
+{
+    PULSE_COUNTER_EDGE_RISING,      /**< Counts rising edges    */
+    PULSE_COUNTER_EDGE_FALLING,     /**< Counts falling edges   */
+} pulse_counter_edge_t;
+
+/**
+ * @brief Initialisation structure
+*/
+typedef struct
+{
+    pulse_counter_timer_t timer_type;   /**< Kind of the underlying timer                                                   */
+    uint8_t timer_index;                /**< Index of the underlying timer (as used by timer_8_bit or timer_16_bit drivers)  */
+    pulse_counter_edge_t edge;          /**< Counted edge                                                                   */
+} pulse_counter_config_t;
+
+/**
+ * @brief Initialises the pulse counter module using an id and a configuration.
+ * Underlying timer handle shall already be set : timer is switched to normal mode, clocked by the external pin, and its
+ * overflow interrupt is enabled. Counting starts right away.
+ * @param[in] id     :  index of pulse counter module to be initialised
+ * @param[in] config :  configuration to be used to initialise the targeted pulse counter module
+ * @return
+ *          PULSE_COUNTER_ERROR_OK              :   operation succeeded
+ *          PULSE_COUNTER_ERROR_NULL_POINTER    :   given parameter is uninitialised
+ *          PULSE_COUNTER_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          PULSE_COUNTER_ERROR_CONFIG          :   timer type or edge selection is unknown
+ *          PULSE_COUNTER_ERROR_TIMER_ERROR     :   underlying timer could not be configured
+*/
+pulse_counter_error_t pulse_counter_init(const uint8_t id, pulse_counter_config_t const * const config);
+
+/**
+ * @brief Deinitialises targeted pulse counter module : underlying timer is stopped and its overflow interrupt disabled
+ * @param[in] id    :   targeted pulse counter module index
+ * @return
+ *          PULSE_COUNTER_ERROR_OK              :   operation succeeded
+ *          PULSE_COUNTER_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          PULSE_COUNTER_ERROR_UNINITIALISED   :   cannot deinit a module which has not been initialised yet
+ *          PULSE_COUNTER_ERROR_TIMER_ERROR     :   underlying timer could not be stopped
+*/
+pulse_counter_error_t pulse_counter_deinit(const uint8_t id);
+
+/**
+ * @brief Reads a consistent snapshot of the pulses count, extended to 32 bits with the timer overflows.
+ * Can be called with interrupts enabled or disabled (a pending overflow is taken into account).
+ * @param[in]   id      : index of targeted pulse counter module
+ * @param[out]  count   : pulses counted since initialisation (wraps around after 2^32 pulses)
+ * @return
+ *          PULSE_COUNTER_ERROR_OK              :   operation succeeded
+ *          PULSE_COUNTER_ERROR_NULL_POINTER    :   given parameter is uninitialised
+ *          PULSE_COUNTER_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          PULSE_COUNTER_ERROR_UNINITIALISED   :   selected module has not been initialised
+ *          PULSE_COUNTER_ERROR_TIMER_ERROR     :   underlying timer could not be read
+*/
+pulse_counter_error_t pulse_counter_get_count(const uint8_t id, uint32_t * const count);
+
+/**
+ * @brief Computes the pulses rate over the window elapsed since the previous call (or since initialisation).
+ * Meant to be called periodically, e.g. every second using the timebase module to measure the window.
+ * @param[in]   id          : index of targeted pulse counter module
+ * @param[in]   window_ms   : duration of the window, in milliseconds
+ * @param[out]  rate        : pulses rate over the window, in pulses per second
+ * @return
+ *          PULSE_COUNTER_ERROR_OK              :   operation succeeded
+ *          PULSE_COUNTER_ERROR_NULL_POINTER    :   given parameter is uninitialised
+ *          PULSE_COUNTER_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          PULSE_COUNTER_ERROR_UNINITIALISED   :   selected module has not been initialised
+ *          PULSE_COUNTER_ERROR_CONFIG          :   window is null
+ *          PULSE_COUNTER_ERROR_TIMER_ERROR     :   underlying timer could not be read
+*/
+pulse_counter_error_t pulse_counter_get_rate(const uint8_t id, const uint32_t window_ms, uint32_t * const rate);
+
+/**
+ * @brief A callback to be used within the Timer overflow ISR (e.g. TIMER1_OVF_vect) which extends the count to 32 bits
+ * @param[in]  id : index of targeted pulse counter module
+*/
+void pulse_counter_overflow_callback(const uint8_t id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PULSE_COUNTER_HEADER */
@@ -0,0 +1,345 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "config.h"
+#include "pulse_counter.h"
+#include "pulse_counter_internal.h"
+
+#include "timer_generic.h"
+#include "timer_8_bit.h"
+#include "timer_16_bit.h"
+
+#define PULSE_COUNTER_MS_PER_SECOND (1000UL)
+
+pulse_counter_internal_config_t pulse_counter_internal_config[PULSE_COUNTER_MAX_MODULES] = {0};
+
+static inline bool is_index_valid(const uint8_t id)
+{
+    bool out = true;
+    if (id >= PULSE_COUNTER_MAX_MODULES)
+    {
+        out = false;
+    }
+    return out;
+}
+
+static void reset_internal_config(const uint8_t id)
+{
+    pulse_counter_internal_config[id].timer_type = PULSE_COUNTER_TIMER_8_BIT;
+    pulse_counter_internal_config[id].timer_id = 0;
+    pulse_counter_internal_config[id].timer_period = 0;
+    pulse_counter_internal_config[id].base = 0;
+    pulse_counter_internal_config[id].last_count = 0;
+    pulse_counter_internal_config[id].initialised = false;
+}
+
+static inline pulse_counter_error_t check_module(const uint8_t id)
+{
+    if (false == is_index_valid(id))
+    {
+        return PULSE_COUNTER_ERROR_INVALID_INDEX;
+    }
+
+    if (false == pulse_counter_internal_config[id].initialised)
+    {
+        return PULSE_COUNTER_ERROR_UNINITIALISED;
+    }
+    return PULSE_COUNTER_ERROR_OK;
+}
+
+/**
+ * @brief switches an 8 bit timer to normal mode, clocked by its Tn pin, with the overflow interrupt enabled.
+ * Counting starts when the external clock source is selected, so this is done last.
+*/
+static timer_error_t setup_timer_8_bit(const uint8_t timer_id, const pulse_counter_edge_t edge)
+{
+    timer_error_t err = timer_8_bit_set_waveform_generation(timer_id, TIMER8BIT_WG_NORMAL);
+    if (TIMER_ERROR_OK == err)
+    {
+        err = timer_8_bit_set_counter_value(timer_id, 0U);
+    }
+
+    /* Keep interrupts already used by the application untouched */
+    timer_8_bit_interrupt_config_t it_config = {0};
+    if (TIMER_ERROR_OK == err)
+    {
+        err = timer_8_bit_get_interrupt_config(timer_id, &it_config);
+    }
+
+    /* A stale overflow flag would add a whole period to the count */
+    if (TIMER_ERROR_OK == err)
+    {
+        timer_8_bit_interrupt_config_t flags = {0};
+        flags.it_timer_overflow = true;
+        err = timer_8_bit_clear_interrupt_flags(timer_id, &flags);
+    }
+
+    if (TIMER_ERROR_OK == err)
+    {
+        it_config.it_timer_overflow = true;
+        err = timer_8_bit_set_interrupt_config(timer_id, &it_config);
+    }
+
+    if (TIMER_ERROR_OK == err)
+    {
+        const timer_8_bit_prescaler_selection_t clock = (PULSE_COUNTER_EDGE_RISING == edge) ? TIMER8BIT_CLK_EXTERNAL_CLK_RISING_EDGE
+                                                                                            : TIMER8BIT_CLK_EXTERNAL_CLK_FALLING_EDGE;
+        err = timer_8_bit_set_prescaler(timer_id, clock);
+    }
+    return err;
+}
+
+/**
+ * @brief same as setup_timer_8_bit(), for 16 bit timers
+*/
+static timer_error_t setup_timer_16_bit(const uint8_t timer_id, const pulse_counter_edge_t edge)
+{
+    const uint16_t zero = 0U;
+    timer_error_t err = timer_16_bit_set_waveform_generation(timer_id, TIMER16BIT_WG_NORMAL);
+    if (TIMER_ERROR_OK == err)
+    {
+        err = timer_16_bit_set_counter_value(timer_id, &zero);
+    }
+
+    timer_16_bit_interrupt_config_t it_config = {0};
+    if (TIMER_ERROR_OK == err)
+    {
+        err = timer_16_bit_get_interrupt_config(timer_id, &it_config);
+    }
+
+    if (TIMER_ERROR_OK == err)
+    {
+        timer_16_bit_interrupt_config_t flags = {0};
+        flags.it_timer_overflow = true;
+        err = timer_16_bit_clear_interrupt_flags(timer_id, &flags);
+    }
+
+    if (TIMER_ERROR_OK == err)
+    {
+        it_config.it_timer_overflow = true;
+        err = timer_16_bit_set_interrupt_config(timer_id, &it_config);
+    }
+
+    if (TIMER_ERROR_OK == err)
+    {
+        const timer_16_bit_prescaler_selection_t clock = (PULSE_COUNTER_EDGE_RISING == edge) ? TIMER16BIT_CLK_EXTERNAL_CLK_RISING_EDGE
+                                                                                             : TIMER16BIT_CLK_EXTERNAL_CLK_FALLING_EDGE;
+        err = timer_16_bit_set_prescaler(timer_id, clock);
+    }
+    return err;
+}
+
+/**
+ * @brief reads the hardware counter along with its overflow flag.
+ * Flag is read after the counter : when it is set, the counter value may either belong to the previous period (high value,
+ * flag was raised in between both reads) or to the new one (low value, overflow ISR did not run yet).
+*/
+static timer_error_t read_hardware(const uint8_t id, uint32_t * const counter, bool * const overflow_pending)
+{
+    pulse_counter_internal_config_t * const module = &pulse_counter_internal_config[id];
+    timer_error_t err = TIMER_ERROR_OK;
+    if (PULSE_COUNTER_TIMER_8_BIT == module->timer_type)
+    {
+        uint8_t ticks = 0;
+        timer_8_bit_interrupt_config_t flags = {0};
+        err = timer_8_bit_get_counter_value(module->timer_id, &ticks);
+        if (TIMER_ERROR_OK == err)
+        {
+            err = timer_8_bit_get_interrupt_flags(module->timer_id, &flags);
+        }
+        *counter = ticks;
+        *overflow_pending = flags.it_timer_overflow;
+    }
+    else
+    {
+        uint16_t ticks = 0;
+        timer_16_bit_interrupt_config_t flags = {0};
+        err = timer_16_bit_get_counter_value(module->timer_id, &ticks);
+        if (TIMER_ERROR_OK == err)
+        {
+            err = timer_16_bit_get_interrupt_flags(module->timer_id, &flags);
+        }
+        *counter = ticks;
+        *overflow_pending = flags.it_timer_overflow;
+    }
+    return err;
+}
+
+pulse_counter_error_t pulse_counter_init(const uint8_t id, pulse_counter_config_t const * const config)
+{
+    if (false == is_index_valid(id))
+    {
+        return PULSE_COUNTER_ERROR_INVALID_INDEX;
+    }
+
+    if (NULL == config)
+    {
+        return PULSE_COUNTER_ERROR_NULL_POINTER;
+    }
+
+    if ((config->timer_type > PULSE_COUNTER_TIMER_16_BIT) || (config->edge > PULSE_COUNTER_EDGE_FALLING))
+    {
+        return PULSE_COUNTER_ERROR_CONFIG;
+    }
+
+    reset_internal_config(id);
+    pulse_counter_internal_config_t * const module = &pulse_counter_internal_config[id];
+    module->timer_type = config->timer_type;
+    module->timer_id = config->timer_index;
+
+    timer_error_t err = TIMER_ERROR_OK;
+    if (PULSE_COUNTER_TIMER_8_BIT == config->timer_type)
+    {
+        module->timer_period = TIMER_GENERIC_8_BIT_LIMIT_VALUE;
+        err = setup_timer_8_bit(module->timer_id, config->edge);
+    }
+    else
+    {
+        module->timer_period = TIMER_GENERIC_16_BIT_LIMIT_VALUE;
+        err = setup_timer_16_bit(module->timer_id, config->edge);
+    }
+
+    if (TIMER_ERROR_OK != err)
+    {
+        return PULSE_COUNTER_ERROR_TIMER_ERROR;
+    }
+
+    module->initialised = true;
+    return PULSE_COUNTER_ERROR_OK;
+}
+
+pulse_counter_error_t pulse_counter_deinit(const uint8_t id)
+{
+    pulse_counter_error_t ret = check_module(id);
+    if (PULSE_COUNTER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    /* Stopping the clock is enough : overflow interrupt cannot fire anymore, and the application might still use it */
+    pulse_counter_internal_config_t * const module = &pulse_counter_internal_config[id];
+    timer_error_t err = TIMER_ERROR_OK;
+    if (PULSE_COUNTER_TIMER_8_BIT == module->timer_type)
+    {
+        err = timer_8_bit_set_prescaler(module->timer_id, TIMER8BIT_CLK_NO_CLOCK);
+    }
+    else
+    {
+        err = timer_16_bit_set_prescaler(module->timer_id, TIMER16BIT_CLK_NO_CLOCK);
+    }
+
+    reset_internal_config(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return PULSE_COUNTER_ERROR_TIMER_ERROR;
+    }
+    return PULSE_COUNTER_ERROR_OK;
+}
+
+pulse_counter_error_t pulse_counter_get_count(const uint8_t id, uint32_t * const count)
+{
+    pulse_counter_error_t ret = check_module(id);
+    if (PULSE_COUNTER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == count)
+    {
+        return PULSE_COUNTER_ERROR_NULL_POINTER;
+    }
+
+    /* Overflow ISR may update the base while we read the hardware, in which case the snapshot is taken again */
+    pulse_counter_internal_config_t * const module = &pulse_counter_internal_config[id];
+    uint32_t base = 0;
+    uint32_t counter = 0;
+    bool overflow_pending = false;
+    do
+    {
+        base = module->base;
+        if (TIMER_ERROR_OK != read_hardware(id, &counter, &overflow_pending))
+        {
+            return PULSE_COUNTER_ERROR_TIMER_ERROR;
+        }
+    } while (base != module->base);
+
+    /* Overflow happened but was not accounted for yet (interrupts disabled, or ISR about to run) */
+    if (overflow_pending && (counter < (module->timer_period / 2U)))
+    {
+        base += module->timer_period;
+    }
+
+    *count = base + counter;
+    return PULSE_COUNTER_ERROR_OK;
+}
+
+pulse_counter_error_t pulse_counter_get_rate(const uint8_t id, const uint32_t window_ms, uint32_t * const rate)
+{
+    pulse_counter_error_t ret = check_module(id);
+    if (PULSE_COUNTER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == rate)
+    {
+        return PULSE_COUNTER_ERROR_NULL_POINTER;
+    }
+
+    if (0U == window_ms)
+    {
+        return PULSE_COUNTER_ERROR_CONFIG;
+    }
+
+    uint32_t count = 0;
+    ret = pulse_counter_get_count(id, &count);
+    if (PULSE_COUNTER_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    /* Unsigned arithmetic handles the 32 bits count roll over, split division avoids overflowing on high rates */
+    const uint32_t delta = count - pulse_counter_internal_config[id].last_count;
+    pulse_counter_internal_config[id].last_count = count;
+    *rate = ((delta / window_ms) * PULSE_COUNTER_MS_PER_SECOND)
+          + (((delta % window_ms) * PULSE_COUNTER_MS_PER_SECOND) / window_ms);
+    return PULSE_COUNTER_ERROR_OK;
+}
+
+void pulse_counter_overflow_callback(const uint8_t id)
+{
+    if (PULSE_COUNTER_ERROR_OK == check_module(id))
+    {
+        pulse_counter_internal_config[id].base += pulse_counter_internal_config[id].timer_period;
+    }
+}
@@ -0,0 +1,259 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "timer_drivers_stub.h"
+#include "string.h"
+
+timer_drivers_stub_t timer_drivers_stub = {0};
+
+static inline timer_error_t check_call(const uint8_t id)
+{
+    if (id >= TIMER_DRIVERS_STUB_MAX_INSTANCES)
+    {
+        return TIMER_ERROR_UNKNOWN_TIMER;
+    }
+    timer_error_t err = timer_drivers_stub.next_error;
+    timer_drivers_stub.next_error = TIMER_ERROR_OK;
+    return err;
+}
+
+void timer_drivers_stub_reset(void)
+{
+    memset(&timer_drivers_stub, 0, sizeof(timer_drivers_stub_t));
+}
+
+timer_error_t timer_8_bit_set_waveform_generation(uint8_t id, const timer_8_bit_waveform_generation_t waveform)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_8_bit.waveform = waveform;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_set_compare_match_A(uint8_t id, const timer_8_bit_compare_output_mode_t compA)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_8_bit.comp_match_a = compA;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_set_compare_match_B(uint8_t id, timer_8_bit_compare_output_mode_t compB)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_8_bit.comp_match_b = compB;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_set_ocra_register_value(uint8_t id, uint8_t ocra)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_8_bit.ocra = ocra;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_set_ocrb_register_value(uint8_t id, uint8_t ocrb)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_8_bit.ocrb = ocrb;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_get_interrupt_config(uint8_t id, timer_8_bit_interrupt_config_t * it_config)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    *it_config = timer_drivers_stub.timer_8_bit.it_config;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_set_interrupt_config(uint8_t id, timer_8_bit_interrupt_config_t * const it_config)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_8_bit.it_config = *it_config;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_begin_update(uint8_t id)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_8_bit.pending_updates++;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_8_bit_commit_update(uint8_t id)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_8_bit.pending_updates--;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_set_waveform_generation(uint8_t id, const timer_16_bit_waveform_generation_t waveform)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.waveform = waveform;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_set_compare_match_A(uint8_t id, const timer_16_bit_compare_output_mode_t compA)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.comp_match_a = compA;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_set_compare_match_B(uint8_t id, timer_16_bit_compare_output_mode_t compB)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.comp_match_b = compB;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_set_ocra_register_value(uint8_t id, const uint16_t * const ocra)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.ocra = *ocra;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_set_ocrb_register_value(uint8_t id, const uint16_t * const ocrb)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.ocrb = *ocrb;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_set_input_capture_value(uint8_t id, const uint16_t * const ticks)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.icr = *ticks;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_get_interrupt_config(uint8_t id, timer_16_bit_interrupt_config_t * it_config)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    *it_config = timer_drivers_stub.timer_16_bit.it_config;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_set_interrupt_config(uint8_t id, timer_16_bit_interrupt_config_t * const it_config)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.it_config = *it_config;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_begin_update(uint8_t id)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.pending_updates++;
+    return TIMER_ERROR_OK;
+}
+
+timer_error_t timer_16_bit_commit_update(uint8_t id)
+{
+    timer_error_t err = check_call(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return err;
+    }
+    timer_drivers_stub.timer_16_bit.pending_updates--;
+    return TIMER_ERROR_OK;
+}
@@ -0,0 +1,142 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gtest/gtest.h"
+#include "pwm_adc_sync.h"
+#include "pwm_adc_sync_internal.h"
+#include "timer_drivers_stub.h"
+
+class PwmAdcSyncFixture : public ::testing::Test
+{
+public:
+    pwm_adc_sync_config_t config;
+protected:
+    void SetUp() override
+    {
+        timer_drivers_stub_reset();
+        config.timer_type = PWM_ADC_SYNC_TIMER_16_BIT;
+        config.timer_index = 0U;
+        config.top = 800U;
+        config.inverted = false;
+        config.lead = 4U;
+    }
+    void TearDown() override
+    {
+        (void) pwm_adc_sync_deinit(0U);
+    }
+};
+
+TEST(pwm_adc_sync_module_tests, guard_bad_parameters)
+{
+    adc_autotrigger_sources_t source = ADC_TRIGGER_FREE_RUNNING;
+    pwm_adc_sync_config_t config = {PWM_ADC_SYNC_TIMER_16_BIT, 0U, 2U, false, 0U};
+    timer_drivers_stub_reset();
+
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_NULL_POINTER, pwm_adc_sync_init(0U, NULL));
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_INVALID_INDEX, pwm_adc_sync_init(PWM_ADC_SYNC_MAX_MODULES, &config));
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_UNINITIALISED, pwm_adc_sync_set_duty(0U, 0U));
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_UNINITIALISED, pwm_adc_sync_get_trigger_source(0U, &source));
+
+    /* TOP too small to fit both a PWM and a trigger */
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_CONFIG, pwm_adc_sync_init(0U, &config));
+    config.top = 100U;
+
+    timer_drivers_stub.next_error = TIMER_ERROR_NOT_INITIALISED;
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_TIMER_ERROR, pwm_adc_sync_init(0U, &config));
+
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_OK, pwm_adc_sync_init(0U, &config));
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_CONFIG, pwm_adc_sync_set_duty(0U, 101U));
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_NULL_POINTER, pwm_adc_sync_get_trigger_source(0U, NULL));
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_OK, pwm_adc_sync_deinit(0U));
+}
+
+TEST_F(PwmAdcSyncFixture, test_16_bit_timer_centred_trigger)
+{
+    adc_autotrigger_sources_t source = ADC_TRIGGER_FREE_RUNNING;
+    timer_drivers_stub.timer_16_bit.it_config.it_timer_overflow = true;
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_OK, pwm_adc_sync_init(0U, &config));
+
+    /* Phase correct PWM on OC1A, TOP in ICR1, compare unit B triggers the ADC. Other interrupts are kept */
+    ASSERT_EQ(TIMER16BIT_WG_PWM_PHASE_CORRECT_ICR_MAX, timer_drivers_stub.timer_16_bit.waveform);
+    ASSERT_EQ(800U, timer_drivers_stub.timer_16_bit.icr);
+    ASSERT_EQ(TIMER16BIT_CMOD_CLEAR_OCnX, timer_drivers_stub.timer_16_bit.comp_match_a);
+    ASSERT_EQ(TIMER16BIT_CMOD_NORMAL, timer_drivers_stub.timer_16_bit.comp_match_b);
+    ASSERT_TRUE(timer_drivers_stub.timer_16_bit.it_config.it_comp_match_b);
+    ASSERT_TRUE(timer_drivers_stub.timer_16_bit.it_config.it_timer_overflow);
+    ASSERT_EQ(0U, timer_drivers_stub.timer_16_bit.pending_updates);
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_OK, pwm_adc_sync_get_trigger_source(0U, &source));
+    ASSERT_EQ(ADC_TRIGGER_TIMER1_COMP_B_INT, source);
+
+    /* On-time is centred on BOTTOM, trigger leads it by 4 ticks */
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_OK, pwm_adc_sync_set_duty(0U, 300U));
+    ASSERT_EQ(300U, timer_drivers_stub.timer_16_bit.ocra);
+    ASSERT_EQ(4U, timer_drivers_stub.timer_16_bit.ocrb);
+
+    /* Trigger never leaves the on-time when duty cycle shrinks */
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_OK, pwm_adc_sync_set_duty(0U, 3U));
+    ASSERT_EQ(3U, timer_drivers_stub.timer_16_bit.ocra);
+    ASSERT_EQ(2U, timer_drivers_stub.timer_16_bit.ocrb);
+
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_OK, pwm_adc_sync_deinit(0U));
+    ASSERT_EQ(TIMER16BIT_CMOD_NORMAL, timer_drivers_stub.timer_16_bit.comp_match_a);
+    ASSERT_FALSE(timer_drivers_stub.timer_16_bit.it_config.it_comp_match_b);
+    ASSERT_TRUE(timer_drivers_stub.timer_16_bit.it_config.it_timer_overflow);
+}
+
+TEST_F(PwmAdcSyncFixture, test_8_bit_timer_inverted_output)
+{
+    adc_autotrigger_sources_t source = ADC_TRIGGER_FREE_RUNNING;
+    config.timer_type = PWM_ADC_SYNC_TIMER_8_BIT;
+    config.inverted = true;
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_OK, pwm_adc_sync_init(0U, &config));
+
+    /* Phase correct PWM on OC0B, compare unit A triggers the ADC */
+    ASSERT_EQ(TIMER8BIT_WG_PWM_PHASE_CORRECT_FULL_RANGE, timer_drivers_stub.timer_8_bit.waveform);
+    ASSERT_EQ(TIMER8BIT_CMOD_SET_OCnX, timer_drivers_stub.timer_8_bit.comp_match_b);
+    ASSERT_EQ(TIMER8BIT_CMOD_NORMAL, timer_drivers_stub.timer_8_bit.comp_match_a);
+    ASSERT_TRUE(timer_drivers_stub.timer_8_bit.it_config.it_comp_match_a);
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_OK, pwm_adc_sync_get_trigger_source(0U, &source));
+    ASSERT_EQ(ADC_TRIGGER_TIMER0_COMP_A_INT, source);
+
+    /* Output is off with a null duty cycle : output is only set when counting above 0xFF */
+    ASSERT_EQ(0xFFU, timer_drivers_stub.timer_8_bit.ocrb);
+
+    /* Inverted on-time is centred on TOP */
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_OK, pwm_adc_sync_set_duty(0U, 100U));
+    ASSERT_EQ(155U, timer_drivers_stub.timer_8_bit.ocrb);
+    ASSERT_EQ(251U, timer_drivers_stub.timer_8_bit.ocra);
+    ASSERT_EQ(PWM_ADC_SYNC_ERROR_CONFIG, pwm_adc_sync_set_duty(0U, 256U));
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
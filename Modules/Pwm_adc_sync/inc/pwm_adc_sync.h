@@ -0,0 +1,140 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef PWM_ADC_SYNC_HEADER
+#define PWM_ADC_SYNC_HEADER
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "adc_reg.h"
+
+/**
+ * @brief Describes available error codes for this pwm adc synchronisation module
+*/
+typedef enum
+{
+    PWM_ADC_SYNC_ERROR_OK,                  /**< No particular error                                                */
+    PWM_ADC_SYNC_ERROR_UNINITIALISED,       /**< Targeted instance has not been initialised yet                     */
+    PWM_ADC_SYNC_ERROR_NULL_POINTER,        /**< One or more parameters are not initialised properly                */
+    PWM_ADC_SYNC_ERROR_INVALID_INDEX,       /**< Index is not set correctly, probably out of bounds                 */
+    PWM_ADC_SYNC_ERROR_CONFIG,              /**< Given configuration is not well-formed                             */
+    PWM_ADC_SYNC_ERROR_TIMER_ERROR,         /**< Encountered an error while using underlying timer driver           */
+} pwm_adc_sync_error_t;
+
+/**
+ * @brief Selects the timer which generates the PWM and triggers the ADC.
+ * Only two compare units are wired to the ADC trigger logic : Timer 0 compare match A and Timer 1 compare match B.
+*/
+typedef enum
+{
+    PWM_ADC_SYNC_TIMER_8_BIT,       /**< Timer 0 : PWM on OC0B, ADC triggered by compare match A, TOP is 0xFF     */
+    PWM_ADC_SYNC_TIMER_16_BIT,      /**< Timer 1 : PWM on OC1A, ADC triggered by compare match B, TOP is ICR1     */
+} pwm_adc_sync_timer_t;
+
+/**
+ * @brief Initialisation structure
+*/
+typedef struct
+{
+    pwm_adc_sync_timer_t timer_type;    /**< Kind of the underlying timer                                                       */
+    uint8_t timer_index;                /**< Index of the underlying timer (as used by timer_8_bit or timer_16_bit drivers)      */
+    uint16_t top;                       /**< TOP value of the PWM (16 bit timer only, written into ICR). Ignored for 8 bit timer */
+    bool inverted;                      /**< Output is active when counter is above compare value : on-time is centred on TOP
+                                             instead of BOTTOM                                                                  */
+    uint16_t lead;                      /**< Trigger is placed this number of ticks ahead of the on-time centre, which
+                                             compensates for the ADC sample and hold delay. Use 0 to trigger at the exact centre */
+} pwm_adc_sync_config_t;
+
+/**
+ * @brief Initialises the module using an id and a configuration.
+ * Underlying timer shall already be initialised and is switched to phase correct PWM with a null duty cycle : on-time is
+ * then centred on BOTTOM (or TOP when inverted) whatever the duty cycle, and one compare unit is used to trigger the ADC
+ * at this point. The compare match interrupt of the trigger unit is enabled, as its flag has to be cleared for the next
+ * trigger to happen : application shall provide the matching ISR (an empty one is enough, e.g. EMPTY_INTERRUPT(TIMER1_COMPB_vect)).
+ * ADC shall be configured in auto triggered mode with the source given by pwm_adc_sync_get_trigger_source().
+ * @param[in] id     :  index of module to be initialised
+ * @param[in] config :  configuration to be used to initialise the targeted module
+ * @return
+ *          PWM_ADC_SYNC_ERROR_OK              :   operation succeeded
+ *          PWM_ADC_SYNC_ERROR_NULL_POINTER    :   given parameter is uninitialised
+ *          PWM_ADC_SYNC_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          PWM_ADC_SYNC_ERROR_CONFIG          :   timer type is unknown or TOP value is too small
+ *          PWM_ADC_SYNC_ERROR_TIMER_ERROR     :   underlying timer could not be configured
+*/
+pwm_adc_sync_error_t pwm_adc_sync_init(const uint8_t id, pwm_adc_sync_config_t const * const config);
+
+/**
+ * @brief Deinitialises targeted module : PWM output is disconnected and trigger interrupt disabled
+ * @param[in] id    :   targeted module index
+ * @return
+ *          PWM_ADC_SYNC_ERROR_OK              :   operation succeeded
+ *          PWM_ADC_SYNC_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          PWM_ADC_SYNC_ERROR_UNINITIALISED   :   cannot deinit a module which has not been initialised yet
+ *          PWM_ADC_SYNC_ERROR_TIMER_ERROR     :   underlying timer could not be configured
+*/
+pwm_adc_sync_error_t pwm_adc_sync_deinit(const uint8_t id);
+
+/**
+ * @brief Sets the PWM duty cycle and moves the ADC trigger accordingly, so that sampling still happens in the middle of
+ * the on-time. Both compare registers are double buffered and updated at TOP, so they always change together.
+ * @param[in] id    :   targeted module index
+ * @param[in] duty  :   duty cycle, from 0 (always off) to TOP (always on)
+ * @return
+ *          PWM_ADC_SYNC_ERROR_OK              :   operation succeeded
+ *          PWM_ADC_SYNC_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          PWM_ADC_SYNC_ERROR_UNINITIALISED   :   selected module has not been initialised
+ *          PWM_ADC_SYNC_ERROR_CONFIG          :   duty cycle exceeds TOP value
+ *          PWM_ADC_SYNC_ERROR_TIMER_ERROR     :   underlying timer could not be written
+*/
+pwm_adc_sync_error_t pwm_adc_sync_set_duty(const uint8_t id, const uint16_t duty);
+
+/**
+ * @brief Gives the ADC auto trigger source matching the timer used by the module
+ * @param[in]   id      :   targeted module index
+ * @param[out]  source  :   ADC trigger source to be used in ADC configuration
+ * @return
+ *          PWM_ADC_SYNC_ERROR_OK              :   operation succeeded
+ *          PWM_ADC_SYNC_ERROR_NULL_POINTER    :   given parameter is uninitialised
+ *          PWM_ADC_SYNC_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          PWM_ADC_SYNC_ERROR_UNINITIALISED   :   selected module has not been initialised
+*/
+pwm_adc_sync_error_t pwm_adc_sync_get_trigger_source(const uint8_t id, adc_autotrigger_sources_t * const source);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PWM_ADC_SYNC_HEADER */
@@ -0,0 +1,326 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "config.h"
+#include "pwm_adc_sync.h"
+#include "pwm_adc_sync_internal.h"
+
+#include "timer_8_bit.h"
+#include "timer_16_bit.h"
+
+#define PWM_ADC_SYNC_8_BIT_TOP      (0xFFU)
+#define PWM_ADC_SYNC_MIN_TOP        (3U)
+
+pwm_adc_sync_internal_config_t pwm_adc_sync_internal_config[PWM_ADC_SYNC_MAX_MODULES] = {0};
+
+static inline bool is_index_valid(const uint8_t id)
+{
+    bool out = true;
+    if (id >= PWM_ADC_SYNC_MAX_MODULES)
+    {
+        out = false;
+    }
+    return out;
+}
+
+static void reset_internal_config(const uint8_t id)
+{
+    pwm_adc_sync_internal_config[id].timer_type = PWM_ADC_SYNC_TIMER_8_BIT;
+    pwm_adc_sync_internal_config[id].timer_id = 0;
+    pwm_adc_sync_internal_config[id].top = 0;
+    pwm_adc_sync_internal_config[id].lead = 0;
+    pwm_adc_sync_internal_config[id].inverted = false;
+    pwm_adc_sync_internal_config[id].initialised = false;
+}
+
+static inline pwm_adc_sync_error_t check_module(const uint8_t id)
+{
+    if (false == is_index_valid(id))
+    {
+        return PWM_ADC_SYNC_ERROR_INVALID_INDEX;
+    }
+
+    if (false == pwm_adc_sync_internal_config[id].initialised)
+    {
+        return PWM_ADC_SYNC_ERROR_UNINITIALISED;
+    }
+    return PWM_ADC_SYNC_ERROR_OK;
+}
+
+/**
+ * @brief computes the PWM compare value from the duty cycle.
+ * Non inverted output is cleared when counting up past the compare value : output is active while counter < compare.
+ * Inverted output is set instead : output is active while counter > compare.
+*/
+static inline uint16_t compute_pwm_compare(pwm_adc_sync_internal_config_t const * const module, const uint16_t duty)
+{
+    return module->inverted ? (module->top - duty) : duty;
+}
+
+/**
+ * @brief computes the trigger compare value.
+ * In phase correct mode the on-time is symmetric around BOTTOM (or TOP when inverted), whatever the duty cycle.
+ * Trigger is placed 'lead' ticks before this centre, on the slope which leads to it, but never outside of the on-time.
+ * The same compare value matches again on the opposite slope, while the conversion is still ongoing : this second
+ * trigger is ignored by the ADC as long as 2 x lead ticks are shorter than a conversion.
+*/
+static inline uint16_t compute_trigger_compare(pwm_adc_sync_internal_config_t const * const module, const uint16_t duty)
+{
+    uint16_t offset = module->lead;
+    if (0U == duty)
+    {
+        offset = 0U;
+    }
+    else if (offset >= duty)
+    {
+        offset = duty - 1U;
+    }
+    return module->inverted ? (module->top - offset) : offset;
+}
+
+static timer_error_t write_compare_values_8_bit(pwm_adc_sync_internal_config_t const * const module, const uint16_t duty)
+{
+    timer_error_t err = timer_8_bit_set_ocrb_register_value(module->timer_id, (uint8_t) compute_pwm_compare(module, duty));
+    if (TIMER_ERROR_OK == err)
+    {
+        err = timer_8_bit_set_ocra_register_value(module->timer_id, (uint8_t) compute_trigger_compare(module, duty));
+    }
+    return err;
+}
+
+static timer_error_t write_compare_values_16_bit(pwm_adc_sync_internal_config_t const * const module, const uint16_t duty)
+{
+    const uint16_t pwm = compute_pwm_compare(module, duty);
+    const uint16_t trigger = compute_trigger_compare(module, duty);
+    timer_error_t err = timer_16_bit_set_ocra_register_value(module->timer_id, &pwm);
+    if (TIMER_ERROR_OK == err)
+    {
+        err = timer_16_bit_set_ocrb_register_value(module->timer_id, &trigger);
+    }
+    return err;
+}
+
+/**
+ * @brief Timer 0 : phase correct PWM with TOP = 0xFF, PWM on OC0B, compare unit A triggers the ADC.
+ * Control registers are written in one go using a batched update.
+*/
+static timer_error_t setup_timer_8_bit(pwm_adc_sync_internal_config_t const * const module)
+{
+    timer_8_bit_interrupt_config_t it_config = {0};
+    timer_error_t err = timer_8_bit_get_interrupt_config(module->timer_id, &it_config);
+    if (TIMER_ERROR_OK == err)
+    {
+        err = write_compare_values_8_bit(module, 0U);
+    }
+    if (TIMER_ERROR_OK == err)
+    {
+        err = timer_8_bit_begin_update(module->timer_id);
+    }
+    if (TIMER_ERROR_OK == err)
+    {
+        (void) timer_8_bit_set_waveform_generation(module->timer_id, TIMER8BIT_WG_PWM_PHASE_CORRECT_FULL_RANGE);
+        (void) timer_8_bit_set_compare_match_A(module->timer_id, TIMER8BIT_CMOD_NORMAL);
+        (void) timer_8_bit_set_compare_match_B(module->timer_id, module->inverted ? TIMER8BIT_CMOD_SET_OCnX : TIMER8BIT_CMOD_CLEAR_OCnX);
+        it_config.it_comp_match_a = true;
+        (void) timer_8_bit_set_interrupt_config(module->timer_id, &it_config);
+        err = timer_8_bit_commit_update(module->timer_id);
+    }
+    return err;
+}
+
+/**
+ * @brief Timer 1 : phase correct PWM with TOP = ICR1, PWM on OC1A, compare unit B triggers the ADC
+*/
+static timer_error_t setup_timer_16_bit(pwm_adc_sync_internal_config_t const * const module)
+{
+    timer_16_bit_interrupt_config_t it_config = {0};
+    timer_error_t err = timer_16_bit_get_interrupt_config(module->timer_id, &it_config);
+    if (TIMER_ERROR_OK == err)
+    {
+        err = timer_16_bit_set_input_capture_value(module->timer_id, &module->top);
+    }
+    if (TIMER_ERROR_OK == err)
+    {
+        err = write_compare_values_16_bit(module, 0U);
+    }
+    if (TIMER_ERROR_OK == err)
+    {
+        err = timer_16_bit_begin_update(module->timer_id);
+    }
+    if (TIMER_ERROR_OK == err)
+    {
+        (void) timer_16_bit_set_waveform_generation(module->timer_id, TIMER16BIT_WG_PWM_PHASE_CORRECT_ICR_MAX);
+        (void) timer_16_bit_set_compare_match_A(module->timer_id, module->inverted ? TIMER16BIT_CMOD_SET_OCnX : TIMER16BIT_CMOD_CLEAR_OCnX);
+        (void) timer_16_bit_set_compare_match_B(module->timer_id, TIMER16BIT_CMOD_NORMAL);
+        it_config.it_comp_match_b = true;
+        (void) timer_16_bit_set_interrupt_config(module->timer_id, &it_config);
+        err = timer_16_bit_commit_update(module->timer_id);
+    }
+    return err;
+}
+
+pwm_adc_sync_error_t pwm_adc_sync_init(const uint8_t id, pwm_adc_sync_config_t const * const config)
+{
+    if (false == is_index_valid(id))
+    {
+        return PWM_ADC_SYNC_ERROR_INVALID_INDEX;
+    }
+
+    if (NULL == config)
+    {
+        return PWM_ADC_SYNC_ERROR_NULL_POINTER;
+    }
+
+    if ((config->timer_type > PWM_ADC_SYNC_TIMER_16_BIT)
+    || ((PWM_ADC_SYNC_TIMER_16_BIT == config->timer_type) && (config->top < PWM_ADC_SYNC_MIN_TOP)))
+    {
+        return PWM_ADC_SYNC_ERROR_CONFIG;
+    }
+
+    reset_internal_config(id);
+    pwm_adc_sync_internal_config_t * const module = &pwm_adc_sync_internal_config[id];
+    module->timer_type = config->timer_type;
+    module->timer_id = config->timer_index;
+    module->lead = config->lead;
+    module->inverted = config->inverted;
+
+    timer_error_t err = TIMER_ERROR_OK;
+    if (PWM_ADC_SYNC_TIMER_8_BIT == config->timer_type)
+    {
+        module->top = PWM_ADC_SYNC_8_BIT_TOP;
+        err = setup_timer_8_bit(module);
+    }
+    else
+    {
+        module->top = config->top;
+        err = setup_timer_16_bit(module);
+    }
+
+    if (TIMER_ERROR_OK != err)
+    {
+        return PWM_ADC_SYNC_ERROR_TIMER_ERROR;
+    }
+
+    module->initialised = true;
+    return PWM_ADC_SYNC_ERROR_OK;
+}
+
+pwm_adc_sync_error_t pwm_adc_sync_deinit(const uint8_t id)
+{
+    pwm_adc_sync_error_t ret = check_module(id);
+    if (PWM_ADC_SYNC_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    pwm_adc_sync_internal_config_t * const module = &pwm_adc_sync_internal_config[id];
+    timer_error_t err = TIMER_ERROR_OK;
+    if (PWM_ADC_SYNC_TIMER_8_BIT == module->timer_type)
+    {
+        timer_8_bit_interrupt_config_t it_config = {0};
+        err = timer_8_bit_get_interrupt_config(module->timer_id, &it_config);
+        if (TIMER_ERROR_OK == err)
+        {
+            it_config.it_comp_match_a = false;
+            (void) timer_8_bit_set_interrupt_config(module->timer_id, &it_config);
+            err = timer_8_bit_set_compare_match_B(module->timer_id, TIMER8BIT_CMOD_NORMAL);
+        }
+    }
+    else
+    {
+        timer_16_bit_interrupt_config_t it_config = {0};
+        err = timer_16_bit_get_interrupt_config(module->timer_id, &it_config);
+        if (TIMER_ERROR_OK == err)
+        {
+            it_config.it_comp_match_b = false;
+            (void) timer_16_bit_set_interrupt_config(module->timer_id, &it_config);
+            err = timer_16_bit_set_compare_match_A(module->timer_id, TIMER16BIT_CMOD_NORMAL);
+        }
+    }
+
+    reset_internal_config(id);
+    if (TIMER_ERROR_OK != err)
+    {
+        return PWM_ADC_SYNC_ERROR_TIMER_ERROR;
+    }
+    return PWM_ADC_SYNC_ERROR_OK;
+}
+
+pwm_adc_sync_error_t pwm_adc_sync_set_duty(const uint8_t id, const uint16_t duty)
+{
+    pwm_adc_sync_error_t ret = check_module(id);
+    if (PWM_ADC_SYNC_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    pwm_adc_sync_internal_config_t * const module = &pwm_adc_sync_internal_config[id];
+    if (duty > module->top)
+    {
+        return PWM_ADC_SYNC_ERROR_CONFIG;
+    }
+
+    timer_error_t err = TIMER_ERROR_OK;
+    if (PWM_ADC_SYNC_TIMER_8_BIT == module->timer_type)
+    {
+        err = write_compare_values_8_bit(module, duty);
+    }
+    else
+    {
+        err = write_compare_values_16_bit(module, duty);
+    }
+
+    if (TIMER_ERROR_OK != err)
+    {
+        return PWM_ADC_SYNC_ERROR_TIMER_ERROR;
+    }
+    return PWM_ADC_SYNC_ERROR_OK;
+}
+
+pwm_adc_sync_error_t pwm_adc_sync_get_trigger_source(const uint8_t id, adc_autotrigger_sources_t * const source)
+{
+    pwm_adc_sync_error_t ret = check_module(id);
+    if (PWM_ADC_SYNC_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL == source)
+    {
+        return PWM_ADC_SYNC_ERROR_NULL_POINTER;
+    }
+
+    *source = (PWM_ADC_SYNC_TIMER_8_BIT == pwm_adc_sync_internal_config[id].timer_type) ? ADC_TRIGGER_TIMER0_COMP_A_INT
+                                                                                        : ADC_TRIGGER_TIMER1_COMP_B_INT;
+    return PWM_ADC_SYNC_ERROR_OK;
+}
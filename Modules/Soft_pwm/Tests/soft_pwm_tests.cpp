@@ -0,0 +1,284 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "gtest/gtest.h"
+
+#include "config.h"
+#include "io.h"
+#include "soft_pwm.h"
+#include "soft_pwm_internal.h"
+#include "timer_8_bit.h"
+#include "timer_8_bit_model.h"
+
+/* Stubbed ports registers, io driver symbols are provided by application code */
+static volatile uint8_t ports[IO_PORT_COUNT][3] = {0};
+static volatile uint8_t compare_reg = 0;
+static volatile uint8_t mcucr = 0;
+
+io_config_t io_config =
+{
+    &mcucr,
+    {&ports[0][0], &ports[0][1], &ports[0][2]},
+    {&ports[1][0], &ports[1][1], &ports[1][2]},
+    {&ports[2][0], &ports[2][1], &ports[2][2]},
+    {&ports[3][0], &ports[3][1], &ports[3][2]},
+};
+
+io_t io_pins_lut[IO_MAX_PINS] =
+{
+    {IO_STATE_LOW, 0U, IO_PORT_B, IO_OUT_PUSH_PULL},
+    {IO_STATE_LOW, 1U, IO_PORT_B, IO_OUT_PUSH_PULL},
+    {IO_STATE_LOW, 5U, IO_PORT_D, IO_OUT_PUSH_PULL},
+    {IO_STATE_LOW, 6U, IO_PORT_D, IO_OUT_PUSH_PULL},
+};
+
+class SoftPwmFixture : public ::testing::Test
+{
+public:
+    void SetUp(void) override
+    {
+        memset((void*) ports, 0, sizeof(ports));
+        memset(soft_pwm_internal_config, 0, sizeof(soft_pwm_internal_config));
+        compare_reg = 0U;
+
+        config.compare_reg = &compare_reg;
+        config.period = 100U;
+        config.prescaler = 64U;
+        config.channels_count = 4U;
+        for (uint8_t i = 0 ; i < 4U ; i++)
+        {
+            config.channels[i] = i;
+        }
+        ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_init(0U, &config));
+    }
+
+    void TearDown(void) override
+    {
+
+    }
+
+    /* Runs interrupts over one full period and measures each channel high time, in ticks */
+    void run_period(uint16_t high_time[4])
+    {
+        const uint8_t port[4] = {IO_PORT_B, IO_PORT_B, IO_PORT_D, IO_PORT_D};
+        const uint8_t pin[4] = {0U, 1U, 5U, 6U};
+        uint16_t elapsed = 0;
+        memset(high_time, 0, 4U * sizeof(uint16_t));
+        do
+        {
+            soft_pwm_interrupt_callback(0U);
+            const uint16_t delta = compare_reg + 1U;
+            for (uint8_t i = 0 ; i < 4U ; i++)
+            {
+                if (0U != (ports[port[i]][0] & (1U << pin[i])))
+                {
+                    high_time[i] += delta;
+                }
+            }
+            elapsed += delta;
+        } while (0U != soft_pwm_internal_config[0U].current);
+        ASSERT_EQ(config.period, elapsed);
+    }
+
+    soft_pwm_config_t config;
+};
+
+TEST(soft_pwm_module_tests, test_guard_wrong_parameters)
+{
+    soft_pwm_config_t config = {};
+    volatile uint8_t reg = 0;
+    ASSERT_EQ(SOFT_PWM_ERROR_INVALID_INDEX, soft_pwm_init(SOFT_PWM_MAX_MODULES, &config));
+    ASSERT_EQ(SOFT_PWM_ERROR_NULL_POINTER, soft_pwm_init(0U, NULL));
+    ASSERT_EQ(SOFT_PWM_ERROR_NULL_POINTER, soft_pwm_init(0U, &config));
+
+    config.compare_reg = &reg;
+    config.period = 100U;
+    config.prescaler = 64U;
+    ASSERT_EQ(SOFT_PWM_ERROR_CONFIG, soft_pwm_init(0U, &config));
+    config.channels_count = 1U;
+    config.channels[0] = IO_MAX_PINS;
+    ASSERT_EQ(SOFT_PWM_ERROR_CONFIG, soft_pwm_init(0U, &config));
+
+    /* Interrupt routine cannot keep up with a timer ticking every CPU cycle over such a short period */
+    config.channels[0] = 0U;
+    config.prescaler = 0U;
+    ASSERT_EQ(SOFT_PWM_ERROR_CONFIG, soft_pwm_init(0U, &config));
+    config.prescaler = 1U;
+    ASSERT_EQ(SOFT_PWM_ERROR_CONFIG, soft_pwm_init(0U, &config));
+
+    ASSERT_EQ(SOFT_PWM_ERROR_UNINITIALISED, soft_pwm_set_duty(0U, 0U, 10U));
+    ASSERT_EQ(SOFT_PWM_ERROR_UNINITIALISED, soft_pwm_commit(0U));
+    ASSERT_EQ(SOFT_PWM_ERROR_UNINITIALISED, soft_pwm_deinit(0U));
+}
+
+TEST_F(SoftPwmFixture, test_duty_cycles)
+{
+    uint16_t high_time[4];
+
+    /* Nothing changes until new duty cycles are committed, and they are applied from next period on */
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_set_duty(0U, 0U, 25U));
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_set_duty(0U, 1U, 60U));
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_set_duty(0U, 2U, 25U));
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_set_duty(0U, 3U, 100U));
+    run_period(high_time);
+    for (uint8_t i = 0 ; i < 4U ; i++)
+    {
+        ASSERT_EQ(0U, high_time[i]);
+    }
+
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_commit(0U));
+    run_period(high_time);
+    ASSERT_EQ(25U, high_time[0]);
+    ASSERT_EQ(60U, high_time[1]);
+    ASSERT_EQ(25U, high_time[2]);
+    ASSERT_EQ(100U, high_time[3]);
+
+    /* Channels sharing the same edge are merged : period start, 25 and 60 ticks edges */
+    ASSERT_EQ(3U, soft_pwm_internal_config[0U].tables[soft_pwm_internal_config[0U].active].count);
+
+    ASSERT_EQ(SOFT_PWM_ERROR_CONFIG, soft_pwm_set_duty(0U, 0U, 101U));
+    ASSERT_EQ(SOFT_PWM_ERROR_INVALID_INDEX, soft_pwm_set_duty(0U, 4U, 10U));
+}
+
+TEST_F(SoftPwmFixture, test_close_edges_are_rounded)
+{
+    uint16_t high_time[4];
+
+    /* Edges closer than ceil(SOFT_PWM_ISR_CYCLES / prescaler) + 2 ticks are merged with the previous one */
+    const uint8_t min_ticks = (uint8_t)((SOFT_PWM_ISR_CYCLES + 63U) / 64U) + 2U;
+    ASSERT_EQ(min_ticks, soft_pwm_internal_config[0U].min_ticks);
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_set_duty(0U, 0U, 1U));
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_set_duty(0U, 1U, 40U));
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_set_duty(0U, 2U, 41U));
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_set_duty(0U, 3U, 99U));
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_commit(0U));
+    run_period(high_time);
+    run_period(high_time);
+    ASSERT_EQ(0U, high_time[0]);
+    ASSERT_EQ(40U, high_time[1]);
+    ASSERT_EQ(40U, high_time[2]);
+    ASSERT_EQ(100U - min_ticks, high_time[3]);
+}
+
+TEST_F(SoftPwmFixture, test_min_ticks_follow_prescaler)
+{
+    uint16_t high_time[4];
+
+    /* A faster timer needs a wider gap between edges */
+    config.prescaler = 8U;
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_init(0U, &config));
+    const uint8_t min_ticks = (uint8_t)((SOFT_PWM_ISR_CYCLES + 7U) / 8U) + 2U;
+    ASSERT_EQ(min_ticks, soft_pwm_internal_config[0U].min_ticks);
+
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_set_duty(0U, 0U, 30U));
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_set_duty(0U, 1U, 30U + min_ticks - 1U));
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_set_duty(0U, 2U, 30U + min_ticks));
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_set_duty(0U, 3U, 100U - min_ticks + 1U));
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_commit(0U));
+    run_period(high_time);
+    run_period(high_time);
+    ASSERT_EQ(30U, high_time[0]);
+    ASSERT_EQ(30U, high_time[1]);
+    ASSERT_EQ(30U + min_ticks, high_time[2]);
+    ASSERT_EQ(100U - min_ticks, high_time[3]);
+
+    /* Every programmed compare value leaves the interrupt routine enough time */
+    const soft_pwm_table_t * const table = &soft_pwm_internal_config[0U].tables[soft_pwm_internal_config[0U].active];
+    for (uint8_t i = 0 ; i < table->count ; i++)
+    {
+        ASSERT_GE(table->edges[i].delta, min_ticks);
+    }
+}
+
+static timer_8_bit_model_t timer_model;
+
+static void timer_compare_match_isr(void)
+{
+    soft_pwm_interrupt_callback(0U);
+}
+
+TEST_F(SoftPwmFixture, test_duty_cycles_on_timer_model)
+{
+    /* 8 bit timer in CTC mode, its compare match A interrupt runs the software PWM */
+    timer_8_bit_config_t timer_config;
+    timer_8_bit_registers_stub_erase();
+    (void) timer_8_bit_deinit(0U);
+    (void) timer_8_bit_get_default_config(&timer_config);
+    timer_8_bit_registers_stub_init_handle(&timer_config.handle);
+    timer_config.timing_config.waveform_mode = TIMER8BIT_WG_CTC;
+    timer_config.timing_config.prescaler = TIMER8BIT_CLK_PRESCALER_64;
+    timer_config.interrupt_config.it_comp_match_a = true;
+    ASSERT_EQ(TIMER_ERROR_OK, timer_8_bit_init(0U, &timer_config));
+
+    config.compare_reg = &timer_8_bit_registers_stub.OCRA;
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_init(0U, &config));
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_set_duty(0U, 0U, 25U));
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_set_duty(0U, 1U, 60U));
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_set_duty(0U, 2U, 25U));
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_set_duty(0U, 3U, 100U));
+    ASSERT_EQ(SOFT_PWM_ERROR_OK, soft_pwm_commit(0U));
+
+    timer_8_bit_model_init(&timer_model, &timer_8_bit_registers_stub);
+    timer_8_bit_model_attach_isr(&timer_model, TIMER_8_BIT_MODEL_VECTOR_COMPA, timer_compare_match_isr);
+    ASSERT_EQ(TIMER_ERROR_OK, timer_8_bit_start(0U));
+
+    /* New duty cycles are applied from the next period on */
+    timer_8_bit_model_run(&timer_model, 2U * config.period * config.prescaler);
+    timer_model.isr_calls[TIMER_8_BIT_MODEL_VECTOR_COMPA] = 0U;
+
+    /* Pins are sampled once per timer tick over 10 periods */
+    const uint8_t port[4] = {IO_PORT_B, IO_PORT_B, IO_PORT_D, IO_PORT_D};
+    const uint8_t pin[4] = {0U, 1U, 5U, 6U};
+    uint16_t high_time[4] = {0};
+    for (uint16_t tick = 0 ; tick < (10U * config.period) ; tick++)
+    {
+        timer_8_bit_model_run(&timer_model, config.prescaler);
+        for (uint8_t i = 0 ; i < 4U ; i++)
+        {
+            if (0U != (ports[port[i]][0] & (1U << pin[i])))
+            {
+                high_time[i]++;
+            }
+        }
+    }
+    ASSERT_EQ(250U, high_time[0]);
+    ASSERT_EQ(600U, high_time[1]);
+    ASSERT_EQ(250U, high_time[2]);
+    ASSERT_EQ(1000U, high_time[3]);
+
+    /* One interrupt per edge : period start, 25 and 60 ticks edges */
+    ASSERT_EQ(30U, timer_model.isr_calls[TIMER_8_BIT_MODEL_VECTOR_COMPA]);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
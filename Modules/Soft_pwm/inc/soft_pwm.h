@@ -0,0 +1,139 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOFT_PWM_HEADER
+#define SOFT_PWM_HEADER
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "config.h"
+
+/* Maximum number of pins driven by a single software PWM module */
+#ifndef SOFT_PWM_MAX_CHANNELS
+    #define SOFT_PWM_MAX_CHANNELS 8U
+#endif
+
+/**
+ * @brief Describes available error codes for this software PWM module
+*/
+typedef enum
+{
+    SOFT_PWM_ERROR_OK,                 /**< No particular error                                                */
+    SOFT_PWM_ERROR_UNINITIALISED,      /**< Targeted software PWM instance has not been initialised yet        */
+    SOFT_PWM_ERROR_NULL_POINTER,       /**< One or more parameters are not initialised properly                */
+    SOFT_PWM_ERROR_INVALID_INDEX,      /**< Index is not set correctly, probably out of bounds                 */
+    SOFT_PWM_ERROR_CONFIG,             /**< Given configuration is not well-formed                             */
+} soft_pwm_error_t;
+
+/**
+ * @brief Initialisation structure
+*/
+typedef struct
+{
+    volatile uint8_t * compare_reg;                 /**< Compare register of an 8 bit timer running in CTC mode (e.g. OCR0A). Its compare
+                                                         match ISR shall call soft_pwm_interrupt_callback()                                 */
+    uint8_t period;                                 /**< Number of timer ticks in a PWM period, which is also the duty cycle resolution     */
+    uint16_t prescaler;                             /**< Prescaler of the underlying timer (CPU cycles per timer tick), sets the minimum
+                                                         distance between two edges along with SOFT_PWM_ISR_CYCLES                          */
+    uint8_t channels_count;                         /**< Number of driven pins                                                              */
+    uint8_t channels[SOFT_PWM_MAX_CHANNELS];        /**< Index of each driven pin in io_pins_lut, pins shall already be set as outputs      */
+} soft_pwm_config_t;
+
+/**
+ * @brief Initialises the software PWM module using an id and a configuration. All channels start with a null duty cycle.
+ * Underlying timer shall be configured by application (CTC mode, compare match interrupt enabled) and its compare register
+ * is then handled by this module.
+ * @param[in] id     :  index of software PWM module to be initialised
+ * @param[in] config :  configuration to be used to initialise the targeted software PWM module
+ * @return
+ *          SOFT_PWM_ERROR_OK              :   operation succeeded
+ *          SOFT_PWM_ERROR_NULL_POINTER    :   given parameter is uninitialised
+ *          SOFT_PWM_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          SOFT_PWM_ERROR_CONFIG          :   prescaler is null, period is too short for the prescaler (see SOFT_PWM_ISR_CYCLES),
+ *                                              channels count or a pin index is out of range
+*/
+soft_pwm_error_t soft_pwm_init(const uint8_t id, soft_pwm_config_t const * const config);
+
+/**
+ * @brief Deinitialises targeted software PWM module, driven pins are left as is
+ * @param[in] id    :   targeted software PWM module index
+ * @return
+ *          SOFT_PWM_ERROR_OK              :   operation succeeded
+ *          SOFT_PWM_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          SOFT_PWM_ERROR_UNINITIALISED   :   cannot deinit a module which has not been initialised yet
+*/
+soft_pwm_error_t soft_pwm_deinit(const uint8_t id);
+
+/**
+ * @brief Sets the duty cycle of a channel. New value is only taken into account by soft_pwm_commit(), which allows
+ * to update several channels at once.
+ * @param[in] id      : index of targeted software PWM module
+ * @param[in] channel : index of the channel in the configuration channels list
+ * @param[in] duty    : high time of the pin, in timer ticks, from 0 (always low) to period (always high)
+ * @return
+ *          SOFT_PWM_ERROR_OK              :   operation succeeded
+ *          SOFT_PWM_ERROR_INVALID_INDEX   :   given module id or channel is out of bounds
+ *          SOFT_PWM_ERROR_UNINITIALISED   :   selected module has not been initialised
+ *          SOFT_PWM_ERROR_CONFIG          :   duty cycle exceeds the period
+*/
+soft_pwm_error_t soft_pwm_set_duty(const uint8_t id, const uint8_t channel, const uint8_t duty);
+
+/**
+ * @brief Computes the edges table of the next PWM period from the channels duty cycles.
+ * Table is double buffered : new duty cycles are applied at the beginning of next period, without glitches.
+ * Timer restarts from 0 on each compare match, and the interrupt routine writes the next compare value up to
+ * SOFT_PWM_ISR_CYCLES CPU cycles later : edges are at least ceil(SOFT_PWM_ISR_CYCLES / prescaler) + 2 ticks apart.
+ * Duty cycles closer than that from each other (or from the end of the period) are rounded down so that the counter
+ * never passes the next compare value before it is written.
+ * @param[in] id      : index of targeted software PWM module
+ * @return
+ *          SOFT_PWM_ERROR_OK              :   operation succeeded
+ *          SOFT_PWM_ERROR_INVALID_INDEX   :   given module id is out of bounds
+ *          SOFT_PWM_ERROR_UNINITIALISED   :   selected module has not been initialised
+*/
+soft_pwm_error_t soft_pwm_commit(const uint8_t id);
+
+/**
+ * @brief A callback to be used within the timer compare match ISR (e.g. TIMER0_COMPA_vect) : applies the current edge
+ * with a single masked write per port and programs the timer compare register for the next one
+ * @param[in]  id : index of targeted software PWM module
+*/
+void soft_pwm_interrupt_callback(const uint8_t id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SOFT_PWM_HEADER */
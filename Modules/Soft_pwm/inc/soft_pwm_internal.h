@@ -0,0 +1,96 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOFT_PWM_INTERNAL_HEADER
+#define SOFT_PWM_INTERNAL_HEADER
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "config.h"
+#include "soft_pwm.h"
+#include "io.h"
+
+#ifndef SOFT_PWM_MAX_MODULES
+    #error "SOFT_PWM_MAX_MODULES define is missing, please set the maximum number of available software PWM modules in your config.h"
+#endif
+
+/* Worst case number of CPU cycles between a compare match and the compare register write in soft_pwm_interrupt_callback() :
+   interrupt response and vector jump, ISR prologue and the callback code preceding the write. Shall also cover the longest
+   interrupt routine which may delay this one. Minimum distance between two edges is derived from it (see soft_pwm_init()) */
+#ifndef SOFT_PWM_ISR_CYCLES
+    #define SOFT_PWM_ISR_CYCLES 100U
+#endif
+
+/* A period starts with all pins set, then one edge per distinct duty cycle */
+#define SOFT_PWM_MAX_EDGES (SOFT_PWM_MAX_CHANNELS + 1U)
+
+typedef struct
+{
+    uint8_t delta;                      /**< Ticks between this edge and the next one                                   */
+    uint8_t clear[IO_PORT_COUNT];       /**< Pins cleared on this edge, per port (first edge sets pins instead)          */
+} soft_pwm_edge_t;
+
+typedef struct
+{
+    soft_pwm_edge_t edges[SOFT_PWM_MAX_EDGES];
+    uint8_t set[IO_PORT_COUNT];         /**< Pins set at the beginning of the period, per port                          */
+    uint8_t count;                      /**< Number of edges in this period                                             */
+} soft_pwm_table_t;
+
+typedef struct
+{
+    volatile uint8_t * compare_reg;
+    uint8_t period;
+    uint8_t min_ticks;                  /**< Minimum distance between two edges, in timer ticks                         */
+    uint8_t channels_count;
+    struct
+    {
+        uint8_t port;                   /**< Port of the driven pin (io_port_t)                                         */
+        uint8_t mask;                   /**< Pin mask in its port                                                       */
+        uint8_t duty;                   /**< Requested duty cycle, in ticks                                             */
+    } channels[SOFT_PWM_MAX_CHANNELS];
+    uint8_t used[IO_PORT_COUNT];        /**< All driven pins, per port                                                  */
+    soft_pwm_table_t tables[2];         /**< Edges tables, one is used by the ISR while the other one is being computed */
+    volatile uint8_t active;            /**< Table currently used by the ISR                                            */
+    volatile bool pending;              /**< Other table is ready and shall be used from next period on                 */
+    uint8_t current;                    /**< Edge to be applied by the next interrupt                                   */
+    bool initialised;
+} soft_pwm_internal_config_t;
+
+extern soft_pwm_internal_config_t soft_pwm_internal_config[SOFT_PWM_MAX_MODULES];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SOFT_PWM_INTERNAL_HEADER */
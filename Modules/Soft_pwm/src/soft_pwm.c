@@ -0,0 +1,297 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "config.h"
+#include "soft_pwm.h"
+#include "soft_pwm_internal.h"
+#include "io.h"
+#include "critical_section.h"
+
+soft_pwm_internal_config_t soft_pwm_internal_config[SOFT_PWM_MAX_MODULES] = {0};
+
+static io_port_config_t * const port_lut[IO_PORT_COUNT] =
+{
+    &io_config.porta_cfg,
+    &io_config.portb_cfg,
+    &io_config.portc_cfg,
+    &io_config.portd_cfg
+};
+
+static inline bool is_index_valid(const uint8_t id)
+{
+    bool out = true;
+    if (id >= SOFT_PWM_MAX_MODULES)
+    {
+        out = false;
+    }
+    return out;
+}
+
+/**
+ * @brief computes the edges of a PWM period from the channels duty cycles.
+ * Channels are sorted by duty cycle, then channels sharing the same edge time are merged in a single edge so
+ * that they cost a single port write in the interrupt routine.
+*/
+static void build_table(soft_pwm_internal_config_t * const config, soft_pwm_table_t * const table)
+{
+    uint8_t order[SOFT_PWM_MAX_CHANNELS];
+    memset(table, 0, sizeof(soft_pwm_table_t));
+
+    /* Insertion sort is more than enough for a handful of channels */
+    for (uint8_t i = 0 ; i < config->channels_count ; i++)
+    {
+        uint8_t j = i;
+        while ((j > 0U) && (config->channels[order[j - 1U]].duty > config->channels[i].duty))
+        {
+            order[j] = order[j - 1U];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    uint8_t last_time = 0U;
+    table->count = 1U;
+    for (uint8_t i = 0 ; i < config->channels_count ; i++)
+    {
+        const uint8_t port = config->channels[order[i]].port;
+        const uint8_t mask = config->channels[order[i]].mask;
+        uint8_t duty = config->channels[order[i]].duty;
+
+        /* Always low pins are never set, always high pins are never cleared */
+        if (0U == duty)
+        {
+            continue;
+        }
+        table->set[port] |= mask;
+        if (duty >= config->period)
+        {
+            continue;
+        }
+
+        /* Last edge shall leave enough time to the interrupt routine to program the beginning of next period */
+        if ((uint8_t)(config->period - duty) < config->min_ticks)
+        {
+            duty = config->period - config->min_ticks;
+        }
+
+        if ((uint8_t)(duty - last_time) < config->min_ticks)
+        {
+            if (1U == table->count)
+            {
+                /* Too close to the beginning of the period : pin is not set at all */
+                table->set[port] &= ~mask;
+            }
+            else
+            {
+                table->edges[table->count - 1U].clear[port] |= mask;
+            }
+            continue;
+        }
+
+        table->edges[table->count - 1U].delta = duty - last_time;
+        table->edges[table->count].clear[port] |= mask;
+        last_time = duty;
+        table->count++;
+    }
+    table->edges[table->count - 1U].delta = config->period - last_time;
+}
+
+soft_pwm_error_t soft_pwm_init(const uint8_t id, soft_pwm_config_t const * const config)
+{
+    if (false == is_index_valid(id))
+    {
+        return SOFT_PWM_ERROR_INVALID_INDEX;
+    }
+
+    if ((NULL == config) || (NULL == config->compare_reg))
+    {
+        return SOFT_PWM_ERROR_NULL_POINTER;
+    }
+
+    if ((0U == config->channels_count)
+    ||  (config->channels_count > SOFT_PWM_MAX_CHANNELS)
+    ||  (0U == config->prescaler))
+    {
+        return SOFT_PWM_ERROR_CONFIG;
+    }
+
+    /* Counter shall still be below the next compare value once the interrupt routine writes it */
+    const uint16_t min_ticks = (uint16_t)((SOFT_PWM_ISR_CYCLES + config->prescaler - 1U) / config->prescaler) + 2U;
+    if (config->period < (2U * min_ticks))
+    {
+        return SOFT_PWM_ERROR_CONFIG;
+    }
+
+    soft_pwm_internal_config_t * const internal = &soft_pwm_internal_config[id];
+    internal->initialised = false;
+    memset(internal->used, 0, sizeof(internal->used));
+    for (uint8_t i = 0 ; i < config->channels_count ; i++)
+    {
+        const uint8_t index = config->channels[i];
+        if ((index >= IO_MAX_PINS) || (io_pins_lut[index].port >= IO_PORT_COUNT) || (io_pins_lut[index].pin > 7U))
+        {
+            return SOFT_PWM_ERROR_CONFIG;
+        }
+        internal->channels[i].port = (uint8_t) io_pins_lut[index].port;
+        internal->channels[i].mask = (uint8_t)(1U << io_pins_lut[index].pin);
+        internal->channels[i].duty = 0U;
+        internal->used[internal->channels[i].port] |= internal->channels[i].mask;
+    }
+
+    internal->compare_reg = config->compare_reg;
+    internal->period = config->period;
+    internal->min_ticks = (uint8_t) min_ticks;
+    internal->channels_count = config->channels_count;
+    build_table(internal, &internal->tables[0]);
+    internal->active = 0U;
+    internal->pending = false;
+    internal->current = 0U;
+    *internal->compare_reg = internal->tables[0].edges[0].delta - 1U;
+    internal->initialised = true;
+    return SOFT_PWM_ERROR_OK;
+}
+
+soft_pwm_error_t soft_pwm_deinit(const uint8_t id)
+{
+    if (false == is_index_valid(id))
+    {
+        return SOFT_PWM_ERROR_INVALID_INDEX;
+    }
+
+    if (false == soft_pwm_internal_config[id].initialised)
+    {
+        return SOFT_PWM_ERROR_UNINITIALISED;
+    }
+
+    memset(&soft_pwm_internal_config[id], 0, sizeof(soft_pwm_internal_config_t));
+    return SOFT_PWM_ERROR_OK;
+}
+
+soft_pwm_error_t soft_pwm_set_duty(const uint8_t id, const uint8_t channel, const uint8_t duty)
+{
+    if (false == is_index_valid(id))
+    {
+        return SOFT_PWM_ERROR_INVALID_INDEX;
+    }
+
+    soft_pwm_internal_config_t * const internal = &soft_pwm_internal_config[id];
+    if (false == internal->initialised)
+    {
+        return SOFT_PWM_ERROR_UNINITIALISED;
+    }
+
+    if (channel >= internal->channels_count)
+    {
+        return SOFT_PWM_ERROR_INVALID_INDEX;
+    }
+
+    if (duty > internal->period)
+    {
+        return SOFT_PWM_ERROR_CONFIG;
+    }
+
+    internal->channels[channel].duty = duty;
+    return SOFT_PWM_ERROR_OK;
+}
+
+soft_pwm_error_t soft_pwm_commit(const uint8_t id)
+{
+    if (false == is_index_valid(id))
+    {
+        return SOFT_PWM_ERROR_INVALID_INDEX;
+    }
+
+    soft_pwm_internal_config_t * const internal = &soft_pwm_internal_config[id];
+    if (false == internal->initialised)
+    {
+        return SOFT_PWM_ERROR_UNINITIALISED;
+    }
+
+    /* Interrupt routine only swaps tables when one is pending : clearing the flag first guarantees
+       that the table being computed is not in use, even if a previous commit was not applied yet */
+    internal->pending = false;
+    COMPILER_MEMORY_BARRIER();
+    build_table(internal, &internal->tables[internal->active ^ 1U]);
+    COMPILER_MEMORY_BARRIER();
+    internal->pending = true;
+    return SOFT_PWM_ERROR_OK;
+}
+
+void soft_pwm_interrupt_callback(const uint8_t id)
+{
+    if (false == is_index_valid(id))
+    {
+        return;
+    }
+
+    soft_pwm_internal_config_t * const internal = &soft_pwm_internal_config[id];
+    if (false == internal->initialised)
+    {
+        return;
+    }
+
+    /* New duty cycles are only applied at the beginning of a period */
+    if ((0U == internal->current) && (true == internal->pending))
+    {
+        internal->active ^= 1U;
+        internal->pending = false;
+    }
+
+    soft_pwm_table_t const * const table = &internal->tables[internal->active];
+    soft_pwm_edge_t const * const edge = &table->edges[internal->current];
+
+    /* CTC mode : compare register is not buffered and timer restarted from 0 when the interrupt was triggered */
+    *internal->compare_reg = edge->delta - 1U;
+
+    for (uint8_t port = 0 ; port < IO_PORT_COUNT ; port++)
+    {
+        if (0U == internal->current)
+        {
+            if (0U != internal->used[port])
+            {
+                *port_lut[port]->port_reg = (*port_lut[port]->port_reg & ~internal->used[port]) | table->set[port];
+            }
+        }
+        else if (0U != edge->clear[port])
+        {
+            *port_lut[port]->port_reg &= ~edge->clear[port];
+        }
+    }
+
+    internal->current++;
+    if (internal->current >= table->count)
+    {
+        internal->current = 0U;
+    }
+}
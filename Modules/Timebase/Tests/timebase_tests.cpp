@@ -27,7 +27,6 @@ GNU General Public License for more details.
 You should have received a copy of the GNU General Public License
 along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
-
 #include "gtest/gtest.h"
 
 #include <string.h>
@@ -36,21 +35,78 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "config.h"
 #include "timebase.h"
 #include "timebase_internal.h"
-#include "timer_8_bit_stub.h"
-#include "timer_8_bit_async_stub.h"
-#include "timer_16_bit_stub.h"
+#include "timer_8_bit_model.h"
+#include "timer_8_bit_async_model.h"
+#include "timer_16_bit_model.h"
+
+/* Each timer compare match A interrupt is routed to its own timebase instance */
+#define TIMEBASE_8_BIT_ID       0U
+#define TIMEBASE_8_BIT_ASYNC_ID 1U
+#define TIMEBASE_16_BIT_ID      2U
+
+#define CPU_FREQ                16'000'000U
+
+static timer_8_bit_model_t timer_8_bit_model;
+static timer_8_bit_async_model_t timer_8_bit_async_model;
+static timer_16_bit_model_t timer_16_bit_model;
+
+static void timer_8_bit_compa_isr(void)
+{
+    timebase_interrupt_callback(TIMEBASE_8_BIT_ID);
+}
+
+static void timer_8_bit_async_compa_isr(void)
+{
+    timebase_interrupt_callback(TIMEBASE_8_BIT_ASYNC_ID);
+}
+
+static void timer_16_bit_compa_isr(void)
+{
+    timebase_interrupt_callback(TIMEBASE_16_BIT_ID);
+}
 
+/**
+ * @brief (re)binds timer models to the registers stubs, interrupt flags cleared by the drivers while they were
+ * configured are discarded
+*/
+static void bind_timer_models(void)
+{
+    timer_8_bit_model_init(&timer_8_bit_model, &timer_8_bit_registers_stub);
+    timer_8_bit_model_attach_isr(&timer_8_bit_model, TIMER_8_BIT_MODEL_VECTOR_COMPA, timer_8_bit_compa_isr);
+    timer_8_bit_async_model_init(&timer_8_bit_async_model, &timer_8_bit_async_registers_stub);
+    timer_8_bit_async_model_attach_isr(&timer_8_bit_async_model, TIMER_8_BIT_ASYNC_MODEL_VECTOR_COMPA, timer_8_bit_async_compa_isr);
+    timer_16_bit_model_init(&timer_16_bit_model, &timer_16_bit_registers_stub);
+    timer_16_bit_model_attach_isr(&timer_16_bit_model, TIMER_16_BIT_MODEL_VECTOR_COMPA, timer_16_bit_compa_isr);
+}
+
+/**
+ * @brief runs all timer models for the given amount of CPU cycles
+*/
+static void run_timers(const uint32_t cpu_cycles)
+{
+    timer_8_bit_model_run(&timer_8_bit_model, cpu_cycles);
+    timer_8_bit_async_model_run(&timer_8_bit_async_model, cpu_cycles);
+    timer_16_bit_model_run(&timer_16_bit_model, cpu_cycles);
+}
 
 class TimebaseModuleBasicConfig : public ::testing::Test
 {
 public:
     void SetUp(void) override
     {
-        timer_8_bit_stub_reset();
-        timer_8_bit_async_stub_reset();
-        timer_16_bit_stub_reset();
+        timer_8_bit_registers_stub_erase();
+        timer_8_bit_async_registers_stub_erase();
+        timer_16_bit_registers_stub_erase();
+        memset(timebase_internal_config, 0, sizeof(timebase_internal_config));
 
-        config.cpu_freq = 16'000'000;
+        /* Drivers keep their state from one test to the other */
+        (void) timer_8_bit_deinit(0U);
+        (void) timer_8_bit_async_deinit(0U);
+        (void) timer_16_bit_deinit(0U);
+
+        bind_timer_models();
+
+        config.cpu_freq = CPU_FREQ;
         config.timescale = TIMEBASE_TIMESCALE_MILLISECONDS;
         config.timer.type = TIMEBASE_TIMER_16_BIT;
         config.timer.index = 0U;
@@ -63,32 +119,50 @@ public:
     timebase_config_t config;
 };
 
-class TimebaseModule8BitInitialised : public TimebaseModuleBasicConfig
+class TimebaseModuleTimersInitialised : public TimebaseModuleBasicConfig
 {
 public:
-    void SetUp(void)
+    void SetUp(void) override
     {
         TimebaseModuleBasicConfig::SetUp();
-        timer_8_bit_stub_set_initialised(true);
 
-        config.timer.type = TIMEBASE_TIMER_8_BIT;
-        config.timer.index = 0U;
+        timer_8_bit_config_t timer_8_bit_config;
+        (void) timer_8_bit_get_default_config(&timer_8_bit_config);
+        timer_8_bit_registers_stub_init_handle(&timer_8_bit_config.handle);
+        ASSERT_EQ(TIMER_ERROR_OK, timer_8_bit_init(0U, &timer_8_bit_config));
+
+        timer_8_bit_async_config_t timer_8_bit_async_config;
+        (void) timer_8_bit_async_get_default_config(&timer_8_bit_async_config);
+        timer_8_bit_async_registers_stub_init_handle(&timer_8_bit_async_config.handle);
+        ASSERT_EQ(TIMER_ERROR_OK, timer_8_bit_async_init(0U, &timer_8_bit_async_config));
 
-        timer_8_bit_prescaler_selection_t prescaler = TIMER8BIT_CLK_PRESCALER_64;
-        uint32_t accumulator = 5U;
-        uint8_t ocra = 0U;
+        timer_16_bit_config_t timer_16_bit_config;
+        (void) timer_16_bit_get_default_config(&timer_16_bit_config);
+        timer_16_bit_registers_stub_init_handle(&timer_16_bit_config.handle);
+        ASSERT_EQ(TIMER_ERROR_OK, timer_16_bit_init(0U, &timer_16_bit_config));
+    }
+};
 
-        timer_8_bit_stub_set_next_parameters(prescaler, ocra, accumulator);
+class TimebaseModule8BitInitialised : public TimebaseModuleTimersInitialised
+{
+public:
+    void SetUp(void) override
+    {
+        TimebaseModuleTimersInitialised::SetUp();
+        config.timer.type = TIMEBASE_TIMER_8_BIT;
+        config.timer.index = 0U;
 
-        timebase_error_t err = timebase_init(0U, &config);
+        timebase_error_t err = timebase_init(TIMEBASE_8_BIT_ID, &config);
         ASSERT_EQ(TIMEBASE_ERROR_OK, err);
+
+        bind_timer_models();
     }
 };
 
 TEST(timebase_module_tests, test_compute_timer_parameters)
 {
     timebase_config_t config;
-    config.cpu_freq = 16'000'000;
+    config.cpu_freq = CPU_FREQ;
     config.timescale = TIMEBASE_TIMESCALE_MILLISECONDS;
     config.timer.type = TIMEBASE_TIMER_16_BIT;
     config.timer.index = 0U;
@@ -97,8 +171,6 @@ TEST(timebase_module_tests, test_compute_timer_parameters)
     uint16_t ocr_value = 0;
     uint16_t accumulator = 0;
 
-    timer_16_bit_stub_set_next_parameters(TIMER16BIT_CLK_PRESCALER_1, 15999U, 0U);
-
     timebase_error_t err = timebase_compute_timer_parameters(&config, &prescaler, &ocr_value, &accumulator);
     ASSERT_EQ(TIMEBASE_ERROR_OK, err);
     ASSERT_EQ(0U, accumulator);
@@ -107,21 +179,20 @@ TEST(timebase_module_tests, test_compute_timer_parameters)
 
     config.timer.type = TIMEBASE_TIMER_8_BIT;
     config.timer.index = 0U;
-    timer_8_bit_stub_set_next_parameters(TIMER8BIT_CLK_PRESCALER_64, 250, 3U);
     err = timebase_compute_timer_parameters(&config, &prescaler, &ocr_value, &accumulator);
     ASSERT_EQ(TIMEBASE_ERROR_OK, err);
-    ASSERT_EQ(3U, accumulator);
+    ASSERT_EQ(0U, accumulator);
     ASSERT_EQ(prescaler, 64U);
-    ASSERT_EQ(ocr_value, 250U);
+    ASSERT_EQ(ocr_value, 249U);
 
     config.timer.type = TIMEBASE_TIMER_8_BIT_ASYNC;
     config.timer.index = 0U;
-    timer_8_bit_async_stub_set_next_parameters(TIMER8BIT_ASYNC_CLK_PRESCALER_1024, 127, 4U);
+    config.timescale = TIMEBASE_TIMESCALE_SECONDS;
     err = timebase_compute_timer_parameters(&config, &prescaler, &ocr_value, &accumulator);
     ASSERT_EQ(TIMEBASE_ERROR_OK, err);
-    ASSERT_EQ(4U, accumulator);
+    ASSERT_EQ(124U, accumulator);
     ASSERT_EQ(prescaler, 1024);
-    ASSERT_EQ(ocr_value, 127U);
+    ASSERT_EQ(ocr_value, 124U);
 }
 
 TEST(timebase_module_test, test_guard_wrong_parameters)
@@ -210,12 +281,8 @@ TEST(timebase_module_test, test_guard_wrong_parameters)
     }
 }
 
-TEST(timebase_module_tests, test_wrong_index_error_forwarding)
+TEST_F(TimebaseModuleTimersInitialised, test_wrong_index_error_forwarding)
 {
-    timebase_config_t config;
-    config.cpu_freq = 16'000'000;
-    config.timescale = TIMEBASE_TIMESCALE_MILLISECONDS;
-
     // This index should break execution as this timer driver does not exist (only '0' is declared)
     config.timer.index = 1U;
 
@@ -237,14 +304,8 @@ TEST(timebase_module_tests, test_wrong_index_error_forwarding)
     ASSERT_EQ(TIMEBASE_ERROR_INVALID_INDEX, err);
 }
 
-TEST(timebase_module_tests, test_uninitialised_timer_error)
+TEST_F(TimebaseModuleBasicConfig, test_uninitialised_timer_error)
 {
-    timebase_config_t config;
-    config.cpu_freq = 16'000'000;
-    config.timescale = TIMEBASE_TIMESCALE_MILLISECONDS;
-    config.timer.type = TIMEBASE_TIMER_16_BIT;
-    config.timer.index = 0U;
-
     timebase_error_t err = timebase_init(0U, &config);
     ASSERT_EQ(TIMEBASE_ERROR_TIMER_UNINITIALISED, err);
 
@@ -255,28 +316,113 @@ TEST(timebase_module_tests, test_uninitialised_timer_error)
     config.timer.type = TIMEBASE_TIMER_8_BIT_ASYNC;
     err = timebase_init(0U, &config);
     ASSERT_EQ(TIMEBASE_ERROR_TIMER_UNINITIALISED, err);
+
+    // Timer was never started
+    run_timers(CPU_FREQ / 100U);
+    ASSERT_EQ(timer_8_bit_model.ticks, 0U);
+    ASSERT_EQ(timer_8_bit_async_model.ticks, 0U);
+    ASSERT_EQ(timer_16_bit_model.ticks, 0U);
 }
 
-TEST_F(TimebaseModuleBasicConfig, test_timer_initialisation)
+TEST_F(TimebaseModuleTimersInitialised, test_timer_initialisation)
 {
-    timer_8_bit_stub_set_initialised(true);
     config.timer.type = TIMEBASE_TIMER_8_BIT;
     config.timer.index = 0U;
 
-    timer_8_bit_prescaler_selection_t prescaler = TIMER8BIT_CLK_PRESCALER_64;
-    uint32_t accumulator = 5U;
-    uint8_t ocra = 0U;
+    timebase_error_t err = timebase_init(TIMEBASE_8_BIT_ID, &config);
+    ASSERT_EQ(TIMEBASE_ERROR_OK, err);
 
-    timer_8_bit_stub_set_next_parameters(prescaler, ocra, accumulator);
+    // Timer counts in CTC mode, up to OCRA, and is started right away
+    ASSERT_EQ(timer_8_bit_registers_stub.OCRA, 249U);
+    ASSERT_EQ(timer_8_bit_registers_stub.TCCRB & CS_MSK, TIMER8BIT_CLK_PRESCALER_64);
+    ASSERT_EQ(timer_8_bit_registers_stub.TCCRB & WGM2_MSK, 0U);
+    ASSERT_EQ(timer_8_bit_registers_stub.TCCRA & (WGM0_MSK | WGM1_MSK), WGM1_MSK);
+    ASSERT_EQ(timer_8_bit_registers_stub.TIMSK, OCIEA_MSK);
+    ASSERT_EQ(timebase_internal_config[TIMEBASE_8_BIT_ID].accumulator.programmed, 0U);
+}
 
-    timebase_error_t err = timebase_init(0U, &config);
+TEST_F(TimebaseModuleTimersInitialised, test_tick_rate)
+{
+    // Millisecond timebase on every timer type, 8 bit asynchronous timer is the one used by the application
+    const timebase_timer_t timers[TIMEBASE_MAX_MODULES] = {TIMEBASE_TIMER_8_BIT, TIMEBASE_TIMER_8_BIT_ASYNC, TIMEBASE_TIMER_16_BIT};
+    for (uint8_t id = 0 ; id < TIMEBASE_MAX_MODULES ; id++)
+    {
+        config.timer.type = timers[id];
+        timebase_error_t err = timebase_init(id, &config);
+        ASSERT_EQ(TIMEBASE_ERROR_OK, err);
+    }
+    bind_timer_models();
+
+    uint16_t reference[TIMEBASE_MAX_MODULES] = {0};
+    for (uint8_t id = 0 ; id < TIMEBASE_MAX_MODULES ; id++)
+    {
+        ASSERT_EQ(TIMEBASE_ERROR_OK, timebase_get_tick(id, &reference[id]));
+    }
+
+    // One tick per millisecond, tick counter wraps around after a bit more than 65 seconds
+    for (uint8_t second = 0 ; second < 70U ; second++)
+    {
+        run_timers(CPU_FREQ);
+    }
+
+    for (uint8_t id = 0 ; id < TIMEBASE_MAX_MODULES ; id++)
+    {
+        uint16_t tick = 0;
+        uint16_t duration = 0;
+        ASSERT_EQ(TIMEBASE_ERROR_OK, timebase_get_tick(id, &tick));
+        ASSERT_EQ(tick, (uint16_t) 70'000U);
+        ASSERT_EQ(TIMEBASE_ERROR_OK, timebase_get_duration_now(id, &reference[id], &duration));
+        ASSERT_EQ(duration, (uint16_t) 70'000U);
+    }
+
+    // Half a millisecond more does not make a new tick, the other half does
+    run_timers(CPU_FREQ / 2000U);
+    uint16_t tick = 0;
+    ASSERT_EQ(TIMEBASE_ERROR_OK, timebase_get_tick(TIMEBASE_8_BIT_ID, &tick));
+    ASSERT_EQ(tick, (uint16_t) 70'000U);
+    run_timers(CPU_FREQ / 2000U);
+    ASSERT_EQ(TIMEBASE_ERROR_OK, timebase_get_tick(TIMEBASE_8_BIT_ID, &tick));
+    ASSERT_EQ(tick, (uint16_t) 70'001U);
+}
+
+TEST_F(TimebaseModuleTimersInitialised, test_accumulator)
+{
+    // One second is too long for a single 8 bit compare match : 125 compare matches make a tick
+    config.timescale = TIMEBASE_TIMESCALE_SECONDS;
+    config.timer.type = TIMEBASE_TIMER_8_BIT;
+    timebase_error_t err = timebase_init(TIMEBASE_8_BIT_ID, &config);
     ASSERT_EQ(TIMEBASE_ERROR_OK, err);
-    timer_8_bit_config_t driver_config;
-    memset(&driver_config, 0, sizeof(timer_8_bit_config_t));
+    ASSERT_EQ(timer_8_bit_registers_stub.OCRA, 124U);
+    ASSERT_EQ(timer_8_bit_registers_stub.TCCRB & CS_MSK, TIMER8BIT_CLK_PRESCALER_1024);
+    ASSERT_EQ(timebase_internal_config[TIMEBASE_8_BIT_ID].accumulator.programmed, 124U);
+    bind_timer_models();
 
-    timer_8_bit_stub_get_driver_configuration(&driver_config);
-    ASSERT_EQ(driver_config.timing_config.ocra_val, ocra);
-    ASSERT_EQ(driver_config.timing_config.prescaler, prescaler);
+    uint16_t tick = 0;
+    for (uint8_t second = 0 ; second < 3U ; second++)
+    {
+        timer_8_bit_model_run(&timer_8_bit_model, CPU_FREQ);
+    }
+    ASSERT_EQ(TIMEBASE_ERROR_OK, timebase_get_tick(TIMEBASE_8_BIT_ID, &tick));
+    ASSERT_EQ(tick, 3U);
+    ASSERT_EQ(timer_8_bit_model.isr_calls[TIMER_8_BIT_MODEL_VECTOR_COMPA], 375U);
+    ASSERT_EQ(timebase_internal_config[TIMEBASE_8_BIT_ID].accumulator.running, 0U);
+
+    // Tick only happens on the 125th compare match
+    timer_8_bit_model_run(&timer_8_bit_model, CPU_FREQ - (1024U * 125U));
+    ASSERT_EQ(TIMEBASE_ERROR_OK, timebase_get_tick(TIMEBASE_8_BIT_ID, &tick));
+    ASSERT_EQ(tick, 3U);
+    ASSERT_EQ(timebase_internal_config[TIMEBASE_8_BIT_ID].accumulator.running, 124U);
+    timer_8_bit_model_run(&timer_8_bit_model, 1024U * 125U);
+    ASSERT_EQ(TIMEBASE_ERROR_OK, timebase_get_tick(TIMEBASE_8_BIT_ID, &tick));
+    ASSERT_EQ(tick, 4U);
+    ASSERT_EQ(timebase_internal_config[TIMEBASE_8_BIT_ID].accumulator.running, 0U);
+
+    // Sleeping device : ticks elapsed while the timer was stopped are accounted for at once
+    err = timebase_resynchronise(TIMEBASE_8_BIT_ID, 10U);
+    ASSERT_EQ(err, TIMEBASE_ERROR_OK);
+    timer_8_bit_model_run(&timer_8_bit_model, CPU_FREQ);
+    ASSERT_EQ(TIMEBASE_ERROR_OK, timebase_get_tick(TIMEBASE_8_BIT_ID, &tick));
+    ASSERT_EQ(tick, 15U);
 }
 
 TEST_F(TimebaseModule8BitInitialised, test_ticks_and_durations)
@@ -307,8 +453,118 @@ TEST_F(TimebaseModule8BitInitialised, test_ticks_and_durations)
 }
 
 
+TEST_F(TimebaseModule8BitInitialised, test_resynchronise_after_sleep)
+{
+    timebase_internal_config[0U].tick = 1000U;
+    timebase_internal_config[0U].accumulator.running = 3U;
+
+    // Millisecond timebase : 5 seconds spent sleeping account for 5000 ticks
+    timebase_error_t err = timebase_resynchronise(0U, 5U);
+    ASSERT_EQ(err, TIMEBASE_ERROR_OK);
+    ASSERT_EQ(timebase_internal_config[0U].tick, 6000U);
+    ASSERT_EQ(timebase_internal_config[0U].accumulator.running, 0U);
+
+    // Tick counter wraps around like it would while counting
+    err = timebase_resynchronise(0U, 60U);
+    ASSERT_EQ(err, TIMEBASE_ERROR_OK);
+    ASSERT_EQ(timebase_internal_config[0U].tick, (uint16_t)(6000U + 60000U));
+
+    err = timebase_resynchronise(TIMEBASE_MAX_MODULES, 1U);
+    ASSERT_EQ(err, TIMEBASE_ERROR_INVALID_INDEX);
+}
+
+TEST_F(TimebaseModuleTimersInitialised, test_live_retune)
+{
+    bool pending = false;
+    uint16_t tick = 0;
+
+    // 1 Hz timebase : 125 compare matches per tick
+    config.timescale = TIMEBASE_TIMESCALE_SECONDS;
+    config.timer.type = TIMEBASE_TIMER_8_BIT;
+    timebase_error_t err = timebase_init(TIMEBASE_8_BIT_ID, &config);
+    ASSERT_EQ(TIMEBASE_ERROR_OK, err);
+    bind_timer_models();
+    timer_8_bit_model_run(&timer_8_bit_model, CPU_FREQ + (CPU_FREQ / 2U));
+    ASSERT_EQ(TIMEBASE_ERROR_OK, timebase_get_tick(TIMEBASE_8_BIT_ID, &tick));
+    ASSERT_EQ(tick, 1U);
+    ASSERT_EQ(timebase_internal_config[TIMEBASE_8_BIT_ID].accumulator.running, 62U);
+
+    // New settings are computed right away but the running timer is left untouched
+    config.timescale = TIMEBASE_TIMESCALE_CUSTOM;
+    config.custom_target_freq = 2U;
+    err = timebase_retune(TIMEBASE_8_BIT_ID, &config);
+    ASSERT_EQ(err, TIMEBASE_ERROR_OK);
+    err = timebase_is_retune_pending(TIMEBASE_8_BIT_ID, &pending);
+    ASSERT_EQ(err, TIMEBASE_ERROR_OK);
+    ASSERT_TRUE(pending);
+    ASSERT_EQ(timer_8_bit_registers_stub.OCRA, 124U);
+    ASSERT_EQ(timer_8_bit_registers_stub.TCCRB & CS_MSK, TIMER8BIT_CLK_PRESCALER_1024);
+
+    // Applied on next compare match : 63 out of 125 compare matches elapsed, which is carried over as 15 out of 31
+    timer_8_bit_model_run(&timer_8_bit_model, 1024U * 125U);
+    err = timebase_is_retune_pending(TIMEBASE_8_BIT_ID, &pending);
+    ASSERT_EQ(err, TIMEBASE_ERROR_OK);
+    ASSERT_FALSE(pending);
+    ASSERT_EQ(timer_8_bit_registers_stub.OCRA, 251U);
+    ASSERT_EQ(timer_8_bit_registers_stub.TCCRB & CS_MSK, TIMER8BIT_CLK_PRESCALER_1024);
+    ASSERT_EQ(timebase_internal_config[TIMEBASE_8_BIT_ID].accumulator.programmed, 30U);
+    ASSERT_EQ(timebase_internal_config[TIMEBASE_8_BIT_ID].accumulator.running, 15U);
+    ASSERT_EQ(TIMEBASE_ERROR_OK, timebase_get_tick(TIMEBASE_8_BIT_ID, &tick));
+    ASSERT_EQ(tick, 1U);
+
+    // Tick completes using the new settings, then timebase runs at 2 Hz
+    timer_8_bit_model_run(&timer_8_bit_model, 1024U * 252U * 16U);
+    ASSERT_EQ(TIMEBASE_ERROR_OK, timebase_get_tick(TIMEBASE_8_BIT_ID, &tick));
+    ASSERT_EQ(tick, 2U);
+    for (uint8_t second = 0 ; second < 5U ; second++)
+    {
+        timer_8_bit_model_run(&timer_8_bit_model, CPU_FREQ);
+    }
+    ASSERT_EQ(TIMEBASE_ERROR_OK, timebase_get_tick(TIMEBASE_8_BIT_ID, &tick));
+    ASSERT_EQ(tick, 12U);
+
+    err = timebase_retune(TIMEBASE_8_BIT_ID, NULL);
+    ASSERT_EQ(err, TIMEBASE_ERROR_NULL_POINTER);
+    config.timescale = (timebase_timescale_t) 12;
+    err = timebase_retune(TIMEBASE_8_BIT_ID, &config);
+    ASSERT_EQ(err, TIMEBASE_ERROR_UNSUPPORTED_TIMESCALE);
+}
+
+TEST_F(TimebaseModule8BitInitialised, test_live_retune_rejected_by_driver)
+{
+    bool pending = false;
+    config.timescale = TIMEBASE_TIMESCALE_CUSTOM;
+    config.custom_target_freq = 250U;
+    timebase_error_t err = timebase_retune(TIMEBASE_8_BIT_ID, &config);
+    ASSERT_EQ(err, TIMEBASE_ERROR_OK);
+
+    // Driver rejects the new settings : timebase keeps running on the old ones and retries on next compare match
+    const uint8_t timer_id = timebase_internal_config[TIMEBASE_8_BIT_ID].timer_id;
+    timebase_internal_config[TIMEBASE_8_BIT_ID].timer_id = 1U;
+    timer_8_bit_model_run(&timer_8_bit_model, CPU_FREQ / 1000U);
+    ASSERT_EQ(timer_8_bit_model.isr_calls[TIMER_8_BIT_MODEL_VECTOR_COMPA], 1U);
+    ASSERT_EQ(timer_8_bit_registers_stub.OCRA, 249U);
+    ASSERT_EQ(timer_8_bit_registers_stub.TCCRB & CS_MSK, TIMER8BIT_CLK_PRESCALER_64);
+    ASSERT_EQ(timebase_internal_config[TIMEBASE_8_BIT_ID].tick, 1U);
+    err = timebase_is_retune_pending(TIMEBASE_8_BIT_ID, &pending);
+    ASSERT_EQ(err, TIMEBASE_ERROR_OK);
+    ASSERT_TRUE(pending);
+
+    timebase_internal_config[TIMEBASE_8_BIT_ID].timer_id = timer_id;
+    timer_8_bit_model_run(&timer_8_bit_model, CPU_FREQ / 1000U);
+    ASSERT_EQ(timer_8_bit_registers_stub.OCRA, 249U);
+    ASSERT_EQ(timer_8_bit_registers_stub.TCCRB & CS_MSK, TIMER8BIT_CLK_PRESCALER_256);
+    err = timebase_is_retune_pending(TIMEBASE_8_BIT_ID, &pending);
+    ASSERT_EQ(err, TIMEBASE_ERROR_OK);
+    ASSERT_FALSE(pending);
+
+    // 250 Hz from now on
+    timer_8_bit_model_run(&timer_8_bit_model, CPU_FREQ);
+    ASSERT_EQ(timebase_internal_config[TIMEBASE_8_BIT_ID].tick, 252U);
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
-}
\ No newline at end of file
+}
@@ -181,6 +181,49 @@ timebase_error_t timebase_get_duration(uint16_t const * const reference, uint16_
 */
 timebase_error_t timebase_get_duration_now(const uint8_t id, uint16_t const * const reference, uint16_t * const duration);
 
+/**
+ * @brief Catches up with time elapsed while the underlying timer was not counting, e.g. when the device was sleeping
+ * in power-save mode with only the asynchronous timer running as a real time clock.
+ * Can be called with interrupts enabled, counters are updated atomically with respect to timebase_interrupt_callback().
+ * @param[in]  id              : index of targeted timebase module
+ * @param[in]  elapsed_seconds : time spent without the underlying timer running (e.g. difference of real time clock seconds counter)
+ * @return
+ *          TIMEBASE_ERROR_OK               :   operation succeeded
+ *          TIMEBASE_ERROR_INVALID_INDEX    :   given module id is out of bounds
+ *          TIMEBASE_ERROR_UNINITIALISED    :   selected module has not been initialised
+*/
+timebase_error_t timebase_resynchronise(const uint8_t id, const uint32_t elapsed_seconds);
+
+/**
+ * @brief Changes the timebase settings (cpu frequency and/or timescale) while the underlying timer keeps on running,
+ * e.g. when switching power modes. New timer settings are computed right away but only applied by the next call to
+ * timebase_interrupt_callback(), right after the compare match cleared the counter : counter is never stopped and
+ * the elapsed fraction of the current tick is carried over to the new settings.
+ * Timer selection of the given configuration is ignored, the timer used at initialisation time is kept.
+ * @param[in]  id       : index of targeted timebase module
+ * @param[in]  config   : new timebase configuration
+ * @return
+ *          TIMEBASE_ERROR_OK                       :   operation succeeded
+ *          TIMEBASE_ERROR_NULL_POINTER             :   given parameter is uninitialised
+ *          TIMEBASE_ERROR_INVALID_INDEX            :   given module id is out of bounds
+ *          TIMEBASE_ERROR_UNINITIALISED            :   selected module has not been initialised
+ *          TIMEBASE_ERROR_UNSUPPORTED_TIMESCALE    :   timescale is not relevant to timebase module
+*/
+timebase_error_t timebase_retune(const uint8_t id, timebase_config_t const * const config);
+
+/**
+ * @brief Tells whether settings given to timebase_retune() are still waiting for the next compare match to be applied
+ * Settings rejected by the timer driver stay pending and are tried again on the following compare match.
+ * @param[in]  id       : index of targeted timebase module
+ * @param[out] pending  : true while new settings are not applied yet
+ * @return
+ *          TIMEBASE_ERROR_OK               :   operation succeeded
+ *          TIMEBASE_ERROR_NULL_POINTER     :   given parameter is uninitialised
+ *          TIMEBASE_ERROR_INVALID_INDEX    :   given module id is out of bounds
+ *          TIMEBASE_ERROR_UNINITIALISED    :   selected module has not been initialised
+*/
+timebase_error_t timebase_is_retune_pending(const uint8_t id, bool * const pending);
+
 /**
  * @brief A callback to be used within the Timer ISR which handles time increment
  * @param[in]  id : index of targeted timebase module
@@ -43,11 +43,20 @@ typedef struct
 {
     timebase_timer_t timer;
     uint8_t timer_id;
+    uint32_t frequency;     /**< Tick frequency, in Hz */
     struct
     {
         uint16_t programmed;
         uint16_t running;
     } accumulator;
+    struct
+    {
+        uint8_t prescaler;      /**< Prescaler selection, as used by the underlying timer driver            */
+        uint16_t ocr;           /**< Compare match value to be written into OCRA                            */
+        uint16_t accumulator;   /**< Accumulator value to be used once the new settings are applied         */
+        uint32_t frequency;     /**< New tick frequency, in Hz                                              */
+        volatile bool pending;  /**< New settings are waiting for the next compare match to be applied      */
+    } retune;
     uint16_t tick;
     bool initialised;
 } timebase_internal_config_t;
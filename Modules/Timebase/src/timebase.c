@@ -35,6 +35,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "config.h"
 #include "timebase.h"
 #include "timebase_internal.h"
+#include "critical_section.h"
 
 #include "timer_8_bit.h"
 #include "timer_16_bit.h"
@@ -61,6 +62,8 @@ static void reset_internal_config(const uint8_t id)
     timebase_internal_config[id].accumulator.programmed = 0;
     timebase_internal_config[id].accumulator.running = 0;
     timebase_internal_config[id].tick = 0;
+    timebase_internal_config[id].frequency = 0;
+    timebase_internal_config[id].retune.pending = false;
     timebase_internal_config[id].timer = TIMEBASE_TIMER_UNDEFINED;
     timebase_internal_config[id].timer_id = 0;
     timebase_internal_config[id].initialised = false;
@@ -107,6 +110,8 @@ static inline timebase_error_t setup_8_bit_timer(const uint8_t timebase_id, uint
 
     // Use old handle
     config.handle = handle;
+    // Counter is cleared on compare match so that OCRA sets the tick period
+    config.timing_config.waveform_mode = TIMER8BIT_WG_CTC;
     config.timing_config.comp_match_a = TIMER8BIT_CMOD_CLEAR_OCnX;
     config.timing_config.comp_match_b = TIMER8BIT_CMOD_NORMAL;
     config.timing_config.ocra_val = ocra;
@@ -119,6 +124,13 @@ static inline timebase_error_t setup_8_bit_timer(const uint8_t timebase_id, uint
         return TIMEBASE_ERROR_TIMER_ERROR;
     }
 
+    // Reconfiguration leaves the timer stopped, prescaler is only applied when it starts
+    ret = timer_8_bit_start(timebase_internal_config[timebase_id].timer_id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return TIMEBASE_ERROR_TIMER_ERROR;
+    }
+
     return TIMEBASE_ERROR_OK;
 }
 
@@ -163,6 +175,8 @@ static inline timebase_error_t setup_8_bit_async_timer(const uint8_t timebase_id
 
     // Use old handle
     config.handle = handle;
+    // Counter is cleared on compare match so that OCRA sets the tick period
+    config.timing_config.waveform_mode = TIMER8BIT_ASYNC_WG_CTC;
     config.timing_config.comp_match_a = TIMER8BIT_ASYNC_CMOD_CLEAR_OCnX;
     config.timing_config.comp_match_b = TIMER8BIT_ASYNC_CMOD_NORMAL;
     config.timing_config.ocra_val = ocra;
@@ -175,6 +189,13 @@ static inline timebase_error_t setup_8_bit_async_timer(const uint8_t timebase_id
         return TIMEBASE_ERROR_TIMER_ERROR;
     }
 
+    // Reconfiguration leaves the timer stopped, prescaler is only applied when it starts
+    ret = timer_8_bit_async_start(timebase_internal_config[timebase_id].timer_id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return TIMEBASE_ERROR_TIMER_ERROR;
+    }
+
     return TIMEBASE_ERROR_OK;
 }
 
@@ -219,6 +240,8 @@ static inline timebase_error_t setup_16_bit_timer(const uint8_t timebase_id, uin
 
     // Use old handle
     config.handle = handle;
+    // Counter is cleared on compare match so that OCRA sets the tick period
+    config.timing_config.waveform_mode = TIMER16BIT_WG_CTC_OCRA_MAX;
     config.timing_config.comp_match_a = TIMER16BIT_CMOD_CLEAR_OCnX;
     config.timing_config.comp_match_b = TIMER16BIT_CMOD_NORMAL;
     config.timing_config.ocra_val = ocra;
@@ -231,6 +254,13 @@ static inline timebase_error_t setup_16_bit_timer(const uint8_t timebase_id, uin
         return TIMEBASE_ERROR_TIMER_ERROR;
     }
 
+    // Reconfiguration leaves the timer stopped, prescaler is only applied when it starts
+    ret = timer_16_bit_start(timebase_internal_config[timebase_id].timer_id);
+    if (TIMER_ERROR_OK != ret)
+    {
+        return TIMEBASE_ERROR_TIMER_ERROR;
+    }
+
     return TIMEBASE_ERROR_OK;
 }
 
@@ -335,6 +365,7 @@ timebase_error_t timebase_init(const uint8_t timebase_id, timebase_config_t cons
     {
         return ret;
     }
+    timebase_internal_config[timebase_id].frequency = target_freq;
 
     // Initialise each timer using the right parameters set
     switch(config->timer.type)
@@ -359,6 +390,60 @@ timebase_error_t timebase_init(const uint8_t timebase_id, timebase_config_t cons
     return ret;
 }
 
+/**
+ * @brief applies settings staged by timebase_retune(). Called from the compare match interrupt, when the counter has just
+ * been cleared : compare value is written first so that it is never found below the counter once the prescaler changes.
+ * Staged settings are kept pending if the timer driver rejects them, next compare match tries again.
+*/
+static void apply_retune(const uint8_t timebase_id)
+{
+    timebase_internal_config_t * const module = &timebase_internal_config[timebase_id];
+    timer_error_t err = TIMER_ERROR_OK;
+
+    switch (module->timer)
+    {
+        case TIMEBASE_TIMER_8_BIT:
+            err = timer_8_bit_set_ocra_register_value(module->timer_id, (uint8_t) module->retune.ocr);
+            if (TIMER_ERROR_OK == err)
+            {
+                err = timer_8_bit_set_prescaler(module->timer_id, (timer_8_bit_prescaler_selection_t) module->retune.prescaler);
+            }
+            break;
+
+        case TIMEBASE_TIMER_8_BIT_ASYNC:
+            err = timer_8_bit_async_set_ocra_register_value(module->timer_id, (uint8_t) module->retune.ocr);
+            if (TIMER_ERROR_OK == err)
+            {
+                err = timer_8_bit_async_set_prescaler(module->timer_id, (timer_8_bit_async_prescaler_selection_t) module->retune.prescaler);
+            }
+            break;
+
+        case TIMEBASE_TIMER_16_BIT:
+            err = timer_16_bit_set_ocra_register_value(module->timer_id, &module->retune.ocr);
+            if (TIMER_ERROR_OK == err)
+            {
+                err = timer_16_bit_set_prescaler(module->timer_id, (timer_16_bit_prescaler_selection_t) module->retune.prescaler);
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    if (TIMER_ERROR_OK != err)
+    {
+        return;
+    }
+
+    /* Keep the elapsed fraction of the current tick : running / (programmed + 1) is preserved */
+    const uint32_t old_period = (uint32_t) module->accumulator.programmed + 1U;
+    const uint32_t new_period = (uint32_t) module->retune.accumulator + 1U;
+    module->accumulator.running = (uint16_t)(((uint32_t) module->accumulator.running * new_period) / old_period);
+    module->accumulator.programmed = module->retune.accumulator;
+    module->frequency = module->retune.frequency;
+    module->retune.pending = false;
+}
+
 void timebase_interrupt_callback(const uint8_t timebase_id)
 {
     if (false == is_index_valid(timebase_id))
@@ -385,6 +470,127 @@ void timebase_interrupt_callback(const uint8_t timebase_id)
     {
         timebase_internal_config[timebase_id].tick++;
     }
+
+    if (true == timebase_internal_config[timebase_id].retune.pending)
+    {
+        apply_retune(timebase_id);
+    }
+}
+
+timebase_error_t timebase_resynchronise(const uint8_t id, const uint32_t elapsed_seconds)
+{
+    if (false == is_index_valid(id))
+    {
+        return TIMEBASE_ERROR_INVALID_INDEX;
+    }
+
+    if (false == timebase_internal_config[id].initialised)
+    {
+        return TIMEBASE_ERROR_UNINITIALISED;
+    }
+
+    // Tick counter, accumulator and frequency are also updated by the interrupt callback
+    uint8_t sreg = 0;
+    CRITICAL_SECTION_ENTER(sreg);
+    // Tick counter wraps around anyway, so only the low 16 bits of the elapsed ticks count are relevant
+    uint32_t elapsed_ticks = elapsed_seconds * timebase_internal_config[id].frequency;
+    timebase_internal_config[id].tick += (uint16_t) elapsed_ticks;
+    timebase_internal_config[id].accumulator.running = 0;
+    CRITICAL_SECTION_EXIT(sreg);
+    return TIMEBASE_ERROR_OK;
+}
+
+timebase_error_t timebase_retune(const uint8_t id, timebase_config_t const * const config)
+{
+    if (false == is_index_valid(id))
+    {
+        return TIMEBASE_ERROR_INVALID_INDEX;
+    }
+
+    if (NULL == config)
+    {
+        return TIMEBASE_ERROR_NULL_POINTER;
+    }
+
+    if (false == timebase_internal_config[id].initialised)
+    {
+        return TIMEBASE_ERROR_UNINITIALISED;
+    }
+
+    uint32_t target_freq = 0;
+    timebase_error_t ret = convert_timescale_to_frequency(config, &target_freq);
+    if (TIMEBASE_ERROR_OK != ret)
+    {
+        return ret;
+    }
+
+    uint8_t ocr_8_bit = 0;
+    uint16_t ocr = 0;
+    uint16_t accumulator = 0;
+    uint8_t prescaler = 0;
+    switch (timebase_internal_config[id].timer)
+    {
+        case TIMEBASE_TIMER_8_BIT:
+        {
+            timer_8_bit_prescaler_selection_t selection;
+            timer_8_bit_compute_matching_parameters(&config->cpu_freq, &target_freq, &selection, &ocr_8_bit, &accumulator);
+            prescaler = (uint8_t) selection;
+            ocr = ocr_8_bit;
+            break;
+        }
+
+        case TIMEBASE_TIMER_8_BIT_ASYNC:
+        {
+            timer_8_bit_async_prescaler_selection_t selection;
+            timer_8_bit_async_compute_matching_parameters(&config->cpu_freq, &target_freq, &selection, &ocr_8_bit, &accumulator);
+            prescaler = (uint8_t) selection;
+            ocr = ocr_8_bit;
+            break;
+        }
+
+        case TIMEBASE_TIMER_16_BIT:
+        {
+            timer_16_bit_prescaler_selection_t selection;
+            timer_16_bit_compute_matching_parameters(&config->cpu_freq, &target_freq, &selection, &ocr, &accumulator);
+            prescaler = (uint8_t) selection;
+            break;
+        }
+
+        default:
+            return TIMEBASE_ERROR_UNSUPPORTED_TIMER_TYPE;
+    }
+
+    // Interrupt callback shall not pick half written settings
+    uint8_t sreg = 0;
+    CRITICAL_SECTION_ENTER(sreg);
+    timebase_internal_config[id].retune.prescaler = prescaler;
+    timebase_internal_config[id].retune.ocr = ocr;
+    timebase_internal_config[id].retune.accumulator = accumulator;
+    timebase_internal_config[id].retune.frequency = target_freq;
+    timebase_internal_config[id].retune.pending = true;
+    CRITICAL_SECTION_EXIT(sreg);
+    return TIMEBASE_ERROR_OK;
+}
+
+timebase_error_t timebase_is_retune_pending(const uint8_t id, bool * const pending)
+{
+    if (false == is_index_valid(id))
+    {
+        return TIMEBASE_ERROR_INVALID_INDEX;
+    }
+
+    if (NULL == pending)
+    {
+        return TIMEBASE_ERROR_NULL_POINTER;
+    }
+
+    if (false == timebase_internal_config[id].initialised)
+    {
+        return TIMEBASE_ERROR_UNINITIALISED;
+    }
+
+    *pending = timebase_internal_config[id].retune.pending;
+    return TIMEBASE_ERROR_OK;
 }
 
 timebase_error_t timebase_deinit(const uint8_t id)
@@ -0,0 +1,52 @@
+/*
+
+------------------
+@<FreeMyCode>
+FreeMyCode version : 1.0 RC alpha
+    Author : bebenlebricolo
+    License : 
+        name : GPLv3
+        url : https://www.gnu.org/licenses/quick-guide-gplv3.html
+    Date : 12/02/2021
+    Project : LabBenchPowerSupply
+    Description : The Lab Bench Power Supply provides a simple design based around an Arduino Nano board to convert AC main voltage into
+ smaller ones, ranging from 0V to 16V, with voltage and current regulations
+<FreeMyCode>@
+------------------
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef CRITICAL_SECTION_HEADER
+#define CRITICAL_SECTION_HEADER
+
+/* Saves the global interrupt state in sreg and disables interrupts, restoring sreg leaves the critical section.
+   Both macros also act as compiler memory barriers : writing SREG back is a plain volatile store, which does not
+   prevent the compiler from moving non-volatile accesses of the protected region after it.
+   COMPILER_MEMORY_BARRIER() alone is enough when plain data is published to an interrupt routine through a volatile
+   flag : the data is written before the barrier, the flag after it */
+#ifdef UNIT_TESTING
+    #define COMPILER_MEMORY_BARRIER()       ((void)0)
+    #define CRITICAL_SECTION_ENTER(sreg)    ((void)(sreg))
+    #define CRITICAL_SECTION_EXIT(sreg)     ((void)(sreg))
+#else
+    #include <avr/io.h>
+    #include <avr/interrupt.h>
+
+    #define COMPILER_MEMORY_BARRIER()       __asm__ __volatile__ ("" ::: "memory")
+    #define CRITICAL_SECTION_ENTER(sreg)    do { (sreg) = SREG; cli(); COMPILER_MEMORY_BARRIER(); } while (0)
+    #define CRITICAL_SECTION_EXIT(sreg)     do { COMPILER_MEMORY_BARRIER(); SREG = (sreg); } while (0)
+#endif
+
+#endif /* CRITICAL_SECTION_HEADER */